@@ -15,6 +15,7 @@
 # ******************************************************************************
 """Provide a layer of abstraction for the ngraph++ runtime environment."""
 import logging
+import threading
 from typing import List, Union
 
 import numpy as np
@@ -70,6 +71,11 @@ class Computation(object):
         self.results = ng_function.get_results()
         self.handle = self.runtime.backend.compile(self.function)
 
+        # Backends that can attach host memory run directly on the caller's arrays
+        self.memory_attach = runtime.backend.is_supported_property(Backend.Property.memory_attach)
+        # Otherwise calls share the preallocated tensors below
+        self.tensor_views_lock = threading.Lock()
+
         self.tensor_views = []  # type: List[Tensor]
         for parameter in self.parameters:
             shape = parameter.get_shape()
@@ -86,22 +92,45 @@ class Computation(object):
         params_string = ', '.join([param.name for param in self.parameters])
         return '<Computation: {}({})>'.format(self.function.get_name(), params_string)
 
-    def __call__(self, *input_values):  # type: (*NumericData) -> List[NumericData]
-        """Run computation on input values and return result."""
-        for tensor_view, value in zip(self.tensor_views, input_values):
-            if not isinstance(value, np.ndarray):
-                value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
+    def __call__(self, *input_values, **kwargs):
+        # type: (*NumericData, **List[np.ndarray]) -> List[NumericData]
+        """Run computation on input values and return result.
 
-        self.handle.call(self.result_views, self.tensor_views)
+        :param input_values: values of the function parameters
+        :param outputs: optional list of C-contiguous arrays to write the results into
+        :return: list of results, the arrays in `outputs` when it is given
+        """
+        outputs = kwargs.pop('outputs', None)
+        if kwargs:
+            raise TypeError('Unexpected keyword arguments: {}'.format(', '.join(kwargs)))
 
-        results = []
-        for result_view in self.result_views:
-            result = np.ndarray(result_view.shape, dtype=get_dtype(result_view.element_type))
-            Computation._read_tensor_view_to_ndarray(result_view, result)
-            results.append(result)
+        if outputs is None:
+            outputs = [np.ndarray(view.shape, dtype=get_dtype(view.element_type))
+                       for view in self.result_views]
+        else:
+            for result_view, output in zip(self.result_views, outputs):
+                Computation._check_output_ndarray(output, result_view)
+
+        if self.memory_attach:
+            # Tensors wrap the arrays; the executable serializes or isolates concurrent calls
+            backend = self.runtime.backend
+            input_views = []
+            for tensor_view, value in zip(self.tensor_views, input_values):
+                value = Computation._prepare_ndarray(value, tensor_view)
+                input_views.append(
+                    backend.create_tensor(tensor_view.element_type, tensor_view.shape, value))
+            output_views = [backend.create_tensor(view.element_type, view.shape, output)
+                            for view, output in zip(self.result_views, outputs)]
+            self.handle.call(output_views, input_views)
+        else:
+            with self.tensor_views_lock:
+                for tensor_view, value in zip(self.tensor_views, input_values):
+                    Computation._write_ndarray_to_tensor_view(value, tensor_view)
+                self.handle.call(self.result_views, self.tensor_views)
+                for result_view, output in zip(self.result_views, outputs):
+                    Computation._read_tensor_view_to_ndarray(result_view, output)
 
-        return results
+        return outputs
 
     def serialize(self, indent=0):  # type: (int) -> str
         """Serialize function (compute graph) to a JSON string.
@@ -116,8 +145,11 @@ class Computation(object):
         return int((element_type.bitwidth / 8.0) * element_count)
 
     @staticmethod
-    def _write_ndarray_to_tensor_view(value, tensor_view):
-        # type: (np.ndarray, Tensor) -> None
+    def _prepare_ndarray(value, tensor_view):
+        # type: (NumericData, Tensor) -> np.ndarray
+        """Return value as a C-contiguous array of the tensor's type and shape."""
+        if not isinstance(value, np.ndarray):
+            value = np.array(value)
         tensor_view_dtype = get_dtype(tensor_view.element_type)
         if list(tensor_view.shape) != list(value.shape) and len(value.shape) > 0:
             raise UserInputError("Provided tensor's shape: %s does not match the expected: %s.",
@@ -128,11 +160,31 @@ class Computation(object):
                 value.dtype,
                 tensor_view.element_type)
             value = value.astype(tensor_view_dtype)
+        if len(value.shape) == 0:
+            value = np.broadcast_to(value, list(tensor_view.shape))
+        return np.ascontiguousarray(value)
 
+    @staticmethod
+    def _check_output_ndarray(output, tensor_view):
+        # type: (np.ndarray, Tensor) -> None
+        if not isinstance(output, np.ndarray):
+            raise UserInputError('Outputs must be NumPy arrays.')
+        if list(output.shape) != list(tensor_view.shape):
+            raise UserInputError("Provided output's shape: %s does not match the expected: %s.",
+                                 list(output.shape), list(tensor_view.shape))
+        if output.dtype != get_dtype(tensor_view.element_type):
+            raise UserInputError("Provided output's type: %s does not match the expected: %s.",
+                                 output.dtype, tensor_view.element_type)
+        if not output.flags.c_contiguous or not output.flags.writeable:
+            raise UserInputError('Outputs must be writeable C-contiguous arrays.')
+
+    @staticmethod
+    def _write_ndarray_to_tensor_view(value, tensor_view):
+        # type: (NumericData, Tensor) -> None
         buffer_size = Computation._get_buffer_size(
             tensor_view.element_type, tensor_view.element_count)
 
-        nparray = np.ascontiguousarray(value)
+        nparray = Computation._prepare_ndarray(value, tensor_view)
         tensor_view.write(util.numpy_to_c(nparray), buffer_size)
 
     @staticmethod
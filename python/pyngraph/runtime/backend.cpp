@@ -16,6 +16,7 @@
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <stdexcept>
 
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -30,6 +31,31 @@ static std::shared_ptr<ngraph::runtime::Executable> compile(ngraph::runtime::Bac
     return self->compile(func, enable_performance_data);
 }
 
+// Wraps the memory of a C-contiguous buffer (e.g. a NumPy array) without copying it
+static std::shared_ptr<ngraph::runtime::Tensor>
+    create_tensor_from_buffer(ngraph::runtime::Backend* self,
+                              const ngraph::element::Type& element_type,
+                              const ngraph::Shape& shape,
+                              py::buffer buffer)
+{
+    py::buffer_info info = buffer.request();
+    if (static_cast<size_t>(info.size * info.itemsize) !=
+        ngraph::shape_size(shape) * element_type.size())
+    {
+        throw std::invalid_argument("Buffer size does not match the tensor type and shape");
+    }
+    py::ssize_t stride = info.itemsize;
+    for (size_t i = info.ndim; i-- > 0;)
+    {
+        if (info.shape[i] > 1 && info.strides[i] != stride)
+        {
+            throw std::invalid_argument("Buffer must be C-contiguous");
+        }
+        stride *= info.shape[i];
+    }
+    return self->create_tensor(element_type, shape, info.ptr);
+}
+
 static std::shared_ptr<ngraph::runtime::Backend> create(const std::string& type)
 {
     bool must_support_dynamic = false;
@@ -47,5 +73,11 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    // The tensor keeps the buffer alive
+    backend.def("create_tensor", &create_tensor_from_buffer, py::keep_alive<0, 4>());
     backend.def("compile", &compile);
+    backend.def("is_supported_property", &ngraph::runtime::Backend::is_supported_property);
+
+    py::enum_<ngraph::runtime::Backend::Property>(backend, "Property")
+        .value("memory_attach", ngraph::runtime::Backend::Property::memory_attach);
 }
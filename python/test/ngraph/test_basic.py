@@ -16,6 +16,7 @@
 import numpy as np
 import pytest
 import json
+import threading
 
 import ngraph as ng
 from ngraph.exceptions import UserInputError
@@ -157,6 +158,47 @@ def test_bad_data_shape():
         computation(value_a, value_b)
 
 
+def test_computation_writes_into_outputs():
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = get_runtime().computation(parameter_a * parameter_b, parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    value_b = np.array([[5, 6], [7, 8]], dtype=np.float32)
+    output = np.zeros(shape, dtype=np.float32)
+    result = computation(value_a, value_b, outputs=[output])
+    assert result[0] is output
+    assert np.allclose(output, np.array([[5, 12], [21, 32]], dtype=np.float32))
+
+    with pytest.raises(UserInputError):
+        computation(value_a, value_b, outputs=[np.zeros(shape, dtype=np.float64)])
+    with pytest.raises(UserInputError):
+        computation(value_a, value_b, outputs=[np.zeros([4, 4], dtype=np.float32)[::2, ::2]])
+
+
+def test_computation_called_from_threads():
+    shape = [64, 64]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = get_runtime().computation(parameter_a + parameter_b, parameter_a, parameter_b)
+
+    values = [np.full(shape, i, dtype=np.float32) for i in range(8)]
+    results = [None] * len(values)
+
+    def worker(i):
+        results[i] = computation(values[i], values[i])[0]
+
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(len(values))]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    for value, result in zip(values, results):
+        assert np.allclose(result, value + value)
+
+
 def test_constant_get_data_bool():
     input_data = np.array([True, False, False, True])
     node = ng.constant(input_data, dtype=np.bool)
@@ -23,9 +23,28 @@
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/compiled_kernel.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
 #include "ngraph/type/element_type.hpp"
 
 #include <llvm/ADT/STLExtras.h>
@@ -44,6 +63,8 @@
 #include <mlir/Transforms/DialectConversion.h>
 #include <mlir/Transforms/Passes.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
 #include <mutex>
 
@@ -55,14 +76,17 @@ using namespace ngraph::runtime::ngmlir;
 #define COMPILE_OP_DECL(op_name)                                                                   \
     create_op<op_name>(MLIRCompiler & compiler, const ngraph::Node* ng_node)
 
-MLIRCompiler::MLIRCompiler(const ngraph::op::CompiledKernel* compiled_kernel,
-                           const std::vector<void*>& external_tensors)
+// Temporaries are aligned in the scratch like the tensors planned by nGraph.
+static const size_t s_temp_alignment = 64;
+
+static size_t align_temp(size_t size)
+{
+    return (size + s_temp_alignment - 1) / s_temp_alignment * s_temp_alignment;
+}
+
+MLIRCompiler::MLIRCompiler(const ngraph::op::CompiledKernel* compiled_kernel)
     : m_compiled_kernel(compiled_kernel)
-    , m_external_tensors(external_tensors)
 {
-    NGRAPH_CHECK((m_compiled_kernel->get_arguments().size() +
-                  m_compiled_kernel->get_kernel_outputs().size()) == external_tensors.size(),
-                 "Number of arguments and outputs doesn't match number of tensors");
 }
 
 void MLIRCompiler::init_mlir()
@@ -82,14 +106,88 @@ void MLIRCompiler::init_mlir()
     }
 }
 
-void MLIRCompiler::compile_and_run()
+void MLIRCompiler::compile()
 {
     build_ng_dialect_module();
     lower_ng_dialect();
     optimize();
-    bind_arguments();
-    execute();
-    cleanup();
+    lower_to_llvm();
+}
+
+void MLIRCompiler::run(const std::vector<void*>& external_tensors)
+{
+    NGRAPH_CHECK(m_invoker, "MLIR sub-graph is not compiled");
+    size_t num_args = m_compiled_kernel->get_arguments().size();
+    NGRAPH_CHECK(external_tensors.size() == num_args + m_compiled_kernel->get_output_size(),
+                 "Number of arguments and outputs doesn't match number of tensors");
+
+    // The function takes a memref for each argument and output of the sub-graph, followed by
+    // one for each temporary. A memref with a static shape is just the pointer to its data.
+    size_t num_tensors = num_args + m_compiled_kernel->get_kernel_outputs().size();
+    SmallVector<mlir::StaticFloatMemRef, 8> memrefs;
+    for (size_t i = 0; i < num_tensors; ++i)
+    {
+        memrefs.push_back({static_cast<float*>(external_tensors[i])});
+    }
+    if (!m_temp_offsets.empty())
+    {
+        char* scratch = static_cast<char*>(external_tensors.back());
+        for (size_t offset : m_temp_offsets)
+        {
+            memrefs.push_back({reinterpret_cast<float*>(scratch + offset)});
+        }
+    }
+
+    // Call the JIT-compiled function with the arguments. For API uniformity reasons, it takes a
+    // list of type-erased pointers to arguments. The arguments live on the stack of this call
+    // and the function was looked up when it was compiled, so concurrent calls share nothing.
+    SmallVector<void*, 8> invoke_args;
+    for (auto& memref : memrefs)
+    {
+        invoke_args.push_back(&memref);
+    }
+    m_invoker(invoke_args.data());
+}
+
+// Mirrors the temporaries created by the dialect lowering: the result of each node that isn't an
+// output of the sub-graph, and the maximum and the sum of each Softmax.
+size_t MLIRCompiler::get_scratch_size(const NodeVector& node_list, const NodeVector& outputs)
+{
+    size_t size = 0;
+    for (auto& node : node_list)
+    {
+        size_t element_size = node->get_element_type().size();
+        const Shape& shape = node->get_shape();
+        if (std::find(outputs.begin(), outputs.end(), node) == outputs.end())
+        {
+            size += align_temp(element_size * shape_size(shape));
+        }
+        if (auto softmax = std::dynamic_pointer_cast<ngraph::op::Softmax>(node))
+        {
+            size_t reduced_size = element_size;
+            for (size_t i = 0; i < shape.size(); ++i)
+            {
+                if (softmax->get_axes().count(i) == 0)
+                {
+                    reduced_size *= shape[i];
+                }
+            }
+            size += 2 * align_temp(reduced_size);
+        }
+    }
+    return size;
+}
+
+size_t MLIRCompiler::allocate_temp(size_t size)
+{
+    size_t offset = m_scratch_used;
+    m_scratch_used += align_temp(size);
+    NGRAPH_CHECK(m_scratch_used <= m_compiled_kernel->get_scratch_size(),
+                 "Temporaries of ",
+                 m_compiled_kernel->get_name(),
+                 " don't fit in its scratch");
+    m_temp_offsets.push_back(offset);
+    return offset;
 }
 
 // Creates an MLIR module and function with nGraph dialect ops from the input CompiledKernel.
@@ -233,6 +331,15 @@ void MLIRCompiler::lower_ng_dialect()
 void MLIRCompiler::optimize()
 {
     mlir::PassManager pm;
+    // Fuse the loop nests of producers into their consumers, e.g. Dot->Add->Relu, so that
+    // intermediate results are consumed while they are in cache, and tile the fused nests for
+    // the cache. NGRAPH_MLIR_DISABLE_LOOP_OPT turns both off, e.g. to compare against them.
+    if (std::getenv("NGRAPH_MLIR_DISABLE_LOOP_OPT") == nullptr)
+    {
+        pm.addPass(mlir::createLoopFusionPass());
+        pm.addPass(mlir::createLoopTilingPass(get_tile_cache_size()));
+        pm.addPass(mlir::createCanonicalizerPass());
+    }
     // Lower affine ops
     pm.addPass(mlir::createLowerAffinePass());
     auto rr = pm.run(m_module.get());
@@ -241,6 +348,18 @@ void MLIRCompiler::optimize()
     dump_mlir_module("Standard Dialect Dump:");
 }
 
+// Cache size in bytes that loop nests are tiled for: NGRAPH_MLIR_TILE_CACHE_KB, or 256 KiB,
+// a typical L2 share per core.
+uint64_t MLIRCompiler::get_tile_cache_size()
+{
+    uint64_t size_kb = 256;
+    if (const char* env = std::getenv("NGRAPH_MLIR_TILE_CACHE_KB"))
+    {
+        size_kb = std::strtoull(env, nullptr, 10);
+    }
+    return size_kb * 1024;
+}
+
 // MLIR builders
 #define TI(x) std::type_index(typeid(x))
 
@@ -278,11 +397,173 @@ namespace ngraph
                 return compiler.create_binary_op<mlir::NGAddOp>(ng_node);
             }
 
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Subtract)
+            {
+                return compiler.create_binary_op<mlir::NGSubOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Multiply)
+            {
+                return compiler.create_binary_op<mlir::NGMulOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Divide)
+            {
+                return compiler.create_binary_op<mlir::NGDivOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Maximum)
+            {
+                return compiler.create_binary_op<mlir::NGMaxOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Minimum)
+            {
+                return compiler.create_binary_op<mlir::NGMinOp>(ng_node);
+            }
+
             template <>
             mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Dot)
             {
                 return compiler.create_binary_op<mlir::NGDotOp>(ng_node);
             }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Abs)
+            {
+                return compiler.create_unary_op<mlir::NGAbsOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Exp)
+            {
+                return compiler.create_unary_op<mlir::NGExpOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Log)
+            {
+                return compiler.create_unary_op<mlir::NGLogOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Negative)
+            {
+                return compiler.create_unary_op<mlir::NGNegOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Relu)
+            {
+                return compiler.create_unary_op<mlir::NGReluOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Sqrt)
+            {
+                return compiler.create_unary_op<mlir::NGSqrtOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Tanh)
+            {
+                return compiler.create_unary_op<mlir::NGTanhOp>(ng_node);
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Sum)
+            {
+                auto sum = static_cast<const ngraph::op::Sum*>(ng_node);
+                return compiler.create_reduction_op<mlir::NGSumRedOp>(ng_node,
+                                                                      sum->get_reduction_axes());
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Max)
+            {
+                auto max = static_cast<const ngraph::op::Max*>(ng_node);
+                return compiler.create_reduction_op<mlir::NGMaxRedOp>(ng_node,
+                                                                      max->get_reduction_axes());
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Broadcast)
+            {
+                auto broadcast = static_cast<const ngraph::op::Broadcast*>(ng_node);
+                return compiler.m_builder
+                    ->create<mlir::NGBroadcastOp>(
+                        mlir::UnknownLoc::get(&compiler.m_context),
+                        compiler.get_mlir_type(ng_node->get_output_tensor_ptr().get()),
+                        compiler.get_argument_value(ng_node, 0),
+                        compiler.get_i64_array_attr(broadcast->get_broadcast_axes()))
+                    .getResult();
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Reshape)
+            {
+                auto reshape = static_cast<const ngraph::op::Reshape*>(ng_node);
+                return compiler.m_builder
+                    ->create<mlir::NGReshapeOp>(
+                        mlir::UnknownLoc::get(&compiler.m_context),
+                        compiler.get_mlir_type(ng_node->get_output_tensor_ptr().get()),
+                        compiler.get_argument_value(ng_node, 0),
+                        compiler.get_i64_array_attr(reshape->get_input_order()))
+                    .getResult();
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Concat)
+            {
+                auto concat = static_cast<const ngraph::op::Concat*>(ng_node);
+                SmallVector<mlir::Value*, 4> args;
+                for (size_t i = 0; i < ng_node->get_input_size(); i++)
+                {
+                    args.push_back(compiler.get_argument_value(ng_node, i));
+                }
+                return compiler.m_builder
+                    ->create<mlir::NGConcatOp>(
+                        mlir::UnknownLoc::get(&compiler.m_context),
+                        compiler.get_mlir_type(ng_node->get_output_tensor_ptr().get()),
+                        args,
+                        compiler.m_builder->getI64IntegerAttr(concat->get_concatenation_axis()))
+                    .getResult();
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Softmax)
+            {
+                auto softmax = static_cast<const ngraph::op::Softmax*>(ng_node);
+                return compiler.m_builder
+                    ->create<mlir::NGSoftMaxOp>(
+                        mlir::UnknownLoc::get(&compiler.m_context),
+                        compiler.get_mlir_type(ng_node->get_output_tensor_ptr().get()),
+                        compiler.get_argument_value(ng_node, 0),
+                        compiler.get_i64_array_attr(softmax->get_axes()))
+                    .getResult();
+            }
+
+            template <>
+            mlir::Value* MLIRCompiler::COMPILE_OP_DECL(ngraph::op::Convolution)
+            {
+                auto convolution = static_cast<const ngraph::op::Convolution*>(ng_node);
+                return compiler.m_builder
+                    ->create<mlir::NGConvolutionOp>(
+                        mlir::UnknownLoc::get(&compiler.m_context),
+                        compiler.get_mlir_type(ng_node->get_output_tensor_ptr().get()),
+                        compiler.get_argument_value(ng_node, 0),
+                        compiler.get_argument_value(ng_node, 1),
+                        compiler.get_i64_array_attr(convolution->get_window_movement_strides()),
+                        compiler.get_i64_array_attr(convolution->get_window_dilation_strides()),
+                        compiler.get_i64_array_attr(convolution->get_padding_below()),
+                        compiler.get_i64_array_attr(convolution->get_padding_above()))
+                    .getResult();
+            }
         }
     }
 }
@@ -292,18 +573,42 @@ const MLIRCompiler::MLIRCompOpMap MLIRCompiler::op_dispatcher{
 #include "ops_supported.inc"
 };
 
+mlir::Value* MLIRCompiler::get_argument_value(const ngraph::Node* ng_node, size_t index)
+{
+    auto tensor = ng_node->get_argument(index)->get_output_tensor_ptr();
+    return get_tensor_value(tensor.get()).m_value;
+}
+
+template <typename UnaryOp>
+mlir::Value* MLIRCompiler::create_unary_op(const ngraph::Node* ng_node)
+{
+    auto arg_v = get_argument_value(ng_node, 0);
+    auto res_type = get_mlir_type(ng_node->get_output_tensor_ptr().get());
+    return m_builder->create<UnaryOp>(mlir::UnknownLoc::get(&m_context), res_type, arg_v)
+        .getResult();
+}
+
 template <typename BinOp>
 mlir::Value* MLIRCompiler::create_binary_op(const ngraph::Node* ng_node)
 {
-    auto lhs = ng_node->get_argument(0)->get_output_tensor_ptr();
-    auto rhs = ng_node->get_argument(1)->get_output_tensor_ptr();
-    auto lhs_v = get_tensor_value(lhs.get()).m_value;
-    auto rhs_v = get_tensor_value(rhs.get()).m_value;
+    auto lhs_v = get_argument_value(ng_node, 0);
+    auto rhs_v = get_argument_value(ng_node, 1);
     auto res_type = get_mlir_type(ng_node->get_output_tensor_ptr().get());
     return m_builder->create<BinOp>(mlir::UnknownLoc::get(&m_context), res_type, lhs_v, rhs_v)
         .getResult();
 }
 
+template <typename RedOp>
+mlir::Value* MLIRCompiler::create_reduction_op(const ngraph::Node* ng_node, const AxisSet& axes)
+{
+    auto arg_v = get_argument_value(ng_node, 0);
+    auto res_type = get_mlir_type(ng_node->get_output_tensor_ptr().get());
+    return m_builder
+        ->create<RedOp>(
+            mlir::UnknownLoc::get(&m_context), res_type, arg_v, get_i64_array_attr(axes))
+        .getResult();
+}
+
 void MLIRCompiler::create_return()
 {
     std::vector<mlir::Value*> value_list;
@@ -314,47 +619,8 @@ void MLIRCompiler::create_return()
     m_builder->create<mlir::NGReturnOp>(mlir::UnknownLoc::get(&m_context), value_list);
 }
 
-// Binds MLIR function arguments to the proper values. This includes externally allocated tensors
-// helpers to be used inside the function.
-void MLIRCompiler::bind_arguments()
-{
-    NGRAPH_CHECK(m_module, "MLIR module is not ready.");
-
-    mlir::Function* func = m_module->getNamedFunction("main");
-    NGRAPH_CHECK(func && !func->getBlocks().empty(), "Function not found");
-
-    // Create list with a type-erased double pointer for each invocation arguments.
-    // We currently use 'allocateMemRefArguments', which creates a
-    // SmallVector<StaticFloatMemref*>. StaticFloatMemref is just a struct with the
-    // actual pointer to the data.
-
-    // create MemRef args
-    auto expected_arguments = allocate_memref_args(func);
-    NGRAPH_CHECK(expected_arguments.size(), "Arguments can't be created");
-    m_invoke_args = std::move(expected_arguments);
-
-    NGRAPH_CHECK(m_invoke_args.size() == m_external_tensors.size(),
-                 "Number of external tensors doesn't match number of function arguments");
-
-    // Assign external tensor pointers to invocation arguments.
-    for (size_t i = 0, num_args = m_invoke_args.size(); i < num_args; ++i)
-    {
-        ((mlir::StaticFloatMemRef*)m_invoke_args[i])->data = (float*)m_external_tensors[i];
-    }
-
-    // Add pointer to memory manager
-    // malloc here since that's what allocateMemRefArguments use
-    // TODO (nmostafa): Better way of doing this ? Use builder allocator ?
-    MLIRMemMgr** mem_mgr_arg = reinterpret_cast<MLIRMemMgr**>(malloc(sizeof(void*)));
-    NGRAPH_CHECK(mem_mgr_arg != nullptr);
-    *mem_mgr_arg = &get_mem_mgr();
-    // inserting memory manager ptr in right location ?
-    NGRAPH_CHECK(m_invoke_args.size() == get_mem_mgr_arg_id(func));
-    m_invoke_args.push_back(static_cast<void*>(mem_mgr_arg));
-}
-
-// Lowers standard dialect to LLVM dialect and uses the MLIR execution engine to execute the code.
-void MLIRCompiler::execute()
+// Lowers standard dialect to LLVM dialect and creates the MLIR execution engine that runs the code.
+void MLIRCompiler::lower_to_llvm()
 {
     NGRAPH_CHECK(m_module, "MLIR module is not ready.");
 
@@ -378,65 +644,14 @@ void MLIRCompiler::execute()
     NGRAPH_CHECK(maybeEngine, "failed to construct an execution engine");
     m_engine = std::move(maybeEngine.get());
 
-    // Invoke the JIT-compiled function with the arguments. Note that, for API
-    // uniformity reasons, it takes a list of type-erased pointers to arguments.
-    // Please, note that 'invoke' method is overloaded with a parameter pack version.
-    // Make sure the MutableArrayRef version is invoked.
-    auto invocationResult = m_engine->invoke("main", llvm::MutableArrayRef<void*>(m_invoke_args));
-    NGRAPH_CHECK(!invocationResult, "JIT invocation of 'main' failed\n");
-}
-
-void MLIRCompiler::cleanup()
-{
-    // Free void double pointer arguments without freeing external tensor data.
-    for (auto* arg : m_invoke_args)
-    {
-        free(arg);
-    }
+    // Look up the packed 'main' once. ExecutionEngine::invoke would look it up in the JIT
+    // session on every call, which concurrent runtime contexts must not do.
+    auto maybeInvoker = m_engine->lookup("main");
+    NGRAPH_CHECK(maybeInvoker, "failed to look up 'main' in the execution engine");
+    m_invoker = *maybeInvoker;
 
     // Free MLIR function builder.
-    if (m_builder)
-    {
-        m_builder.reset(nullptr);
-    }
-
-    // Free allocated memory for JIT'ed code temps
-    m_mem_mgr.freeAll();
-}
-
-SmallVector<void*, 8> MLIRCompiler::allocate_memref_args(mlir::Function* func)
-{
-    SmallVector<void*, 8> args;
-    args.reserve(func->getNumArguments());
-    for (const auto& arg : func->getArguments())
-    {
-        auto descriptor = allocate_memref_descriptor(arg->getType());
-
-        if (!descriptor)
-        {
-            continue;
-        }
-        args.push_back(descriptor);
-    }
-    return args;
-}
-
-mlir::StaticFloatMemRef* MLIRCompiler::allocate_memref_descriptor(mlir::Type type)
-{
-    auto memRefType = type.dyn_cast<mlir::MemRefType>();
-    if (!memRefType)
-    {
-        return nullptr;
-    }
-    NGRAPH_CHECK(memRefType.getNumDynamicDims() == 0, "No support for dynamic shapes");
-
-    // We only use StaticFloatMemRef because that's what MLIR currently offers.
-    // We should expand this with different types and dynamic MemRefs
-    auto* descriptor =
-        reinterpret_cast<mlir::StaticFloatMemRef*>(malloc(sizeof(mlir::StaticFloatMemRef)));
-    NGRAPH_CHECK(descriptor != nullptr, "NULL MemRef descriptor");
-    descriptor->data = nullptr;
-    return descriptor;
+    m_builder.reset(nullptr);
 }
 
 void MLIRCompiler::dump_mlir_module(const std::string msg)
@@ -16,7 +16,7 @@
 
 #pragma once
 
-#include "memory_manager.hpp"
+#include "ngraph/axis_set.hpp"
 #include "ngraph/node.hpp"
 
 #include <mlir/ExecutionEngine/ExecutionEngine.h>
@@ -60,19 +60,27 @@ namespace ngraph
                 using TensorList = std::vector<descriptor::Tensor*>;
                 using TypeList = llvm::SmallVector<mlir::Type, 4>;
 
-                MLIRCompiler(const ngraph::op::CompiledKernel* compiled_kernel,
-                             const std::vector<void*>& external_tensors);
+                MLIRCompiler(const ngraph::op::CompiledKernel* compiled_kernel);
 
-                /// Compiles and runs a subgraph in MLIR.
-                void compile_and_run();
+                /// Compiles the sub-graph in MLIR. It must be called once, before run.
+                void compile();
 
-                /// Returns the memory manager used by this sub-graph compiler.
-                MLIRMemMgr& get_mem_mgr() { return m_mem_mgr; }
-                /// Returns memory manager pointer argument ID in call interface.
-                unsigned get_mem_mgr_arg_id(mlir::Function* func)
-                {
-                    return func->getNumArguments() - 1;
-                }
+                /// Runs the compiled sub-graph. \p external_tensors holds pointers to the
+                /// arguments of the CompiledKernel followed by all of its outputs, including the
+                /// scratch output if it has one. Temporaries live in the scratch, so calls don't
+                /// allocate memory for them, and calls with different tensors may run
+                /// concurrently since they only read the compiled state.
+                void run(const std::vector<void*>& external_tensors);
+
+                /// Returns the size in bytes of the scratch that the compiled code of a sub-graph
+                /// with nodes \p node_list and outputs \p outputs needs for its temporaries.
+                static size_t get_scratch_size(const NodeVector& node_list,
+                                               const NodeVector& outputs);
+
+                /// Reserves \p size bytes of the scratch for a temporary of the compiled code and
+                /// returns the offset of the reservation. Temporaries are bound to the function
+                /// arguments that follow the outputs, in the order they were reserved in.
+                size_t allocate_temp(size_t size);
 
             private:
                 struct TensorInfo
@@ -85,9 +93,8 @@ namespace ngraph
                 void build_ng_dialect_module();
                 void lower_ng_dialect();
                 void optimize();
-                void bind_arguments();
-                void execute();
-                void cleanup();
+                static uint64_t get_tile_cache_size();
+                void lower_to_llvm();
 
                 mlir::Type get_mlir_type(const descriptor::Tensor* tensor);
                 mlir::Type get_mlir_type(const element::Type& type);
@@ -103,16 +110,28 @@ namespace ngraph
                                              "' in MLIR Compiler");
                 }
 
+                /// Returns the value of argument index of ng_node.
+                mlir::Value* get_argument_value(const ngraph::Node* ng_node, size_t index);
+
+                template <typename UnaryOp>
+                mlir::Value* create_unary_op(const ngraph::Node* ng_node);
+
                 template <typename BinOp>
                 mlir::Value* create_binary_op(const ngraph::Node* ng_node);
 
-                void create_return();
+                template <typename RedOp>
+                mlir::Value* create_reduction_op(const ngraph::Node* ng_node,
+                                                 const AxisSet& axes);
 
-                /// Helper to create memref arguments for MLIR function signature
-                llvm::SmallVector<void*, 8> allocate_memref_args(mlir::Function* func);
+                /// Converts axes, strides or paddings into an array attribute.
+                template <typename T>
+                mlir::ArrayAttr get_i64_array_attr(const T& values)
+                {
+                    llvm::SmallVector<int64_t, 4> attr(values.begin(), values.end());
+                    return m_builder->getI64ArrayAttr(attr);
+                }
 
-                /// Helper to allocate a mem ref object. Handles static shapes only for now.
-                mlir::StaticFloatMemRef* allocate_memref_descriptor(mlir::Type type);
+                void create_return();
 
                 /// Helper to dump MLIR module into llvm::dbgs prepended by the message \p msg.
                 void dump_mlir_module(const std::string msg);
@@ -121,11 +140,9 @@ namespace ngraph
                 // Sub-graph to be compiled and executed with MLIR.
                 const ngraph::op::CompiledKernel* m_compiled_kernel;
 
-                // Pointers to externally allocated memory for sub-graph's input and output tensors.
-                const std::vector<void*>& m_external_tensors;
-
-                // Arguments for the MLIR function generated for the nGraph sub-graph.
-                llvm::SmallVector<void*, 8> m_invoke_args;
+                // Offsets in the scratch of the temporaries of the compiled code.
+                std::vector<size_t> m_temp_offsets;
+                size_t m_scratch_used = 0;
 
                 // MLIR context that holds all the MLIR information related to the sub-graph
                 // compilation.
@@ -134,6 +151,8 @@ namespace ngraph
                 std::unique_ptr<mlir::Module> m_module;
                 std::unique_ptr<mlir::FuncBuilder> m_builder;
                 std::unique_ptr<mlir::ExecutionEngine> m_engine;
+                // Packed entry point of the compiled sub-graph in m_engine.
+                void (*m_invoker)(void**) = nullptr;
 
                 using TensorToInfo = std::pair<descriptor::Tensor*, TensorInfo>;
                 using TensorToInfoMap = std::unordered_map<descriptor::Tensor*, TensorInfo>;
@@ -145,9 +164,6 @@ namespace ngraph
                 // use for MLIR dialect gen
                 TensorToInfoMap m_tensor_to_value_map;
                 static const MLIRCompOpMap op_dispatcher;
-
-                // Memory manager for temp allocations inside JIT'ed code
-                MLIRMemMgr m_mem_mgr;
             };
         }
     }
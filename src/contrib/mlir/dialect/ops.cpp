@@ -80,10 +80,31 @@ static mlir::LogicalResult verifyBinaryArithOp(T* op)
     return verifyCompatibleOperandsAndResults(op);
 }
 
+/// Checks that the axes of op are distinct axes of operand, and that the result has the rank
+/// of operand without them
 template <typename T>
 static mlir::LogicalResult verifyAxisReductionOp(T* op)
 {
-    return mlir::failure();
+    mlir::Type t0 = op->getOperation()->getOperand(0)->getType();
+    mlir::Type r0 = op->getOperation()->getResult(0)->getType();
+    NGTensorType operandType = t0.cast<NGTensorType>();
+    NGTensorType resultType = r0.cast<NGTensorType>();
+    int64_t rank = operandType.getRank();
+    llvm::SmallVector<bool, 4> reduced(rank, false);
+    for (auto axis : op->axes().getValue())
+    {
+        int64_t index = axis.template cast<IntegerAttr>().getInt();
+        if (index < 0 || index >= rank || reduced[index])
+        {
+            return op->emitOpError("Invalid reduction axis");
+        }
+        reduced[index] = true;
+    }
+    if (resultType.getRank() != rank - static_cast<int64_t>(op->axes().size()))
+    {
+        return op->emitOpError("Incompatible result rank for reduction op");
+    }
+    return mlir::success();
 }
 
 template <typename T>
@@ -113,6 +134,99 @@ mlir::LogicalResult verifyOp(NGDotOp* op)
     return mlir::success();
 }
 
+template <>
+mlir::LogicalResult verifyOp(NGBroadcastOp* op)
+{
+    NGTensorType argType = op->arg()->getType().cast<NGTensorType>();
+    NGTensorType resType = op->getResult()->getType().cast<NGTensorType>();
+    if (argType.getRank() + static_cast<int>(op->axes().size()) != resType.getRank())
+    {
+        return op->emitOpError("Incompatible result rank for broadcast op");
+    }
+    return mlir::success();
+}
+
+template <>
+mlir::LogicalResult verifyOp(NGReshapeOp* op)
+{
+    NGTensorType argType = op->arg()->getType().cast<NGTensorType>();
+    NGTensorType resType = op->getResult()->getType().cast<NGTensorType>();
+    if (static_cast<int>(op->axisOrder().size()) != argType.getRank())
+    {
+        return op->emitOpError("Axis order must have one entry per argument axis");
+    }
+    if (argType.getSizeInBytes() != resType.getSizeInBytes())
+    {
+        return op->emitOpError("Reshape must not change the number of elements");
+    }
+    return mlir::success();
+}
+
+template <>
+mlir::LogicalResult verifyOp(NGConcatOp* op)
+{
+    NGTensorType resType = op->getResult()->getType().cast<NGTensorType>();
+    int64_t axis = op->concatenationAxis().getSExtValue();
+    if (axis < 0 || axis >= resType.getRank())
+    {
+        return op->emitOpError("Invalid concatenation axis");
+    }
+    int64_t concatenated = 0;
+    for (auto operand : op->getOperation()->getOperands())
+    {
+        NGTensorType argType = operand->getType().cast<NGTensorType>();
+        if (argType.getRank() != resType.getRank())
+        {
+            return op->emitOpError("Incompatible operand rank for concat op");
+        }
+        concatenated += argType.getShape()[axis];
+    }
+    if (concatenated != resType.getShape()[axis])
+    {
+        return op->emitOpError("Incompatible result shape for concat op");
+    }
+    return mlir::success();
+}
+
+template <>
+mlir::LogicalResult verifyOp(NGSoftMaxOp* op)
+{
+    NGTensorType argType = op->arg()->getType().cast<NGTensorType>();
+    NGTensorType resType = op->getResult()->getType().cast<NGTensorType>();
+    if (!resType.isCompatible(argType))
+    {
+        return op->emitOpError("Incompatible result shape or type for softmax op");
+    }
+    return mlir::success();
+}
+
+template <>
+mlir::LogicalResult verifyOp(NGConvolutionOp* op)
+{
+    NGTensorType imagesType = op->images()->getType().cast<NGTensorType>();
+    NGTensorType filtersType = op->filters()->getType().cast<NGTensorType>();
+    NGTensorType resType = op->getResult()->getType().cast<NGTensorType>();
+    int64_t spatialRank = imagesType.getRank() - 2;
+    if (spatialRank < 1 || filtersType.getRank() != imagesType.getRank() ||
+        resType.getRank() != imagesType.getRank())
+    {
+        return op->emitOpError("Incompatible operand ranks for convolution op");
+    }
+    if (static_cast<int64_t>(op->strides().size()) != spatialRank ||
+        static_cast<int64_t>(op->dilations().size()) != spatialRank ||
+        static_cast<int64_t>(op->padBelow().size()) != spatialRank ||
+        static_cast<int64_t>(op->padAbove().size()) != spatialRank)
+    {
+        return op->emitOpError(
+            "Strides, dilations and paddings must have one entry per spatial axis");
+    }
+    if (imagesType.getShape()[1] != filtersType.getShape()[1])
+    {
+        return op->emitOpError("Images and filters have a different number of channels");
+    }
+    return mlir::success();
+}
+
 template <>
 mlir::LogicalResult verifyOp(NGSelectOp* op)
 {
@@ -29,6 +29,8 @@
 #include <mlir/IR/StandardTypes.h>
 #include <mlir/Transforms/DialectConversion.h>
 
+#include <functional>
+#include <limits>
 #include <map>
 
 // anonymous namespace
@@ -37,6 +39,7 @@ namespace
 {
     using namespace mlir;
     using namespace mlir::edsc;
+    using namespace mlir::edsc::op;
     using namespace ngraph::runtime;
 
     class DialectLoweringPass;
@@ -59,8 +62,28 @@ namespace
         // Initialize the list of converters.
         void initConverters(OwningRewritePatternList& patterns, MLIRContext* mlirContext) override
         {
-            RewriteListBuilder<NGAddOpConversion, NGDotOpConversion, NGReturnOpConversion>::build(
-                patterns, mlirContext, m_pass);
+            RewriteListBuilder<NGAddOpConversion,
+                               NGSubOpConversion,
+                               NGMulOpConversion,
+                               NGDivOpConversion,
+                               NGMaxOpConversion,
+                               NGMinOpConversion,
+                               NGAbsOpConversion,
+                               NGNegOpConversion,
+                               NGReluOpConversion,
+                               NGExpOpConversion,
+                               NGLogOpConversion,
+                               NGSqrtOpConversion,
+                               NGTanhOpConversion,
+                               NGSumRedOpConversion,
+                               NGMaxRedOpConversion,
+                               NGBroadcastOpConversion,
+                               NGReshapeOpConversion,
+                               NGConcatOpConversion,
+                               NGSoftMaxOpConversion,
+                               NGConvolutionOpConversion,
+                               NGDotOpConversion,
+                               NGReturnOpConversion>::build(patterns, mlirContext, m_pass);
         }
 
     private:
@@ -79,20 +102,22 @@ namespace
         }
         void runOnModule() override;
         SmallVector<Value*, 4> buildOutputDefs(Operation* op, PatternRewriter& rewriter);
-
-    private:
+        /// Creates a temporary of the given type, which the compiled code receives as an
+        /// argument pointing into the scratch of the CompiledKernel
+        Value* createTempTensor(MemRefType type, PatternRewriter& rewriter);
         mlir::Function* getCallDecl(StringRef name,
                                     ArrayRef<Type> args,
                                     ArrayRef<Type> output,
                                     PatternRewriter& rewriter);
+
+    private:
         void findOutputValues();
         void processFakeInstrs();
-        Value* insertMemMgrDef(PatternRewriter* rewriter = nullptr);
 
     private:
         DialectLowerer m_dialectLowerer;
-        // Value holding mem manager passed pointer
-        SmallVector<Value*, 4> m_memMgrDefs;
+        // list of temporary values to add to func signature after the results
+        SmallVector<Value*, 4> m_tempValues;
 
         // list of results values to add to func signature
         SmallVector<Value*, 4> m_loweredOutputValues;
@@ -141,20 +166,6 @@ namespace
         m_loweredOutputValues.resize(outputCount, nullptr);
     }
 
-    /// Inserts a fake def for Mem Mgr pointer at converted func start
-    Value* DialectLoweringPass::insertMemMgrDef(PatternRewriter* rewriter)
-    {
-        // it would be nice to insert one fake def at the start of the new func
-        // however, due to how DialectConversion framework works, new func is only
-        // materialized after conversion is done (rewriter->getFunction, or even rewriter->getInsertionBlock()->getFunction()
-        // will give you the original func). This makes it very convoluted to insert instructions at entry block.
-        auto op = rewriter->create<NGFakeInputOp>(rewriter->getUnknownLoc(),
-                                                  IndexType::get(getModule().getContext()));
-        // will be fixed later to read passed arg instead.
-        m_memMgrDefs.push_back(op.getResult());
-        return op.getResult();
-    }
-
     SmallVector<Value*, 4> DialectLoweringPass::buildOutputDefs(Operation* op,
                                                                 PatternRewriter& rewriter)
     {
@@ -179,25 +190,30 @@ namespace
             else
             {
                 auto tensorType = origResult->getType().cast<NGTensorType>();
-                auto callBackFunc = getCallDecl("__mlir_allocate",
-                                                {rewriter.getIndexType(), rewriter.getIndexType()},
-                                                {m_dialectLowerer.convertType(tensorType)},
-                                                rewriter);
-
-                auto size = tensorType.getSizeInBytes();
-                SmallVector<mlir::Value*, 4> args = {
-                    insertMemMgrDef(&rewriter), /* pointer to mem manager */
-                    rewriter.create<mlir::ConstantIndexOp>(rewriter.getUnknownLoc(),
-                                                           size)}; /* size to allocate */
-                auto newResult =
-                    rewriter.create<mlir::CallOp>(rewriter.getUnknownLoc(), callBackFunc, args)
-                        .getResult(0);
-                newResults.push_back(newResult);
+                auto memRefType = m_dialectLowerer.convertType(tensorType).cast<MemRefType>();
+                newResults.push_back(createTempTensor(memRefType, rewriter));
             }
         }
         return newResults;
     }
 
+    Value* DialectLoweringPass::createTempTensor(MemRefType type, PatternRewriter& rewriter)
+    {
+        uint64_t size = llvm::divideCeil(type.getElementType().getIntOrFloatBitWidth(), 8);
+        for (auto dim : type.getShape())
+        {
+            size *= dim;
+        }
+        m_compiler.allocate_temp(size);
+
+        // Like outputs, temporaries are defined by fake instructions until the new func is
+        // materialized, and are replaced with arguments later.
+        auto fakeOp = rewriter.create<NGFakeInputOp>(rewriter.getUnknownLoc(), type);
+        fakeOp.verify();
+        m_tempValues.push_back(fakeOp.getResult());
+        return fakeOp.getResult();
+    }
+
     void DialectLoweringPass::processFakeInstrs()
     {
         auto context = getModule().getContext();
@@ -219,10 +235,12 @@ namespace
             // add new value for result
             entryBlock->addArgument(type);
         }
-        // Mem Manager Ptr
-        auto indexType = mlir::IndexType::get(context);
-        allArgs.push_back(indexType);
-        entryBlock->addArgument(indexType);
+        // Temporaries, in the order their scratch offsets were allocated in
+        for (auto value : m_tempValues)
+        {
+            allArgs.push_back(value->getType());
+            entryBlock->addArgument(value->getType());
+        }
         // update type
         auto newFuncType = mlir::FunctionType::get(allArgs, {}, context);
         f->setType(newFuncType);
@@ -237,10 +255,13 @@ namespace
             op->erase();
             i++;
         }
-        for (auto v : m_memMgrDefs)
+        // RAUW fake temporaries with their arguments
+        for (auto value : m_tempValues)
         {
-            v->replaceAllUsesWith(entryBlock->getArgument(m_compiler.get_mem_mgr_arg_id(f)));
-            v->getDefiningOp()->erase();
+            auto op = value->getDefiningOp();
+            value->replaceAllUsesWith(entryBlock->getArgument(oldFuncType.getNumInputs() + i));
+            op->erase();
+            i++;
         }
     }
 
@@ -293,46 +314,556 @@ namespace
         return type;
     }
 
+    // Helpers shared by the op lowerers
+
+    /// Builds a loop nest over all the elements of view, binding the induction variables to
+    /// ivs, which must be empty since value handles can only be bound once. A rank-0 view has
+    /// a single element, so body is emitted without loops.
+    void buildLoopNest(MemRefView& view,
+                       SmallVector<IndexHandle, 8>& ivs,
+                       std::function<void(void)> body)
+    {
+        NGRAPH_CHECK(ivs.empty(), "Induction variables are already bound");
+        ivs.resize(view.rank());
+        if (ivs.empty())
+        {
+            body();
+            return;
+        }
+        auto pivs = IndexHandle::makeIndexHandlePointers(ivs);
+        LoopNestBuilder(pivs, view.getLbs(), view.getUbs(), view.getSteps())(body);
+    }
+
+    /// Reads an array attribute of integers, e.g. axes or strides.
+    SmallVector<int64_t, 4> getIntegers(ArrayAttr attr)
+    {
+        SmallVector<int64_t, 4> values;
+        for (auto value : attr.getValue())
+        {
+            values.push_back(value.cast<IntegerAttr>().getInt());
+        }
+        return values;
+    }
+
+    /// Marks the axes in attr out of rank axes.
+    SmallVector<bool, 4> getAxisMask(ArrayAttr attr, unsigned rank)
+    {
+        SmallVector<bool, 4> mask(rank, false);
+        for (auto axis : getIntegers(attr))
+        {
+            mask[axis] = true;
+        }
+        return mask;
+    }
+
+    /// Returns the induction variables that are not marked in mask.
+    SmallVector<IndexHandle, 8> dropAxes(ArrayRef<IndexHandle> ivs, ArrayRef<bool> mask)
+    {
+        SmallVector<IndexHandle, 8> kept;
+        for (unsigned i = 0; i < ivs.size(); i++)
+        {
+            if (!mask[i])
+            {
+                kept.push_back(ivs[i]);
+            }
+        }
+        return kept;
+    }
+
+    ValueHandle createConstant(Type type, Attribute value)
+    {
+        return ValueHandle::create<ConstantOp>(type, value);
+    }
+
+    /// lhs > rhs, for floats or signed integers.
+    ValueHandle createGreaterThan(ValueHandle lhs, ValueHandle rhs)
+    {
+        if (lhs.getType().isa<FloatType>())
+        {
+            return ValueHandle::create<CmpFOp>(CmpFPredicate::OGT, lhs, rhs);
+        }
+        return ValueHandle::create<CmpIOp>(CmpIPredicate::SGT, lhs, rhs);
+    }
+
+    ValueHandle createMax(ValueHandle lhs, ValueHandle rhs)
+    {
+        return intrinsics::select(createGreaterThan(lhs, rhs), lhs, rhs);
+    }
+
+    ValueHandle createMin(ValueHandle lhs, ValueHandle rhs)
+    {
+        return intrinsics::select(createGreaterThan(lhs, rhs), rhs, lhs);
+    }
+
+    /// Calls the C math library function name, e.g. expf for f32.
+    ValueHandle createMathCall(DialectLoweringPass& pass,
+                               PatternRewriter& rewriter,
+                               StringRef name,
+                               ValueHandle arg)
+    {
+        Type type = arg.getType();
+        NGRAPH_CHECK(type.isF32() || type.isF64(), "Unsupported type for ", name.str());
+        std::string function = type.isF32() ? name.str() + "f" : name.str();
+        auto callee = pass.getCallDecl(function, {type}, {type}, rewriter);
+        SmallVector<Value*, 1> args{arg.getValue()};
+        return ValueHandle::create<CallOp>(callee, args);
+    }
+
+    /// Lowers an elementwise op to a loop nest that stores compute(operand elements) into each
+    /// element of the result.
+    void lowerElementwise(Operation* op,
+                          ArrayRef<Value*> operands,
+                          PatternRewriter& rewriter,
+                          DialectLoweringPass& pass,
+                          std::function<ValueHandle(ArrayRef<ValueHandle>)> compute)
+    {
+        auto loc = op->getLoc();
+        auto result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(result->getType().isa<MemRefType>());
+        // Note that builder's current function is still the original function body.
+        // use getBlock to get the new block instead.
+
+        ScopedContext scope(rewriter, loc);
+        MemRefView vRes(result);
+        IndexedValue iRes(result);
+        SmallVector<IndexedValue, 2> iArgs;
+        for (auto operand : operands)
+        {
+            iArgs.push_back(IndexedValue(operand));
+        }
+        SmallVector<IndexHandle, 8> ivs;
+        buildLoopNest(vRes, ivs, [&] {
+            SmallVector<ValueHandle, 2> args;
+            for (auto& iArg : iArgs)
+            {
+                args.push_back(iArg(ivs));
+            }
+            iRes(ivs) = compute(args);
+        });
+        rewriter.replaceOp(op, {result});
+    }
+
+    /// Lowers an axis reduction to a loop nest that initializes the result to init, followed by
+    /// one over the operand that accumulates each element into the result with combine.
+    void lowerReduction(Operation* op,
+                        ArrayRef<Value*> operands,
+                        PatternRewriter& rewriter,
+                        DialectLoweringPass& pass,
+                        ArrayAttr axes,
+                        Attribute init,
+                        std::function<ValueHandle(ValueHandle, ValueHandle)> combine)
+    {
+        auto loc = op->getLoc();
+        auto result = pass.buildOutputDefs(op, rewriter)[0];
+        Value* arg = operands[0];
+        Type elemTy = result->getType().cast<MemRefType>().getElementType();
+
+        ScopedContext scope(rewriter, loc);
+        MemRefView vRes(result), vArg(arg);
+        IndexedValue iRes(result), iArg(arg);
+        ValueHandle initValue = createConstant(elemTy, init);
+        SmallVector<bool, 4> reduced = getAxisMask(axes, vArg.rank());
+
+        SmallVector<IndexHandle, 8> resIvs;
+        buildLoopNest(vRes, resIvs, [&] { iRes(resIvs) = initValue; });
+        SmallVector<IndexHandle, 8> argIvs;
+        buildLoopNest(vArg, argIvs, [&] {
+            auto outIvs = dropAxes(argIvs, reduced);
+            iRes(outIvs) = combine(iRes(outIvs), iArg(argIvs));
+        });
+        rewriter.replaceOp(op, {result});
+    }
+
+    Attribute getLowestAttr(PatternRewriter& rewriter, Type type)
+    {
+        NGRAPH_CHECK(type.isa<FloatType>(), "Max reduction is only supported for floats");
+        return rewriter.getFloatAttr(type, -std::numeric_limits<double>::infinity());
+    }
+
 #define REWRITER(OP)                                                                               \
     void OP##Conversion::rewrite(                                                                  \
         Operation* op, ArrayRef<Value*> operands, PatternRewriter& rewriter) const
 
-    // ADD
+    // Elementwise binary ops
     REWRITER(NGAddOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [](ArrayRef<ValueHandle> args) {
+            return args[0] + args[1];
+        });
+    }
 
+    REWRITER(NGSubOp)
     {
-        auto add = cast<NGAddOp>(op);
-        auto loc = add.getLoc();
+        lowerElementwise(op, operands, rewriter, m_pass, [](ArrayRef<ValueHandle> args) {
+            return args[0] - args[1];
+        });
+    }
 
+    REWRITER(NGMulOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [](ArrayRef<ValueHandle> args) {
+            return args[0] * args[1];
+        });
+    }
+
+    REWRITER(NGDivOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [](ArrayRef<ValueHandle> args) {
+            return args[0] / args[1];
+        });
+    }
+
+    REWRITER(NGMaxOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [](ArrayRef<ValueHandle> args) {
+            return createMax(args[0], args[1]);
+        });
+    }
+
+    REWRITER(NGMinOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [](ArrayRef<ValueHandle> args) {
+            return createMin(args[0], args[1]);
+        });
+    }
+
+    // Elementwise unary ops
+    REWRITER(NGAbsOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [&](ArrayRef<ValueHandle> args) {
+            ValueHandle zero = createConstant(args[0].getType(),
+                                              rewriter.getZeroAttr(args[0].getType()));
+            return createMax(args[0], zero - args[0]);
+        });
+    }
+
+    REWRITER(NGNegOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [&](ArrayRef<ValueHandle> args) {
+            ValueHandle zero = createConstant(args[0].getType(),
+                                              rewriter.getZeroAttr(args[0].getType()));
+            return zero - args[0];
+        });
+    }
+
+    REWRITER(NGReluOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [&](ArrayRef<ValueHandle> args) {
+            ValueHandle zero = createConstant(args[0].getType(),
+                                              rewriter.getZeroAttr(args[0].getType()));
+            return createMax(args[0], zero);
+        });
+    }
+
+    REWRITER(NGExpOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [&](ArrayRef<ValueHandle> args) {
+            return createMathCall(m_pass, rewriter, "exp", args[0]);
+        });
+    }
+
+    REWRITER(NGLogOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [&](ArrayRef<ValueHandle> args) {
+            return createMathCall(m_pass, rewriter, "log", args[0]);
+        });
+    }
+
+    REWRITER(NGSqrtOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [&](ArrayRef<ValueHandle> args) {
+            return createMathCall(m_pass, rewriter, "sqrt", args[0]);
+        });
+    }
+
+    REWRITER(NGTanhOp)
+    {
+        lowerElementwise(op, operands, rewriter, m_pass, [&](ArrayRef<ValueHandle> args) {
+            return createMathCall(m_pass, rewriter, "tanh", args[0]);
+        });
+    }
+
+    // Reductions
+    REWRITER(NGSumRedOp)
+    {
+        auto sum = cast<NGSumRedOp>(op);
+        Type elemTy = operands[0]->getType().cast<MemRefType>().getElementType();
+        lowerReduction(op,
+                       operands,
+                       rewriter,
+                       m_pass,
+                       sum.axes(),
+                       rewriter.getZeroAttr(elemTy),
+                       [](ValueHandle acc, ValueHandle value) { return acc + value; });
+    }
+
+    REWRITER(NGMaxRedOp)
+    {
+        auto max = cast<NGMaxRedOp>(op);
+        Type elemTy = operands[0]->getType().cast<MemRefType>().getElementType();
+        lowerReduction(op,
+                       operands,
+                       rewriter,
+                       m_pass,
+                       max.axes(),
+                       getLowestAttr(rewriter, elemTy),
+                       [](ValueHandle acc, ValueHandle value) { return createMax(value, acc); });
+    }
+
+    // Data movement
+    REWRITER(NGBroadcastOp)
+    {
+        auto broadcast = cast<NGBroadcastOp>(op);
+        auto loc = broadcast.getLoc();
         auto result = m_pass.buildOutputDefs(op, rewriter)[0];
-        NGRAPH_CHECK(result->getType().isa<MemRefType>());
-        // Note that builder's current function is still the original function body.
-        // use getBlock to get the new block instead.
+        Value* arg = operands[0];
 
-        // get new operands
-        Value* lhs = operands[0];
-        Value* rhs = operands[1];
+        ScopedContext scope(rewriter, loc);
+        MemRefView vRes(result);
+        IndexedValue iRes(result), iArg(arg);
+        // The argument is indexed by the result axes that are not broadcast axes
+        SmallVector<bool, 4> broadcastAxes = getAxisMask(broadcast.axes(), vRes.rank());
+        SmallVector<IndexHandle, 8> ivs;
+        buildLoopNest(vRes, ivs, [&] { iRes(ivs) = iArg(dropAxes(ivs, broadcastAxes)); });
+        rewriter.replaceOp(op, {result});
+    }
+
+    REWRITER(NGReshapeOp)
+    {
+        auto reshape = cast<NGReshapeOp>(op);
+        auto loc = reshape.getLoc();
+        auto result = m_pass.buildOutputDefs(op, rewriter)[0];
+        Value* arg = operands[0];
+        auto resShape = result->getType().cast<MemRefType>().getShape();
+        auto argShape = arg->getType().cast<MemRefType>().getShape();
+        auto axisOrder = getIntegers(reshape.axisOrder());
+
+        // The result holds the elements of the argument transposed by axisOrder, in row-major
+        // order. The row-major position of a result element is delinearized into an index of
+        // the transposed argument, whose axes are then put back in argument order.
+        SmallVector<int64_t, 4> resStrides(resShape.size(), 1);
+        for (int i = static_cast<int>(resShape.size()) - 2; i >= 0; i--)
+        {
+            resStrides[i] = resStrides[i + 1] * resShape[i + 1];
+        }
+        SmallVector<int64_t, 4> transposedShape, transposedStrides(axisOrder.size(), 1);
+        for (auto axis : axisOrder)
+        {
+            transposedShape.push_back(argShape[axis]);
+        }
+        for (int i = static_cast<int>(axisOrder.size()) - 2; i >= 0; i--)
+        {
+            transposedStrides[i] = transposedStrides[i + 1] * transposedShape[i + 1];
+        }
 
         ScopedContext scope(rewriter, loc);
-        // Views
-        MemRefView vRes(result), vLHS(lhs), vRHS(rhs);
-        // Index Values
-        IndexedValue iRes(result), iLHS(lhs), iRHS(rhs);
-        // Bounds Index Handles
-        auto lbs = vLHS.getLbs();
-        auto ubs = vLHS.getUbs();
-        // Loop induction vars
-        auto ivs = IndexHandle::makeIndexHandles(vLHS.rank());
-        auto pivs = IndexHandle::makeIndexHandlePointers(ivs);
-        // Steps
-        auto steps = vLHS.getSteps();
-        // clang-format off
-        LoopNestBuilder(pivs, lbs, ubs, steps)( 
-            // single stmt body
-            [&] {
-                    iRes(ivs) = iLHS(ivs) + iRHS(ivs);
-                });
-        // clang-format on
+        MemRefView vRes(result);
+        IndexedValue iRes(result), iArg(arg);
+        SmallVector<IndexHandle, 8> ivs;
+        buildLoopNest(vRes, ivs, [&] {
+            SmallVector<ValueHandle, 8> positions{intrinsics::constant_index(0)};
+            for (unsigned i = 0; i < ivs.size(); i++)
+            {
+                positions.push_back(positions.back() +
+                                    ivs[i] * intrinsics::constant_index(resStrides[i]));
+            }
+            ValueHandle position = positions.back();
+            SmallVector<IndexHandle, 8> argIvs(argShape.size(), IndexHandle());
+            for (unsigned i = 0; i < axisOrder.size(); i++)
+            {
+                ValueHandle index =
+                    floorDiv(position, intrinsics::constant_index(transposedStrides[i])) %
+                    intrinsics::constant_index(transposedShape[i]);
+                argIvs[axisOrder[i]] = IndexHandle(index);
+            }
+            iRes(ivs) = iArg(argIvs);
+        });
+        rewriter.replaceOp(op, {result});
+    }
+
+    REWRITER(NGConcatOp)
+    {
+        auto concat = cast<NGConcatOp>(op);
+        auto loc = concat.getLoc();
+        auto result = m_pass.buildOutputDefs(op, rewriter)[0];
+        int64_t axis = concat.concatenationAxis().getSExtValue();
+
+        ScopedContext scope(rewriter, loc);
+        IndexedValue iRes(result);
+        // Each operand is copied into the result, after the ones before it along axis
+        int64_t offset = 0;
+        for (auto operand : operands)
+        {
+            MemRefView vArg(operand);
+            IndexedValue iArg(operand);
+            SmallVector<IndexHandle, 8> ivs;
+            buildLoopNest(vArg, ivs, [&] {
+                SmallVector<IndexHandle, 8> resIvs;
+                for (unsigned i = 0; i < ivs.size(); i++)
+                {
+                    if (static_cast<int64_t>(i) == axis)
+                    {
+                        resIvs.push_back(
+                            IndexHandle(ivs[i] + intrinsics::constant_index(offset)));
+                    }
+                    else
+                    {
+                        resIvs.push_back(ivs[i]);
+                    }
+                }
+                iRes(resIvs) = iArg(ivs);
+            });
+            offset += operand->getType().cast<MemRefType>().getShape()[axis];
+        }
+        rewriter.replaceOp(op, {result});
+    }
+
+    REWRITER(NGSoftMaxOp)
+    {
+        auto softmax = cast<NGSoftMaxOp>(op);
+        auto loc = softmax.getLoc();
+        auto result = m_pass.buildOutputDefs(op, rewriter)[0];
+        Value* arg = operands[0];
+        auto argType = arg->getType().cast<MemRefType>();
+        Type elemTy = argType.getElementType();
+        SmallVector<bool, 4> axes = getAxisMask(softmax.axes(), argType.getRank());
+
+        // Maximum and sum over the softmax axes
+        SmallVector<int64_t, 4> reducedShape;
+        for (unsigned i = 0; i < axes.size(); i++)
+        {
+            if (!axes[i])
+            {
+                reducedShape.push_back(argType.getShape()[i]);
+            }
+        }
+        auto reducedType = MemRefType::get(reducedShape, elemTy, {/* no map used */}, 0);
+        Value* max = m_pass.createTempTensor(reducedType, rewriter);
+        Value* sum = m_pass.createTempTensor(reducedType, rewriter);
+
+        ScopedContext scope(rewriter, loc);
+        MemRefView vArg(arg), vReduced(max);
+        IndexedValue iRes(result), iArg(arg), iMax(max), iSum(sum);
+        ValueHandle lowest = createConstant(elemTy, getLowestAttr(rewriter, elemTy));
+        ValueHandle zero = createConstant(elemTy, rewriter.getZeroAttr(elemTy));
+
+        // res = exp(arg - max) / sum(exp(arg - max)), where subtracting the maximum keeps exp
+        // from overflowing
+        SmallVector<IndexHandle, 8> reducedIvs, maxIvs, expIvs, divIvs;
+        buildLoopNest(vReduced, reducedIvs, [&] {
+            iMax(reducedIvs) = lowest;
+            iSum(reducedIvs) = zero;
+        });
+        buildLoopNest(vArg, maxIvs, [&] {
+            auto outIvs = dropAxes(maxIvs, axes);
+            iMax(outIvs) = createMax(iArg(maxIvs), iMax(outIvs));
+        });
+        buildLoopNest(vArg, expIvs, [&] {
+            auto outIvs = dropAxes(expIvs, axes);
+            ValueHandle value = createMathCall(
+                m_pass, rewriter, "exp", iArg(expIvs) - ValueHandle(iMax(outIvs)));
+            iRes(expIvs) = value;
+            iSum(outIvs) += value;
+        });
+        buildLoopNest(vArg, divIvs, [&] {
+            auto outIvs = dropAxes(divIvs, axes);
+            iRes(divIvs) = iRes(divIvs) / ValueHandle(iSum(outIvs));
+        });
+        rewriter.replaceOp(op, {result});
+    }
+
+    REWRITER(NGConvolutionOp)
+    {
+        auto convolution = cast<NGConvolutionOp>(op);
+        auto loc = convolution.getLoc();
+        auto result = m_pass.buildOutputDefs(op, rewriter)[0];
+        Value* images = operands[0];
+        Value* filters = operands[1];
+        auto imagesType = images->getType().cast<MemRefType>();
+        auto filtersShape = filters->getType().cast<MemRefType>().getShape();
+        Type elemTy = result->getType().cast<MemRefType>().getElementType();
+        auto strides = getIntegers(convolution.strides());
+        auto dilations = getIntegers(convolution.dilations());
+        auto padBelow = getIntegers(convolution.padBelow());
+        auto padAbove = getIntegers(convolution.padAbove());
+        unsigned spatialRank = strides.size();
+
+        ScopedContext scope(rewriter, loc);
+        ValueHandle zero = createConstant(elemTy, rewriter.getZeroAttr(elemTy));
+
+        // A padded convolution reads a zero-filled copy of the images with the padding
+        // included, which keeps bounds checks out of the convolution loop nest:
+        //   for n, c, j...
+        //     padded[n, c, j...] = 0
+        //   for n, c, j...
+        //     padded[n, c, j + padBelow...] = images[n, c, j...]
+        bool padded = false;
+        SmallVector<int64_t, 8> paddedShape(imagesType.getShape().begin(),
+                                            imagesType.getShape().end());
+        for (unsigned i = 0; i < spatialRank; i++)
+        {
+            NGRAPH_CHECK(padBelow[i] >= 0 && padAbove[i] >= 0,
+                         "Negative convolution padding is not supported");
+            paddedShape[i + 2] += padBelow[i] + padAbove[i];
+            padded = padded || padBelow[i] != 0 || padAbove[i] != 0;
+        }
+        if (padded)
+        {
+            Value* paddedImages = m_pass.createTempTensor(
+                MemRefType::get(paddedShape, elemTy, {/* no map used */}, 0), rewriter);
+            MemRefView vImages(images), vPadded(paddedImages);
+            IndexedValue iImages(images), iPadded(paddedImages);
+            SmallVector<IndexHandle, 8> fillIvs, copyIvs;
+            buildLoopNest(vPadded, fillIvs, [&] { iPadded(fillIvs) = zero; });
+            buildLoopNest(vImages, copyIvs, [&] {
+                SmallVector<IndexHandle, 8> paddedIdx{copyIvs[0], copyIvs[1]};
+                for (unsigned i = 0; i < spatialRank; i++)
+                {
+                    paddedIdx.push_back(
+                        IndexHandle(copyIvs[i + 2] + intrinsics::constant_index(padBelow[i])));
+                }
+                iPadded(paddedIdx) = iImages(copyIvs);
+            });
+            images = paddedImages;
+        }
+
+        // Create the following loop nest, where i is the spatial index of an output element
+        // and k the spatial index of a filter element:
+        //   for n, o, i...
+        //     res[n, o, i...] = 0
+        //     for c, k...
+        //       res[n, o, i...] +=
+        //           images[n, c, i * stride + k * dilation...] * filters[o, c, k...]
+        MemRefView vRes(result);
+        IndexedValue iRes(result), iImages(images), iFilters(filters);
+
+        SmallVector<IndexHandle, 8> resIvs;
+        buildLoopNest(vRes, resIvs, [&] {
+            iRes(resIvs) = zero;
+            // Loops over the input channel and the filter's spatial axes
+            auto filterIvs = IndexHandle::makeIndexHandles(spatialRank + 1);
+            auto pFilterIvs = IndexHandle::makeIndexHandlePointers(filterIvs);
+            SmallVector<ValueHandle, 8> lbs, ubs;
+            SmallVector<int64_t, 8> steps;
+            for (unsigned i = 0; i < spatialRank + 1; i++)
+            {
+                lbs.push_back(intrinsics::constant_index(0));
+                ubs.push_back(intrinsics::constant_index(filtersShape[i + 1]));
+                steps.push_back(1);
+            }
+            LoopNestBuilder(pFilterIvs, lbs, ubs, steps)([&] {
+                SmallVector<IndexHandle, 8> imageIdx{resIvs[0], filterIvs[0]};
+                SmallVector<IndexHandle, 8> filterIdx{resIvs[1], filterIvs[0]};
+                for (unsigned i = 0; i < spatialRank; i++)
+                {
+                    imageIdx.push_back(IndexHandle(
+                        resIvs[i + 2] * intrinsics::constant_index(strides[i]) +
+                        filterIvs[i + 1] * intrinsics::constant_index(dilations[i])));
+                    filterIdx.push_back(filterIvs[i + 1]);
+                }
+                iRes(resIvs) += iImages(imageIdx) * iFilters(filterIdx);
+            });
+        });
         rewriter.replaceOp(op, {result});
     }
 
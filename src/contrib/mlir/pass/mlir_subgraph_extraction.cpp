@@ -15,12 +15,32 @@
 //*****************************************************************************
 
 #include "mlir_subgraph_extraction.hpp"
+#include "contrib/mlir/compiler.hpp"
 #include "ngraph/assertion.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/compiled_kernel.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
 
 using namespace ngraph::descriptor;
 using namespace ngraph::op;
@@ -58,12 +78,25 @@ bool MLIRSubgraphExtractionPass::run_on_function(std::shared_ptr<Function> func)
         return false;
     }
 
-    auto ck = std::make_shared<CompiledKernel>(ck_ops, ck_outputs, ck_args);
+    // Temporaries of the compiled code are planned by the backend as the kernel's scratch.
+    auto ck = std::make_shared<CompiledKernel>(
+        ck_ops,
+        ck_outputs,
+        ck_args,
+        ngraph::runtime::ngmlir::MLIRCompiler::get_scratch_size(ck_ops, ck_outputs));
 
     // Connect CompiledKernel to output nodes by replacing the output descriptors of the output
-    // nodes.
+    // nodes. A kernel with a scratch has several outputs, which are used through
+    // GetOutputElement so that the function can still be cloned. The GetOutputElement is the last
+    // user of the scratch, so the scratch is free again once it has run.
     for (size_t i = 0, end = ck_outputs.size(); i < end; ++i)
     {
+        std::shared_ptr<Node> ck_output = ck;
+        if (ck->get_output_size() > 1)
+        {
+            ck_output = std::make_shared<GetOutputElement>(ck, i);
+        }
+
         auto& output_descs = ck_outputs[i]->get_outputs();
         NGRAPH_CHECK(output_descs.size() == 1, "Unexpected multiple output descriptors");
         auto& out_desc = output_descs[0];
@@ -73,7 +106,7 @@ bool MLIRSubgraphExtractionPass::run_on_function(std::shared_ptr<Function> func)
 
         for (descriptor::Input* in_desc : input_descs)
         {
-            in_desc->replace_output(ck, i);
+            in_desc->replace_output(ck_output, ck_output == ck ? i : 0);
         }
     }
 
@@ -105,6 +138,47 @@ bool MLIRSubgraphExtractionPass::is_supported_mlir_op(std::shared_ptr<Node> node
             return false;
         }
     }
+
+    // Math functions are called from the C library, and Max starts from -infinity, so these
+    // are lowered for floats only
+    static const std::set<std::type_index> float_only_ops{TI(ngraph::op::Exp),
+                                                          TI(ngraph::op::Log),
+                                                          TI(ngraph::op::Max),
+                                                          TI(ngraph::op::Softmax),
+                                                          TI(ngraph::op::Sqrt),
+                                                          TI(ngraph::op::Tanh)};
+    if (float_only_ops.find(TI(*node)) != float_only_ops.end() &&
+        node->get_element_type() != element::f32 && node->get_element_type() != element::f64)
+    {
+        return false;
+    }
+
+    // Convolution without negative padding or data dilation
+    if (TI(ngraph::op::Convolution) == TI(*node))
+    {
+        auto conv = std::static_pointer_cast<ngraph::op::Convolution>(node);
+        for (auto pad : conv->get_padding_below())
+        {
+            if (pad < 0)
+            {
+                return false;
+            }
+        }
+        for (auto pad : conv->get_padding_above())
+        {
+            if (pad < 0)
+            {
+                return false;
+            }
+        }
+        for (auto dilation : conv->get_data_dilation_strides())
+        {
+            if (dilation != 1)
+            {
+                return false;
+            }
+        }
+    }
     return true;
 }
 
@@ -25,12 +25,16 @@
 #include "ngraph/node.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/replace_slice.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/scatter_add.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/strides.hpp"
+#include "ngraph/util.hpp"
 
 using namespace ngraph;
 
@@ -119,6 +123,7 @@ autodiff::Adjoints::Adjoints(const NodeVector& ys, const NodeVector& cs)
         NodeVector t{cs.at(i)};
         std::pair<Node*, NodeVector> pair = std::make_pair(n, t);
         m_adjoint_map.insert(std::make_pair(ys.at(i).get(), NodeVector{cs.at(i)}));
+        m_dense_delta_nodes.insert(ys.at(i).get());
     }
 
     nodes_to_check.assign(ys.cbegin(), ys.cend());
@@ -147,6 +152,16 @@ const NodeVector& autodiff::Adjoints::get(const std::shared_ptr<Node>& x)
     {
         adjoint_it = m_adjoint_map.insert({x.get(), make_zeros(x)}).first;
     }
+    auto sparse_it = m_sparse_adjoint_map.find(x.get());
+    if (m_sparse_adjoint_map.end() != sparse_it && m_sparse_folded_nodes.insert(x.get()).second)
+    {
+        auto& deltas = adjoint_it->second;
+        for (auto& sparse_delta : sparse_it->second)
+        {
+            deltas.at(0) = std::make_shared<op::ScatterAdd>(
+                deltas.at(0), sparse_delta.first, sparse_delta.second);
+        }
+    }
     return adjoint_it->second;
 }
 
@@ -154,6 +169,7 @@ void autodiff::Adjoints::add_delta(const std::shared_ptr<Node>& x,
                                    const std::shared_ptr<Node>& delta,
                                    size_t output_index)
 {
+    m_dense_delta_nodes.insert(x.get());
     auto adjoint_it = m_adjoint_map.find(x.get());
     if (m_adjoint_map.end() == adjoint_it)
     {
@@ -184,6 +200,7 @@ void autodiff::Adjoints::add_delta_to_slice(const std::shared_ptr<Node>& x,
             "Autodiff internal error: Mismatch on backprop and op in add_delta_to_slice.");
     }
 
+    m_dense_delta_nodes.insert(x.get());
     auto adjoint_it = m_adjoint_map.find(x.get());
     if (m_adjoint_map.end() == adjoint_it)
     {
@@ -204,6 +221,27 @@ void autodiff::Adjoints::add_delta_to_slice(const std::shared_ptr<Node>& x,
     }
 }
 
+void autodiff::Adjoints::add_sparse_delta(const std::shared_ptr<Node>& x,
+                                          const std::shared_ptr<Node>& indices,
+                                          const std::shared_ptr<Node>& values)
+{
+    auto indices_et = indices->get_output_element_type(0);
+    if (x->get_output_size() > 1 || (indices_et != element::i32 && indices_et != element::i64) ||
+        !x->get_output_element_type(0).compatible(values->get_output_element_type(0)))
+    {
+        throw ngraph_error(
+            "Autodiff internal error: Mismatch on backprop and op in add_sparse_delta.");
+    }
+
+    // The dense adjoint has already been handed out, so keep it up to date as well
+    if (m_sparse_folded_nodes.count(x.get()) != 0)
+    {
+        auto& deltas = m_adjoint_map.at(x.get());
+        deltas.at(0) = std::make_shared<op::ScatterAdd>(deltas.at(0), indices, values);
+    }
+    m_sparse_adjoint_map[x.get()].push_back({indices, values});
+}
+
 std::shared_ptr<Node> autodiff::Adjoints::backprop_node(const std::shared_ptr<Node>& x)
 {
     auto deltas = get(x);
@@ -213,3 +251,60 @@ std::shared_ptr<Node> autodiff::Adjoints::backprop_node(const std::shared_ptr<No
     }
     return deltas.at(0);
 }
+
+std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>>
+    autodiff::Adjoints::backprop_sparse_node(const std::shared_ptr<Node>& x)
+{
+    auto sparse_it = m_sparse_adjoint_map.find(x.get());
+    if (m_sparse_adjoint_map.end() == sparse_it)
+    {
+        throw ngraph_error("backprop_sparse_node is called for a node without sparse adjoints");
+    }
+    if (m_dense_delta_nodes.count(x.get()) != 0)
+    {
+        throw ngraph_error("backprop_sparse_node is called for a node with dense adjoints");
+    }
+
+    // Indices of all contributions are flattened into one vector and the values into the
+    // matching rows; mixed index types are widened to i64.
+    auto& sparse_deltas = sparse_it->second;
+    element::Type indices_et = sparse_deltas.at(0).first->get_element_type();
+    for (auto& sparse_delta : sparse_deltas)
+    {
+        if (sparse_delta.first->get_element_type() != indices_et)
+        {
+            indices_et = element::i64;
+        }
+    }
+
+    Shape row_shape = x->get_shape();
+    NodeVector indices;
+    NodeVector values;
+    for (auto& sparse_delta : sparse_deltas)
+    {
+        std::shared_ptr<Node> index = sparse_delta.first;
+        std::shared_ptr<Node> value = sparse_delta.second;
+        size_t count = shape_size(index->get_shape());
+        if (index->get_element_type() != indices_et)
+        {
+            index = std::make_shared<op::Convert>(index, indices_et);
+        }
+        if (index->get_shape().size() != 1)
+        {
+            index = std::make_shared<op::Reshape>(
+                index, get_default_order(index->get_shape()), Shape{count});
+            row_shape.at(0) = count;
+            value = std::make_shared<op::Reshape>(
+                value, get_default_order(value->get_shape()), row_shape);
+        }
+        indices.push_back(index);
+        values.push_back(value);
+    }
+
+    if (indices.size() == 1)
+    {
+        return std::make_pair(indices.at(0), values.at(0));
+    }
+    return std::make_pair(std::make_shared<op::Concat>(indices, 0),
+                          std::make_shared<op::Concat>(values, 0));
+}
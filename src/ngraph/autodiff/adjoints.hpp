@@ -19,6 +19,9 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "ngraph/coordinate.hpp"
 #include "ngraph/strides.hpp"
@@ -73,10 +76,37 @@ namespace ngraph
                                     const Coordinate& upper_bounds,
                                     const Strides& strides);
 
+            /// \brief Add a backprop contribution to some rows of x's adjoint
+            ///
+            /// The contribution is kept as an (indices, values) pair, so that consumers of
+            /// backprop_sparse_node never materialize a tensor the size of x. It is folded into
+            /// the dense adjoint with a ScatterAdd only if the dense adjoint is requested.
+            ///
+            /// \param x The adjoint node
+            /// \param indices Rows of x (along axis 0) to add to, `element::i32` or `element::i64`
+            /// \param values One row per index, with shape indices.shape + x.shape[1:]
+            void add_sparse_delta(const std::shared_ptr<Node>& x,
+                                  const std::shared_ptr<Node>& indices,
+                                  const std::shared_ptr<Node>& values);
+
             std::shared_ptr<Node> backprop_node(const std::shared_ptr<Node>& x);
 
+            /// \brief The adjoint of x as an (indices, values) pair: indices is a vector of N
+            ///     rows of x, which may repeat, and values has shape [N] + x.shape[1:]. Adding
+            ///     each row of values to x with ScatterAdd applies the whole adjoint.
+            ///
+            /// Throws if x has no sparse contributions, or also has dense ones.
+            std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>>
+                backprop_sparse_node(const std::shared_ptr<Node>& x);
+
         protected:
             std::map<Node*, NodeVector> m_adjoint_map;
+            std::map<Node*, std::vector<std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>>>>
+                m_sparse_adjoint_map;
+            // Nodes with dense contributions, and nodes whose sparse contributions are already
+            // part of their dense adjoint
+            std::unordered_set<Node*> m_dense_delta_nodes;
+            std::unordered_set<Node*> m_sparse_folded_nodes;
         };
     }
 }
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include <clang/Basic/DiagnosticOptions.h>
@@ -34,6 +35,7 @@
 #include <clang/Lex/Preprocessor.h>
 #include <clang/Lex/PreprocessorOptions.h>
 #include <llvm/ADT/Statistic.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/MCJIT.h> // forces JIT to link in
 #include <llvm/IR/Module.h>
 #include <llvm/LinkAllPasses.h>
@@ -147,6 +149,21 @@ std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& s
     return rc;
 }
 
+std::string codegen::Compiler::get_options() const
+{
+    // Keep in sync with the options set in CompilerCore::initialize
+    stringstream options;
+    options << "llvm=" << LLVM_VERSION_STRING << ";cpu=" << sys::getHostCPUName().str()
+            << ";O3;inline-threshold=1000000;EIGEN_MPL2_ONLY;debuginfo="
+            << (std::getenv("NGRAPH_COMPILER_DEBUGINFO_ENABLE") != nullptr);
+    for (const std::string& path : m_header_search_paths)
+    {
+        options << ";include=" << path;
+    }
+    options << ";pch=" << m_precompiled_header_source;
+    return options.str();
+}
+
 static std::string GetExecutablePath(const char* Argv0)
 {
     // This just needs to be some symbol in the binary; C++ doesn't
@@ -15,13 +15,91 @@
 //*****************************************************************************
 
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Object/ObjectFile.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/TargetSelect.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
 
 using namespace ngraph;
 
+// MCJIT runs the static constructors listed in a module, but not those of a loaded object.
+// The constructors of a module whose object is cached are renamed to these numbered names,
+// so they can be found and run when the object is loaded.
+static const std::string s_constructor_prefix = "__ngraph_static_constructor_";
+
+namespace
+{
+    // Stores the object MCJIT compiles for a module in a codegen::ObjectCache
+    class ObjectCacheWriter : public llvm::ObjectCache
+    {
+    public:
+        ObjectCacheWriter(const std::shared_ptr<codegen::ObjectCache>& cache,
+                          const std::string& key)
+            : m_cache(cache)
+            , m_key(key)
+        {
+        }
+
+        void notifyObjectCompiled(const llvm::Module* module,
+                                  llvm::MemoryBufferRef object) override
+        {
+            m_cache->store(m_key, object.getBufferStart(), object.getBufferSize());
+        }
+
+        std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override
+        {
+            return nullptr;
+        }
+
+    private:
+        std::shared_ptr<codegen::ObjectCache> m_cache;
+        std::string m_key;
+    };
+}
+
+static void expose_static_constructors(llvm::Module& module)
+{
+    llvm::GlobalVariable* constructors = module.getNamedGlobal("llvm.global_ctors");
+    if (!constructors || !constructors->hasInitializer())
+    {
+        return;
+    }
+    auto list = llvm::dyn_cast<llvm::ConstantArray>(constructors->getInitializer());
+    if (!list)
+    {
+        return;
+    }
+    // Same order as ExecutionEngine::runStaticConstructorsDestructors
+    size_t index = 0;
+    for (llvm::Use& entry : list->operands())
+    {
+        auto fields = llvm::dyn_cast<llvm::ConstantStruct>(entry.get());
+        if (!fields || fields->getNumOperands() < 2)
+        {
+            continue;
+        }
+        auto function =
+            llvm::dyn_cast<llvm::Function>(fields->getOperand(1)->stripPointerCasts());
+        if (!function || function->isDeclaration())
+        {
+            continue;
+        }
+        function->setLinkage(llvm::GlobalValue::ExternalLinkage);
+        function->setVisibility(llvm::GlobalValue::DefaultVisibility);
+        function->setName(s_constructor_prefix + std::to_string(index++));
+    }
+}
+
 codegen::ExecutionEngine::ExecutionEngine()
     : m_execution_engine{nullptr}
+    , m_object_loaded{false}
 {
 }
 
@@ -33,24 +111,37 @@ codegen::ExecutionEngine::~ExecutionEngine()
     }
 }
 
+bool codegen::ExecutionEngine::create_engine(std::unique_ptr<llvm::Module> module)
+{
+    m_execution_engine.reset(llvm::EngineBuilder(std::move(module))
+                                 .setEngineKind(llvm::EngineKind::JIT)
+                                 .setOptLevel(llvm::CodeGenOpt::Aggressive)
+                                 .setMCPU(llvm::sys::getHostCPUName())
+                                 //  .setCodeModel(llvm::CodeModel::Medium)
+                                 .setErrorStr(&m_jit_error)
+                                 .create());
+    return m_execution_engine != nullptr;
+}
+
 bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Module>& module)
 {
     if (module)
     {
         if (!m_execution_engine)
         {
-            m_execution_engine.reset(llvm::EngineBuilder(module->take_module())
-                                         .setEngineKind(llvm::EngineKind::JIT)
-                                         .setOptLevel(llvm::CodeGenOpt::Aggressive)
-                                         .setMCPU(llvm::sys::getHostCPUName())
-                                         //  .setCodeModel(llvm::CodeModel::Medium)
-                                         .setErrorStr(&m_jit_error)
-                                         .create());
-
-            if (!m_execution_engine)
+            std::unique_ptr<llvm::Module> llvm_module = module->take_module();
+            if (m_object_cache)
+            {
+                expose_static_constructors(*llvm_module);
+            }
+            if (!create_engine(std::move(llvm_module)))
             {
                 return false;
             }
+            if (m_object_cache)
+            {
+                m_execution_engine->setObjectCache(m_object_cache.get());
+            }
         }
     }
     else
@@ -61,12 +152,66 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
     return true;
 }
 
+bool codegen::ExecutionEngine::add_object(const std::vector<char>& object)
+{
+    if (m_execution_engine)
+    {
+        return false;
+    }
+
+    // Nothing has been compiled yet when a process starts by loading cached objects
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    llvm::InitializeNativeTargetAsmParser();
+
+    auto buffer =
+        llvm::MemoryBuffer::getMemBufferCopy(llvm::StringRef(object.data(), object.size()));
+    auto object_file = llvm::object::ObjectFile::createObjectFile(buffer->getMemBufferRef());
+    if (!object_file)
+    {
+        m_jit_error = llvm::toString(object_file.takeError());
+        return false;
+    }
+
+    // The engine is created for an empty module, and the object is added to it
+    m_context.reset(new llvm::LLVMContext());
+    std::unique_ptr<llvm::Module> module(new llvm::Module("cached_object", *m_context));
+    module->setTargetTriple(llvm::sys::getProcessTriple());
+    if (!create_engine(std::move(module)))
+    {
+        return false;
+    }
+    m_execution_engine->addObjectFile(llvm::object::OwningBinary<llvm::object::ObjectFile>(
+        std::move(*object_file), std::move(buffer)));
+    m_object_loaded = true;
+    return true;
+}
+
+void codegen::ExecutionEngine::set_object_cache(const std::shared_ptr<ObjectCache>& cache,
+                                                const std::string& key)
+{
+    m_object_cache.reset(new ObjectCacheWriter(cache, key));
+}
+
 void codegen::ExecutionEngine::finalize()
 {
     if (m_execution_engine)
     {
         m_execution_engine->finalizeObject();
         m_execution_engine->runStaticConstructorsDestructors(false);
+        if (m_object_loaded)
+        {
+            for (size_t i = 0;; i++)
+            {
+                auto constructor = f_cast<void()>(
+                    get_pointer_to_named_function(s_constructor_prefix + std::to_string(i)));
+                if (!constructor)
+                {
+                    break;
+                }
+                constructor();
+            }
+        }
     }
     else
     {
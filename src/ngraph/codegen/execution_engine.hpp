@@ -18,8 +18,11 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "ngraph/codegen/compiler.hpp"
+#include "ngraph/codegen/object_cache.hpp"
 
 namespace ngraph
 {
@@ -31,8 +34,10 @@ namespace ngraph
 
 namespace llvm
 {
+    class LLVMContext;
     class Module;
     class ExecutionEngine;
+    class ObjectCache;
 }
 
 class ngraph::codegen::ExecutionEngine
@@ -42,6 +47,10 @@ public:
     ~ExecutionEngine();
 
     bool add_module(std::unique_ptr<ngraph::codegen::Module>& module);
+    /// \brief Loads an object stored by set_object_cache in place of a module
+    bool add_object(const std::vector<char>& object);
+    /// \brief Stores the object compiled from the module added next in cache, under key
+    void set_object_cache(const std::shared_ptr<ObjectCache>& cache, const std::string& key);
     void finalize();
 
     template <typename ftype>
@@ -51,8 +60,14 @@ public:
     }
 
 private:
+    // Declared before the engine, which refers to them
+    std::unique_ptr<llvm::LLVMContext> m_context;
+    std::unique_ptr<llvm::ObjectCache> m_object_cache;
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
     std::string m_jit_error;
+    bool m_object_loaded;
+
+    bool create_engine(std::unique_ptr<llvm::Module> module);
 
     void* get_pointer_to_named_function(const std::string& func_name);
     template <typename signature>
@@ -0,0 +1,165 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include "ngraph/codegen/object_cache.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const string s_object_extension = ".o";
+
+codegen::ObjectCache::ObjectCache(const string& directory, size_t max_size)
+    : m_directory(directory)
+    , m_max_size(max_size)
+{
+    file_util::make_directory(m_directory);
+}
+
+string codegen::ObjectCache::make_key(const string& source, const string& options)
+{
+    string input = string(NGRAPH_VERSION) + '\0' + options + '\0' + source;
+
+    // 64-bit FNV-1a, widened with std::hash to make collisions between large sources unlikely
+    uint64_t fnv = 14695981039346656037ULL;
+    for (char c : input)
+    {
+        fnv = (fnv ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+    }
+    stringstream key;
+    key << hex << setfill('0') << setw(16) << fnv << setw(16)
+        << static_cast<uint64_t>(hash<string>()(input));
+    return key.str();
+}
+
+string codegen::ObjectCache::get_path(const string& key) const
+{
+    return file_util::path_join(m_directory, key + s_object_extension);
+}
+
+bool codegen::ObjectCache::load(const string& key, vector<char>& object)
+{
+    string path = get_path(key);
+    ifstream in(path, ios::binary | ios::ate);
+    if (!in)
+    {
+        m_misses++;
+        NGRAPH_DEBUG << "Codegen object cache miss for " << key;
+        return false;
+    }
+    object.resize(in.tellg());
+    in.seekg(0);
+    in.read(object.data(), object.size());
+    if (!in)
+    {
+        m_misses++;
+        NGRAPH_WARN << "Could not read codegen cache entry " << path;
+        return false;
+    }
+    // Mark the entry as recently used
+    utime(path.c_str(), nullptr);
+    m_hits++;
+    NGRAPH_DEBUG << "Codegen object cache hit for " << key << " (" << object.size() << " bytes)";
+    return true;
+}
+
+void codegen::ObjectCache::store(const string& key, const char* data, size_t size)
+{
+    // Threads of one process may store the same key at once, so the temporary file is unique
+    // to this call and not only to the process
+    static atomic<size_t> s_store_count{0};
+    string path = get_path(key);
+    string temp_path =
+        path + "." + to_string(getpid()) + "." + to_string(s_store_count++) + ".tmp";
+    {
+        ofstream out(temp_path, ios::binary);
+        out.write(data, size);
+        if (!out)
+        {
+            NGRAPH_WARN << "Could not write codegen cache entry " << temp_path;
+            file_util::remove_file(temp_path);
+            return;
+        }
+    }
+    if (rename(temp_path.c_str(), path.c_str()) != 0)
+    {
+        NGRAPH_WARN << "Could not write codegen cache entry " << path;
+        file_util::remove_file(temp_path);
+        return;
+    }
+    NGRAPH_DEBUG << "Stored " << size << " bytes in the codegen object cache as " << key;
+    evict(path);
+}
+
+void codegen::ObjectCache::evict(const string& keep_path)
+{
+    struct Entry
+    {
+        string path;
+        size_t size;
+        time_t last_used;
+    };
+    vector<Entry> entries;
+    size_t total_size = 0;
+    file_util::iterate_files(m_directory, [&](const string& file, bool is_dir) {
+        struct stat file_stat;
+        if (!is_dir && file.size() > s_object_extension.size() &&
+            file.compare(file.size() - s_object_extension.size(),
+                         s_object_extension.size(),
+                         s_object_extension) == 0 &&
+            stat(file.c_str(), &file_stat) == 0)
+        {
+            entries.push_back({file, static_cast<size_t>(file_stat.st_size), file_stat.st_mtime});
+            total_size += file_stat.st_size;
+        }
+    });
+    if (total_size <= m_max_size)
+    {
+        return;
+    }
+
+    sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.last_used < b.last_used;
+    });
+    for (const Entry& entry : entries)
+    {
+        if (total_size <= m_max_size)
+        {
+            break;
+        }
+        // Modification times have a coarse resolution, so the entry just stored may tie
+        // with older ones
+        if (entry.path == keep_path)
+        {
+            continue;
+        }
+        NGRAPH_DEBUG << "Evicting " << entry.path << " from the codegen object cache";
+        file_util::remove_file(entry.path);
+        total_size -= entry.size;
+    }
+}
@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    namespace codegen
+    {
+        class ObjectCache;
+    }
+}
+
+/// \brief A persistent, size-bounded cache of compiled objects.
+///
+/// Each object is a file in the cache directory, named by a key that hashes everything that
+/// went into compiling it. A hit refreshes the file's modification time, and when the files
+/// grow past the size limit the least recently used ones are removed. Files are written under
+/// a temporary name and renamed, so processes can share a directory.
+class ngraph::codegen::ObjectCache
+{
+public:
+    ObjectCache(const std::string& directory, size_t max_size);
+
+    /// \brief Key for source compiled with options by this version of nGraph
+    static std::string make_key(const std::string& source, const std::string& options);
+
+    /// \brief Reads the object stored under key
+    /// \return true on a hit
+    bool load(const std::string& key, std::vector<char>& object);
+    void store(const std::string& key, const char* data, size_t size);
+
+    const std::string& get_directory() const { return m_directory; }
+    size_t get_hits() const { return m_hits; }
+    size_t get_misses() const { return m_misses; }
+private:
+    std::string get_path(const std::string& key) const;
+    /// \brief Removes the least recently used entries, other than keep_path, until the
+    ///        entries fit in the size limit
+    void evict(const std::string& keep_path);
+
+    std::string m_directory;
+    size_t m_max_size;
+    std::atomic<size_t> m_hits{0};
+    std::atomic<size_t> m_misses{0};
+};
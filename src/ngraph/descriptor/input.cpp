@@ -49,13 +49,16 @@ descriptor::Input::~Input()
 
 void descriptor::Input::replace_output(Output& new_output)
 {
+    Node* previous_node = nullptr;
     if (m_output != nullptr)
     {
+        previous_node = m_output->get_node().get();
         m_output->remove_input(this);
     }
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    Node::record_graph_change(m_node, previous_node);
 
     static const auto nerc = std::getenv("NGRAPH_ENABLE_REPLACE_CHECK");
 
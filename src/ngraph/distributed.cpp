@@ -18,6 +18,9 @@
 #include "ngraph/distributed/mlsl.hpp"
 #include "ngraph/distributed/null.hpp"
 #include "ngraph/distributed/open_mpi.hpp"
+#ifdef NGRAPH_DISTRIBUTED_SHM_ENABLE
+#include "ngraph/distributed/shm.hpp"
+#endif
 #include "ngraph/log.hpp"
 
 using namespace ngraph;
@@ -60,6 +63,9 @@ DistributedInterface* ngraph::get_distributed_interface()
 #elif defined(NGRAPH_DISTRIBUTED_MLSL_ENABLE)
         set_distributed_interface(std::unique_ptr<DistributedInterface>(
             new ngraph::distributed::MLSLDistributedInterface()));
+#elif defined(NGRAPH_DISTRIBUTED_SHM_ENABLE)
+        set_distributed_interface(std::unique_ptr<DistributedInterface>(
+            new ngraph::distributed::SharedMemoryDistributedInterface()));
 #else
         set_distributed_interface(std::unique_ptr<DistributedInterface>(
             new ngraph::distributed::NullDistributedInterface()));
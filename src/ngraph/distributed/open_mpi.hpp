@@ -40,7 +40,9 @@ namespace ngraph
                 MPI_Initialized(&flag);
                 if (!flag && !m_initialized_mpi)
                 {
-                    MPI_Init(NULL, NULL);
+                    // Collectives may be issued from the CPU backend's communication thread
+                    int provided = 0;
+                    MPI_Init_thread(NULL, NULL, MPI_THREAD_SERIALIZED, &provided);
                     m_initialized_mpi = true;
                 }
             }
@@ -0,0 +1,425 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#include "ngraph/distributed/shm.hpp"
+#include "ngraph/except.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared-memory counters must be lock-free");
+
+namespace
+{
+    const size_t s_cache_line = 64;
+
+    size_t align_up(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    void cpu_relax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+
+    template <typename P>
+    void spin_until(P predicate)
+    {
+        for (size_t i = 0; !predicate(); i++)
+        {
+            if (i < 4096)
+            {
+                cpu_relax();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void wait_for(const std::atomic<uint64_t>& counter, uint64_t value)
+    {
+        spin_until([&]() { return counter.load(std::memory_order_acquire) >= value; });
+    }
+
+    template <typename T>
+    void reduce_into(T* acc, const T* arg, size_t count, reduction::Type reduce_type)
+    {
+#if !(defined(__GNUC__) && (__GNUC__ == 4 && __GNUC_MINOR__ == 8))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Wswitch"
+#pragma GCC diagnostic error "-Wswitch-enum"
+#endif
+        switch (reduce_type)
+        {
+        case reduction::Type::SUM:
+            for (size_t i = 0; i < count; i++)
+            {
+                acc[i] += arg[i];
+            }
+            break;
+        case reduction::Type::PROD:
+            for (size_t i = 0; i < count; i++)
+            {
+                acc[i] *= arg[i];
+            }
+            break;
+        case reduction::Type::MIN:
+            for (size_t i = 0; i < count; i++)
+            {
+                acc[i] = arg[i] < acc[i] ? arg[i] : acc[i];
+            }
+            break;
+        case reduction::Type::MAX:
+            for (size_t i = 0; i < count; i++)
+            {
+                acc[i] = arg[i] > acc[i] ? arg[i] : acc[i];
+            }
+            break;
+        }
+#if !(defined(__GNUC__) && __GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic pop
+#endif
+    }
+
+    void reduce_into(void* acc,
+                     const void* arg,
+                     size_t count,
+                     element::Type_t element_type,
+                     reduction::Type reduce_type)
+    {
+        if (element_type == element::Type_t::f32)
+        {
+            reduce_into(
+                static_cast<float*>(acc), static_cast<const float*>(arg), count, reduce_type);
+        }
+        else if (element_type == element::Type_t::f64)
+        {
+            reduce_into(
+                static_cast<double*>(acc), static_cast<const double*>(arg), count, reduce_type);
+        }
+        else if (element_type == element::Type_t::i32)
+        {
+            reduce_into(
+                static_cast<int32_t*>(acc), static_cast<const int32_t*>(arg), count, reduce_type);
+        }
+        else if (element_type == element::Type_t::i64)
+        {
+            reduce_into(
+                static_cast<int64_t*>(acc), static_cast<const int64_t*>(arg), count, reduce_type);
+        }
+        else
+        {
+            throw ngraph_error("AllReduce op supports only f32, f64, i32 and i64 types");
+        }
+    }
+}
+
+// Control block of one rank. Each counter is written by a single rank and lives on its own
+// cache line. Everything but `taken` is written by the owning rank.
+struct distributed::SharedMemoryDistributedInterface::Slot
+{
+    // Last collective step whose input chunk is in this rank's staging buffer
+    alignas(s_cache_line) std::atomic<uint64_t> ready;
+    // Last collective step whose reduced segment is in this rank's staging buffer
+    alignas(s_cache_line) std::atomic<uint64_t> reduced;
+    // Last collective step this rank has finished reading from other ranks' buffers
+    alignas(s_cache_line) std::atomic<uint64_t> done;
+    // Number of point-to-point chunks posted, and the rank the last one is for
+    alignas(s_cache_line) std::atomic<uint64_t> posted;
+    std::atomic<int64_t> dest;
+    // Number of point-to-point chunks taken, written by their receivers
+    alignas(s_cache_line) std::atomic<uint64_t> taken;
+    // Process id of the rank once its slot is initialized, 0 after it detached
+    alignas(s_cache_line) std::atomic<int64_t> pid;
+};
+
+distributed::SharedMemoryDistributedInterface::SharedMemoryDistributedInterface(
+    const std::string& name, int rank, int size, size_t chunk_bytes)
+    : m_rank(rank)
+    , m_size(size)
+{
+    if (size < 1 || rank < 0 || rank >= size)
+    {
+        throw ngraph_error("Invalid shared-memory rank " + to_string(rank) + " of " +
+                           to_string(size));
+    }
+    attach(name, chunk_bytes);
+}
+
+distributed::SharedMemoryDistributedInterface::SharedMemoryDistributedInterface()
+{
+    const char* name = std::getenv("NGRAPH_SHM_NAME");
+    const char* rank = std::getenv("NGRAPH_SHM_RANK");
+    const char* size = std::getenv("NGRAPH_SHM_SIZE");
+    if (name == nullptr || rank == nullptr || size == nullptr)
+    {
+        throw ngraph_error(
+            "NGRAPH_SHM_NAME, NGRAPH_SHM_RANK and NGRAPH_SHM_SIZE must be set to use the "
+            "shared-memory distributed interface");
+    }
+    m_rank = std::atoi(rank);
+    m_size = std::atoi(size);
+    if (m_size < 1 || m_rank < 0 || m_rank >= m_size)
+    {
+        throw ngraph_error("Invalid shared-memory rank " + string(rank) + " of " + size);
+    }
+    attach(name, s_default_chunk_bytes);
+}
+
+void distributed::SharedMemoryDistributedInterface::attach(const std::string& segment_name,
+                                                            size_t chunk_bytes)
+{
+    m_segment_name = segment_name;
+    m_chunk_bytes = align_up(std::max<size_t>(chunk_bytes, s_cache_line), s_cache_line);
+    // Two alternating staging buffers for collectives and one point-to-point buffer
+    m_slot_bytes = align_up(sizeof(Slot), s_cache_line) + 3 * m_chunk_bytes;
+    m_segment_bytes = m_size * m_slot_bytes;
+
+    int fd = shm_open(m_segment_name.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        throw ngraph_error("shm_open of " + m_segment_name + " failed: " + strerror(errno));
+    }
+    if (ftruncate(fd, m_segment_bytes) != 0)
+    {
+        int error = errno;
+        close(fd);
+        throw ngraph_error("Sizing " + m_segment_name + " failed: " + strerror(error));
+    }
+    void* segment = mmap(nullptr, m_segment_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED)
+    {
+        throw ngraph_error("Mapping " + m_segment_name + " failed: " + strerror(errno));
+    }
+    m_segment = static_cast<char*>(segment);
+
+    // First touch of this rank's slot places its pages on this rank's NUMA node
+    void* own_slot = &slot(m_rank);
+    std::memset(own_slot, 0, m_slot_bytes);
+    new (own_slot) Slot();
+
+    slot(m_rank).pid.store(getpid(), std::memory_order_release);
+
+    // A segment left behind by a job that died before rank 0 unlinked it still holds that job's
+    // counters. Nothing shared is trusted: every rank resets its own slot, and a rank has only
+    // attached once its slot names a live process.
+    spin_until([this]() {
+        for (int rank = 0; rank < m_size; rank++)
+        {
+            int64_t pid = slot(rank).pid.load(std::memory_order_acquire);
+            if (pid <= 0 || (kill(static_cast<pid_t>(pid), 0) != 0 && errno != EPERM))
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    // Every rank has mapped the segment, so its name is no longer needed
+    if (m_rank == 0)
+    {
+        shm_unlink(m_segment_name.c_str());
+    }
+}
+
+distributed::SharedMemoryDistributedInterface::~SharedMemoryDistributedInterface()
+{
+    if (m_segment != nullptr)
+    {
+        slot(m_rank).pid.store(0, std::memory_order_release);
+        munmap(m_segment, m_segment_bytes);
+    }
+}
+
+distributed::SharedMemoryDistributedInterface::Slot&
+    distributed::SharedMemoryDistributedInterface::slot(int rank) const
+{
+    return *reinterpret_cast<Slot*>(m_segment + rank * m_slot_bytes);
+}
+
+char* distributed::SharedMemoryDistributedInterface::staging_buffer(int rank,
+                                                                    uint64_t step) const
+{
+    return reinterpret_cast<char*>(&slot(rank)) + align_up(sizeof(Slot), s_cache_line) +
+           (step % 2) * m_chunk_bytes;
+}
+
+char* distributed::SharedMemoryDistributedInterface::p2p_buffer(int rank) const
+{
+    return reinterpret_cast<char*>(&slot(rank)) + align_up(sizeof(Slot), s_cache_line) +
+           2 * m_chunk_bytes;
+}
+
+void distributed::SharedMemoryDistributedInterface::begin_step(uint64_t step)
+{
+    if (step <= 2)
+    {
+        return;
+    }
+    for (int q = 0; q < m_size; q++)
+    {
+        wait_for(slot(q).done, step - 2);
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::log_print(const std::string& timestamp,
+                                                              const std::vector<char>& buf)
+{
+    std::printf("%s [SharedMemory RANK: %d]: %s\n", timestamp.c_str(), m_rank, buf.data());
+}
+
+void distributed::SharedMemoryDistributedInterface::all_reduce(void* in,
+                                                               void* out,
+                                                               element::Type_t element_type,
+                                                               reduction::Type reduce_type,
+                                                               size_t count)
+{
+    size_t element_size = element::Type(element_type).size();
+    size_t chunk_count = m_chunk_bytes / element_size;
+    auto src = static_cast<const char*>(in);
+    auto dst = static_cast<char*>(out);
+    Slot& mine = slot(m_rank);
+
+    for (size_t offset = 0; offset < count; offset += chunk_count)
+    {
+        size_t n = std::min(chunk_count, count - offset);
+        uint64_t step = ++m_step;
+        begin_step(step);
+
+        char* staged = staging_buffer(m_rank, step);
+        std::memcpy(staged, src + offset * element_size, n * element_size);
+        mine.ready.store(step, std::memory_order_release);
+
+        // Reduce-scatter: this rank reduces its segment of the chunk over all ranks
+        size_t lo = n * m_rank / m_size;
+        size_t hi = n * (m_rank + 1) / m_size;
+        for (int q = 0; q < m_size; q++)
+        {
+            if (q != m_rank)
+            {
+                wait_for(slot(q).ready, step);
+                reduce_into(staged + lo * element_size,
+                            staging_buffer(q, step) + lo * element_size,
+                            hi - lo,
+                            element_type,
+                            reduce_type);
+            }
+        }
+        mine.reduced.store(step, std::memory_order_release);
+
+        // All-gather: collect every rank's reduced segment
+        for (int q = 0; q < m_size; q++)
+        {
+            size_t q_lo = n * q / m_size;
+            size_t q_hi = n * (q + 1) / m_size;
+            wait_for(slot(q).reduced, step);
+            std::memcpy(dst + (offset + q_lo) * element_size,
+                        staging_buffer(q, step) + q_lo * element_size,
+                        (q_hi - q_lo) * element_size);
+        }
+        mine.done.store(step, std::memory_order_release);
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::broadcast(void* in,
+                                                              element::Type_t element_type,
+                                                              size_t count,
+                                                              int root_id)
+{
+    size_t element_size = element::Type(element_type).size();
+    size_t chunk_count = m_chunk_bytes / element_size;
+    auto data = static_cast<char*>(in);
+    Slot& root = slot(root_id);
+
+    for (size_t offset = 0; offset < count; offset += chunk_count)
+    {
+        size_t bytes = std::min(chunk_count, count - offset) * element_size;
+        uint64_t step = ++m_step;
+        if (m_rank == root_id)
+        {
+            begin_step(step);
+            std::memcpy(staging_buffer(root_id, step), data + offset * element_size, bytes);
+            root.ready.store(step, std::memory_order_release);
+        }
+        else
+        {
+            wait_for(root.ready, step);
+            std::memcpy(data + offset * element_size, staging_buffer(root_id, step), bytes);
+        }
+        slot(m_rank).done.store(step, std::memory_order_release);
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::recv(void* in,
+                                                         element::Type_t element_type,
+                                                         size_t count,
+                                                         int src_id)
+{
+    size_t bytes = count * element::Type(element_type).size();
+    auto data = static_cast<char*>(in);
+    Slot& sender = slot(src_id);
+
+    for (size_t offset = 0; offset < bytes; offset += m_chunk_bytes)
+    {
+        // Exactly one chunk is pending when posted is ahead of taken
+        uint64_t posted = 0;
+        spin_until([&]() {
+            posted = sender.posted.load(std::memory_order_acquire);
+            return posted > sender.taken.load(std::memory_order_relaxed) &&
+                   sender.dest.load(std::memory_order_relaxed) == m_rank;
+        });
+        std::memcpy(data + offset, p2p_buffer(src_id), std::min(m_chunk_bytes, bytes - offset));
+        sender.taken.store(posted, std::memory_order_release);
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::send(const void* in,
+                                                         element::Type_t element_type,
+                                                         size_t count,
+                                                         int dest_id)
+{
+    size_t bytes = count * element::Type(element_type).size();
+    auto data = static_cast<const char*>(in);
+    Slot& mine = slot(m_rank);
+
+    for (size_t offset = 0; offset < bytes; offset += m_chunk_bytes)
+    {
+        wait_for(mine.taken, m_sent);
+        std::memcpy(p2p_buffer(m_rank), data + offset, std::min(m_chunk_bytes, bytes - offset));
+        mine.dest.store(dest_id, std::memory_order_relaxed);
+        mine.posted.store(++m_sent, std::memory_order_release);
+    }
+}
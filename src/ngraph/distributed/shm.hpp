@@ -0,0 +1,112 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ngraph/distributed.hpp"
+
+namespace ngraph
+{
+    namespace distributed
+    {
+        /// \brief DistributedInterface for ranks that are processes on one host, communicating
+        ///     through a POSIX shared-memory segment instead of MPI.
+        ///
+        /// Every rank owns a slot of the segment holding its control counters and staging
+        /// buffers. A rank first-touches its own slot, so on a NUMA machine the pages it writes
+        /// are local to it. Collectives move data in chunks through two alternating buffers
+        /// per rank, so a fast rank can stage the next chunk while slower ranks still read the
+        /// previous one. All synchronization is done with monotonically increasing sequence
+        /// counters (acquire/release atomics); there are no locks.
+        ///
+        /// AllReduce is a segmented reduce-scatter followed by an all-gather. Each rank reduces
+        /// 1/size of every chunk across all ranks and then collects the other reduced segments,
+        /// so each rank moves the same amount of data as in a ring allreduce, without the
+        /// ring's size - 1 latency steps.
+        ///
+        /// Collectives must be called in the same order on all ranks. Each rank has a single
+        /// outgoing point-to-point buffer, so send returns once its last chunk is staged but
+        /// waits for the receiver to take every earlier chunk.
+        class SharedMemoryDistributedInterface : public DistributedInterface
+        {
+        public:
+            /// \brief Attaches rank `rank` of `size` to the segment `name` (a POSIX shm name
+            ///     such as "/ngraph_job42"), creating it if needed. Blocks until all ranks have
+            ///     attached. A segment left behind by a job that died is reused safely.
+            SharedMemoryDistributedInterface(const std::string& name,
+                                             int rank,
+                                             int size,
+                                             size_t chunk_bytes = s_default_chunk_bytes);
+
+            /// \brief Reads the segment name, rank and size from the NGRAPH_SHM_NAME,
+            ///     NGRAPH_SHM_RANK and NGRAPH_SHM_SIZE environment variables.
+            SharedMemoryDistributedInterface();
+
+            ~SharedMemoryDistributedInterface() override;
+
+            const std::string& get_name() const override { return m_name; }
+            int get_size() override { return m_size; }
+            int get_rank() override { return m_rank; }
+            void log_print(const std::string& timestamp, const std::vector<char>& buf) override;
+
+            void all_reduce(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            reduction::Type reduce_type,
+                            size_t count) override;
+
+            void broadcast(void* in,
+                           element::Type_t element_type,
+                           size_t count,
+                           int root_id) override;
+
+            void recv(void* in, element::Type_t element_type, size_t count, int src_id) override;
+
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_id) override;
+
+            static const size_t s_default_chunk_bytes = 1 << 20;
+
+        protected:
+            struct Slot;
+
+            void attach(const std::string& segment_name, size_t chunk_bytes);
+            Slot& slot(int rank) const;
+            char* staging_buffer(int rank, uint64_t step) const;
+            char* p2p_buffer(int rank) const;
+            // Waits until no rank can still be reading the staging buffer used by `step`
+            void begin_step(uint64_t step);
+
+            std::string m_name{"SharedMemory"};
+            std::string m_segment_name;
+            int m_rank{0};
+            int m_size{1};
+            size_t m_chunk_bytes{0};
+            size_t m_slot_bytes{0};
+            size_t m_segment_bytes{0};
+            char* m_segment{nullptr};
+            uint64_t m_step{0};
+            uint64_t m_sent{0};
+        };
+    }
+}
@@ -14,10 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
+#include <future>
 #include <set>
 
 #include "graph.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "node.hpp"
 
 namespace ngraph
@@ -57,24 +61,36 @@ namespace ngraph
                 std::string domain = get_node_domain(node_proto);
                 return (domain.empty() ? "" : domain + ".") + node_proto.op_type();
             }
+
+            /// \brief Frees the data of tensor_proto, keeping its name, type and shape.
+            static void release_data(onnx::TensorProto& tensor_proto)
+            {
+                onnx::TensorProto released;
+                released.set_name(tensor_proto.name());
+                released.set_data_type(tensor_proto.data_type());
+                released.mutable_dims()->CopyFrom(tensor_proto.dims());
+                tensor_proto.Swap(&released);
+            }
         } // namespace detail
 
         Graph::Graph(const onnx::GraphProto& graph_proto, Model& model, const Weights& weights)
+            : Graph(graph_proto, nullptr, model, weights)
+        {
+        }
+
+        Graph::Graph(onnx::GraphProto* graph_proto, Model& model, const Weights& weights)
+            : Graph(*graph_proto, graph_proto, model, weights)
+        {
+        }
+
+        Graph::Graph(const onnx::GraphProto& graph_proto,
+                     onnx::GraphProto* releasable_proto,
+                     Model& model,
+                     const Weights& weights)
             : m_graph_proto{&graph_proto}
             , m_model{&model}
         {
-            // Process all initializers in the graph
-            for (const auto& initializer_tensor : m_graph_proto->initializer())
-            {
-                if (initializer_tensor.has_name())
-                {
-                    Tensor tensor = Tensor{initializer_tensor};
-                    m_initializers.emplace(initializer_tensor.name(), tensor);
-
-                    // For each initializer, create a Constant node and store in cache
-                    m_ng_node_cache.emplace(initializer_tensor.name(), tensor.get_ng_constant());
-                }
-            }
+            add_initializers(releasable_proto);
 
             // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
             for (const auto& input : m_graph_proto->input())
@@ -145,6 +161,65 @@ namespace ngraph
             }
         }
 
+        void Graph::add_initializers(onnx::GraphProto* releasable_proto)
+        {
+            std::vector<int> indices;
+            for (int i = 0; i < m_graph_proto->initializer_size(); i++)
+            {
+                if (m_graph_proto->initializer(i).has_name())
+                {
+                    indices.push_back(i);
+                }
+            }
+
+            // For each initializer, create a Constant node. Models may have thousands of large
+            // initializers, so they are converted in parallel on the compile pool.
+            std::vector<std::shared_ptr<op::Constant>> constants(indices.size());
+            std::atomic<std::size_t> next{0};
+            auto convert = [&]() {
+                for (std::size_t i = next++; i < indices.size(); i = next++)
+                {
+                    const auto& initializer_tensor = m_graph_proto->initializer(indices[i]);
+                    constants[i] = Tensor{initializer_tensor}.get_ng_constant();
+                    if (releasable_proto != nullptr)
+                    {
+                        detail::release_data(*releasable_proto->mutable_initializer(indices[i]));
+                    }
+                }
+            };
+            std::shared_ptr<runtime::ThreadPool> pool = runtime::ThreadPool::get_compile_pool();
+            std::size_t threads = pool ? std::min(pool->get_thread_count(), indices.size()) : 1;
+            if (threads > 1)
+            {
+                std::vector<std::future<void>> done;
+                for (std::size_t t = 0; t < threads; t++)
+                {
+                    done.push_back(pool->submit(convert));
+                }
+                // Let every task finish before an exception unwinds the state they share
+                for (auto& d : done)
+                {
+                    d.wait();
+                }
+                for (auto& d : done)
+                {
+                    d.get();
+                }
+            }
+            else
+            {
+                convert();
+            }
+
+            // Store the Constant nodes in cache
+            for (std::size_t i = 0; i < indices.size(); i++)
+            {
+                const std::string& name = m_graph_proto->initializer(indices[i]).name();
+                m_initializers.emplace(name, constants[i]);
+                m_ng_node_cache.emplace(name, constants[i]);
+            }
+        }
+
         NodeVector Graph::get_ng_outputs() const
         {
             NodeVector results;
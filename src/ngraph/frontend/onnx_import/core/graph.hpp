@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "model.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "operator_set.hpp"
 #include "value_info.hpp"
@@ -35,6 +36,11 @@ namespace ngraph
         public:
             Graph(const onnx::GraphProto& proto, Model& model, const Weights& weights = {});
 
+            /// \brief Creates a graph, releasing the data of each initializer of proto as soon
+            ///        as it has been converted to a Constant. The weights are then held about
+            ///        once, as Constants, rather than twice, but proto can't be imported again.
+            Graph(onnx::GraphProto* proto, Model& model, const Weights& weights = {});
+
             const std::vector<Node>& get_nodes() const { return m_nodes; }
             const std::vector<ValueInfo>& get_inputs() const { return m_inputs; }
             const std::vector<ValueInfo>& get_outputs() const { return m_outputs; }
@@ -52,13 +58,22 @@ namespace ngraph
             }
 
         private:
+            Graph(const onnx::GraphProto& proto,
+                  onnx::GraphProto* releasable_proto,
+                  Model& model,
+                  const Weights& weights);
+
+            void add_initializers(onnx::GraphProto* releasable_proto);
+
             const onnx::GraphProto* m_graph_proto;
             std::vector<Node> m_nodes;
             std::vector<ValueInfo> m_inputs;
             std::vector<ValueInfo> m_outputs;
             ParameterVector m_parameters;
             std::map<std::string, std::shared_ptr<ngraph::Node>> m_ng_node_cache;
-            std::map<std::string, Tensor> m_initializers;
+            // Initializers are kept as Constants only, since the data of their protos may have
+            // been released
+            std::map<std::string, std::shared_ptr<op::Constant>> m_initializers;
             Model* m_model;
         };
 
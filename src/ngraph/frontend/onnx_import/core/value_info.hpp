@@ -79,15 +79,15 @@ namespace ngraph
                     m_value_info_proto->type().tensor_type().elem_type());
             }
 
-            std::shared_ptr<ngraph::Node>
-                get_ng_node(ParameterVector& parameters,
-                            const std::map<std::string, Tensor>& initializers,
-                            const Weights& weights = {}) const
+            std::shared_ptr<ngraph::Node> get_ng_node(
+                ParameterVector& parameters,
+                const std::map<std::string, std::shared_ptr<op::Constant>>& initializers,
+                const Weights& weights = {}) const
             {
                 const auto it = initializers.find(get_name());
                 if (it != std::end(initializers))
                 {
-                    return get_ng_constant(it->second);
+                    return it->second;
                 }
                 else
                 {
@@ -112,11 +112,6 @@ namespace ngraph
                 return std::make_shared<op::Constant>(weight.type(), weight.shape(), weight.data());
             }
 
-            std::shared_ptr<op::Constant> get_ng_constant(const Tensor& tensor) const
-            {
-                return tensor.get_ng_constant();
-            }
-
         private:
             const onnx::ValueInfoProto* m_value_info_proto;
             Shape m_shape;
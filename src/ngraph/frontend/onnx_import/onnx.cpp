@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
 #include <fstream>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/text_format.h>
@@ -71,12 +72,23 @@ namespace ngraph
             }
 
             Model model{model_proto};
-            Graph graph{model_proto.graph(), model, weights};
+            // The model proto is not used after the import, so its initializers are released
+            // as they are converted unless NGRAPH_ONNX_KEEP_INITIALIZERS is set
+            std::unique_ptr<Graph> graph;
+            if (std::getenv("NGRAPH_ONNX_KEEP_INITIALIZERS") != nullptr)
+            {
+                graph.reset(new Graph{model_proto.graph(), model, weights});
+            }
+            else
+            {
+                graph.reset(new Graph{model_proto.mutable_graph(), model, weights});
+            }
             auto function = std::make_shared<Function>(
-                graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
+                graph->get_ng_outputs(), graph->get_ng_parameters(), graph->get_name());
             for (std::size_t i{0}; i < function->get_output_size(); ++i)
             {
-                function->get_output_op(i)->set_friendly_name(graph.get_outputs().at(i).get_name());
+                function->get_output_op(i)->set_friendly_name(
+                    graph->get_outputs().at(i).get_name());
             }
             return function;
         }
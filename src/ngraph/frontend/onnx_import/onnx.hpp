@@ -72,6 +72,9 @@ namespace ngraph
         ///                   the model this parameter shall be empty. Having weights in a model
         ///                   and providing through this parameters is invalid (the weights from
         ///                   the model  will take precedence).
+        /// \note The data of each initializer is released once it has been converted, so the
+        ///       weights are held about once during the import. Set NGRAPH_ONNX_KEEP_INITIALIZERS
+        ///       to keep the whole model until the import is done.
         /// \return The function returns a nGraph function representing single output from graph.
         std::shared_ptr<Function> import_onnx_model(std::istream& sin, const Weights& weights = {});
 
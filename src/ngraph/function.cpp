@@ -15,8 +15,11 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <iterator>
 #include <list>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -95,9 +98,423 @@ void Function::init()
                    true /*include control dependencies*/);
 }
 
+// Topological order of ops that keeps the relative order the ops had in previous_order.
+// Ops that are not in previous_order are placed just before their first user.
+static list<shared_ptr<Node>> repair_topological_order(const list<shared_ptr<Node>>& ops,
+                                                       const list<shared_ptr<Node>>& previous_order,
+                                                       bool include_control_deps)
+{
+    enum class State
+    {
+        unvisited,
+        visiting,
+        placed
+    };
+    unordered_map<Node*, State> states;
+    states.reserve(ops.size());
+    for (const shared_ptr<Node>& op : ops)
+    {
+        states[op.get()] = State::unvisited;
+    }
+
+    struct Frame
+    {
+        shared_ptr<Node> node;
+        size_t next_input;
+        set<shared_ptr<Node>>::const_iterator next_control_dep;
+    };
+    list<shared_ptr<Node>> result;
+    vector<Frame> stack;
+    auto place = [&](const shared_ptr<Node>& root) {
+        auto it = states.find(root.get());
+        if (it == states.end() || it->second != State::unvisited)
+        {
+            return;
+        }
+        it->second = State::visiting;
+        stack.push_back({root, 0, root->get_control_dependencies().begin()});
+        while (!stack.empty())
+        {
+            Frame& frame = stack.back();
+            shared_ptr<Node> dep;
+            if (frame.next_input < frame.node->get_input_size())
+            {
+                dep = frame.node->input(frame.next_input++)
+                          .get_source_output()
+                          .get_node_shared_ptr();
+            }
+            else if (include_control_deps &&
+                     frame.next_control_dep != frame.node->get_control_dependencies().end())
+            {
+                dep = *frame.next_control_dep++;
+            }
+            else
+            {
+                states[frame.node.get()] = State::placed;
+                result.push_back(frame.node);
+                stack.pop_back();
+                continue;
+            }
+            auto dep_state = states.find(dep.get());
+            NGRAPH_CHECK(dep_state != states.end() && dep_state->second != State::visiting,
+                         "Cycle or unreachable dependency at ",
+                         *frame.node);
+            if (dep_state->second == State::unvisited)
+            {
+                dep_state->second = State::visiting;
+                stack.push_back({dep, 0, dep->get_control_dependencies().begin()});
+            }
+        }
+    };
+
+    for (const shared_ptr<Node>& op : previous_order)
+    {
+        place(op);
+    }
+    for (const shared_ptr<Node>& op : ops)
+    {
+        place(op);
+    }
+    NGRAPH_CHECK(ops.size() == result.size());
+    return result;
+}
+
+// Labels of consecutive ops start this far apart, leaving room for ops inserted between them
+static const uint64_t s_label_spacing = uint64_t(1) << 32;
+
+// Appends the nodes that node must come after: its arguments and, optionally, its control
+// dependencies
+static void get_dependencies(Node* node, bool include_control_deps, vector<Node*>& dependencies)
+{
+    for (size_t i = 0; i < node->get_input_size(); i++)
+    {
+        dependencies.push_back(node->input(i).get_source_output().get_node());
+    }
+    if (include_control_deps)
+    {
+        for (const shared_ptr<Node>& dependency : node->get_control_dependencies())
+        {
+            dependencies.push_back(dependency.get());
+        }
+    }
+}
+
+// Results and parameters are part of a function whether or not they are used
+static bool is_root(const Function& function, const Node* node)
+{
+    auto is_node = [node](const shared_ptr<Node>& root) { return root.get() == node; };
+    const ParameterVector& parameters = function.get_parameters();
+    const ResultVector& results = function.get_results();
+    return (node->is_parameter() && any_of(parameters.begin(), parameters.end(), is_node)) ||
+           (node->is_output() && any_of(results.begin(), results.end(), is_node));
+}
+
+void Function::OrderedOpsCache::reset(list<shared_ptr<Node>> order, bool include_control_deps)
+{
+    ops = move(order);
+    positions.clear();
+    control_deps.clear();
+    control_users.clear();
+    positions.reserve(ops.size());
+    for (auto it = ops.begin(); it != ops.end(); ++it)
+    {
+        positions[it->get()].it = it;
+        if (include_control_deps)
+        {
+            index_control_dependencies(it->get());
+        }
+    }
+    relabel();
+    valid = true;
+}
+
+void Function::OrderedOpsCache::relabel()
+{
+    uint64_t label = 0;
+    for (const shared_ptr<Node>& op : ops)
+    {
+        label += s_label_spacing;
+        positions[op.get()].label = label;
+    }
+}
+
+void Function::OrderedOpsCache::index_control_dependencies(Node* node)
+{
+    const set<shared_ptr<Node>>& dependencies = node->get_control_dependencies();
+    if (dependencies.empty())
+    {
+        return;
+    }
+    vector<Node*>& indexed = control_deps[node];
+    for (const shared_ptr<Node>& dependency : dependencies)
+    {
+        indexed.push_back(dependency.get());
+        control_users[dependency.get()]++;
+    }
+}
+
+void Function::OrderedOpsCache::unindex_control_dependencies(Node* node,
+                                                            vector<Node*>& dependencies)
+{
+    auto indexed = control_deps.find(node);
+    if (indexed == control_deps.end())
+    {
+        return;
+    }
+    for (Node* dependency : indexed->second)
+    {
+        control_users[dependency]--;
+        dependencies.push_back(dependency);
+    }
+    control_deps.erase(indexed);
+}
+
+void Function::OrderedOpsCache::repair(const Function& function,
+                                       const vector<Node::GraphChange>& changes,
+                                       bool include_control_deps)
+{
+    // Changes to nodes outside this function, e.g. in other functions, leave the order as it is
+    vector<Node*> changed;
+    // Ops that lost a user and may no longer be reachable
+    vector<Node*> candidates;
+    for (const Node::GraphChange& change : changes)
+    {
+        if (positions.count(change.node) != 0)
+        {
+            changed.push_back(change.node);
+        }
+        if (change.previous_dependency != nullptr)
+        {
+            candidates.push_back(change.previous_dependency);
+        }
+    }
+    sort(changed.begin(), changed.end());
+    changed.erase(unique(changed.begin(), changed.end()), changed.end());
+
+    for (Node* node : changed)
+    {
+        if (include_control_deps)
+        {
+            unindex_control_dependencies(node, candidates);
+            index_control_dependencies(node);
+        }
+        move_dependencies_before(node, include_control_deps);
+    }
+    remove_unreachable(function, candidates, include_control_deps);
+}
+
+void Function::OrderedOpsCache::move_dependencies_before(Node* node, bool include_control_deps)
+{
+    const auto before = positions.at(node).it;
+    const uint64_t limit = positions.at(node).label;
+
+    // The ops that node depends on, directly or through each other, that are new or come after
+    // it. Moving all of them just before node keeps every other op after its dependencies.
+    unordered_set<Node*> to_move;
+    vector<Node*> placed;
+    vector<Node*> stack;
+    get_dependencies(node, include_control_deps, stack);
+    while (!stack.empty())
+    {
+        Node* dependency = stack.back();
+        stack.pop_back();
+        auto position = positions.find(dependency);
+        if ((position != positions.end() && position->second.label < limit) ||
+            !to_move.insert(dependency).second)
+        {
+            continue;
+        }
+        NGRAPH_CHECK(dependency != node, "Cycle in the graph at ", *node);
+        if (position != positions.end())
+        {
+            placed.push_back(dependency);
+        }
+        get_dependencies(dependency, include_control_deps, stack);
+    }
+    if (to_move.empty())
+    {
+        return;
+    }
+
+    // Ops already in the order keep their relative order, and new ops go just before their
+    // first user
+    sort(placed.begin(), placed.end(), [this](Node* a, Node* b) {
+        return positions.at(a).label < positions.at(b).label;
+    });
+    vector<Node*> roots = placed;
+    get_dependencies(node, include_control_deps, roots);
+    struct Frame
+    {
+        Node* node;
+        vector<Node*> dependencies;
+        size_t next;
+    };
+    vector<Frame> frames;
+    unordered_map<Node*, bool> done;
+    vector<Node*> order;
+    for (Node* root : roots)
+    {
+        if (to_move.count(root) == 0 || done.count(root) != 0)
+        {
+            continue;
+        }
+        frames.push_back({root, {}, 0});
+        get_dependencies(root, include_control_deps, frames.back().dependencies);
+        done[root] = false;
+        while (!frames.empty())
+        {
+            Frame& frame = frames.back();
+            if (frame.next == frame.dependencies.size())
+            {
+                done[frame.node] = true;
+                order.push_back(frame.node);
+                frames.pop_back();
+                continue;
+            }
+            Node* dependency = frame.dependencies[frame.next++];
+            if (to_move.count(dependency) == 0)
+            {
+                continue;
+            }
+            auto state = done.find(dependency);
+            if (state != done.end())
+            {
+                NGRAPH_CHECK(state->second, "Cycle in the graph at ", *dependency);
+                continue;
+            }
+            done[dependency] = false;
+            frames.push_back({dependency, {}, 0});
+            get_dependencies(dependency, include_control_deps, frames.back().dependencies);
+        }
+    }
+
+    for (Node* op : order)
+    {
+        auto position = positions.find(op);
+        if (position != positions.end())
+        {
+            ops.splice(before, ops, position->second.it);
+        }
+        else
+        {
+            positions[op].it = ops.insert(before, op->shared_from_this());
+            if (include_control_deps)
+            {
+                index_control_dependencies(op);
+            }
+        }
+    }
+
+    // Label the moved ops between the op before them and node, or relabel all ops when there
+    // is no room left
+    auto first = prev(before, order.size());
+    uint64_t lower = first == ops.begin() ? 0 : positions.at(prev(first)->get()).label;
+    uint64_t step = (limit - lower) / (order.size() + 1);
+    if (step == 0)
+    {
+        relabel();
+        return;
+    }
+    uint64_t label = lower;
+    for (auto it = first; it != before; ++it)
+    {
+        label += step;
+        positions.at(it->get()).label = label;
+    }
+}
+
+bool Function::OrderedOpsCache::has_user(Node* node, bool include_control_deps)
+{
+    for (size_t i = 0; i < node->get_output_size(); i++)
+    {
+        for (const Input<Node>& input : node->output(i).get_target_inputs())
+        {
+            if (positions.count(input.get_node()) != 0)
+            {
+                return true;
+            }
+        }
+    }
+    if (include_control_deps)
+    {
+        auto users = control_users.find(node);
+        return users != control_users.end() && users->second > 0;
+    }
+    return false;
+}
+
+void Function::OrderedOpsCache::remove_unreachable(const Function& function,
+                                                   vector<Node*>& candidates,
+                                                   bool include_control_deps)
+{
+    // An op that is not a root is reachable if and only if one of its users is. Candidates
+    // that are not ops of the function may no longer exist and are only looked up.
+    while (!candidates.empty())
+    {
+        Node* node = candidates.back();
+        candidates.pop_back();
+        auto position = positions.find(node);
+        if (position == positions.end() || is_root(function, node) ||
+            has_user(node, include_control_deps))
+        {
+            continue;
+        }
+        get_dependencies(node, false, candidates);
+        if (include_control_deps)
+        {
+            unindex_control_dependencies(node, candidates);
+        }
+        control_users.erase(node);
+        ops.erase(position->second.it);
+        positions.erase(position);
+    }
+}
+
 std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps) const
 {
-    return topological_sort(get_ops(include_control_deps), include_control_deps);
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    OrderedOpsCache& cache = m_ordered_ops_cache[include_control_deps ? 1 : 0];
+    size_t graph_version = Node::get_graph_version();
+    vector<Node::GraphChange> changes;
+    if (!cache.valid)
+    {
+        cache.reset(topological_sort(get_ops(include_control_deps), include_control_deps),
+                    include_control_deps);
+    }
+    else if (cache.graph_version == graph_version)
+    {
+        return cache.ops;
+    }
+    else if (Node::get_graph_changes(cache.graph_version, changes))
+    {
+        cache.repair(*this, changes, include_control_deps);
+        graph_version = changes.empty() ? cache.graph_version : changes.back().version;
+    }
+    else
+    {
+        // Too many changes to follow one by one
+        cache.reset(repair_topological_order(
+                        get_ops(include_control_deps), cache.ops, include_control_deps),
+                    include_control_deps);
+    }
+    cache.graph_version = graph_version;
+    return cache.ops;
+}
+
+void Function::set_ordered_ops(const list<shared_ptr<Node>>& order)
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    // Repairing an order that is already topological and complete leaves it unchanged
+    NGRAPH_CHECK(repair_topological_order(get_ops(true), order, true) == order,
+                 "Order of ops is not a topological order of Function ",
+                 get_name());
+    size_t graph_version = Node::get_graph_version();
+    m_ordered_ops_cache[1].reset(order, true);
+    m_ordered_ops_cache[0].reset(repair_topological_order(get_ops(false), order, false), false);
+    for (OrderedOpsCache& cache : m_ordered_ops_cache)
+    {
+        cache.graph_version = graph_version;
+    }
 }
 
 const std::string& Function::get_friendly_name() const
@@ -17,10 +17,13 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/node.hpp"
@@ -87,7 +90,13 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::list<std::shared_ptr<Node>> get_ops(bool include_control_deps = true) const;
+        /// \brief Returns the ops in topological order. The order is cached and repaired,
+        ///        rather than recomputed, after the graph has been rewired.
         std::list<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
+        /// \brief Sets the order returned by get_ordered_ops, e.g. to a schedule that needs less
+        ///        memory. order must hold every op of the function once, after its arguments
+        ///        and control dependencies.
+        void set_ordered_ops(const std::list<std::shared_ptr<Node>>& order);
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
         size_t get_temporary_pool_size();
@@ -123,5 +132,42 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
+
+        // Topological order of the ops, indexed so that it can be repaired where the graph
+        // changed without visiting the rest of it
+        struct OrderedOpsCache
+        {
+            struct Position
+            {
+                std::list<std::shared_ptr<Node>>::iterator it;
+                // Increases along ops
+                uint64_t label;
+            };
+
+            void reset(std::list<std::shared_ptr<Node>> order, bool include_control_deps);
+            void repair(const Function& function,
+                        const std::vector<Node::GraphChange>& changes,
+                        bool include_control_deps);
+            void move_dependencies_before(Node* node, bool include_control_deps);
+            void remove_unreachable(const Function& function,
+                                    std::vector<Node*>& candidates,
+                                    bool include_control_deps);
+            bool has_user(Node* node, bool include_control_deps);
+            void index_control_dependencies(Node* node);
+            void unindex_control_dependencies(Node* node, std::vector<Node*>& dependencies);
+            void relabel();
+
+            bool valid{false};
+            size_t graph_version{0};
+            std::list<std::shared_ptr<Node>> ops;
+            std::unordered_map<const Node*, Position> positions;
+            // Control dependencies of ops, as counted in control_users
+            std::unordered_map<const Node*, std::vector<Node*>> control_deps;
+            // Number of ops that have an op as a control dependency
+            std::unordered_map<const Node*, size_t> control_users;
+        };
+        // Indexed by include_control_deps
+        mutable OrderedOpsCache m_ordered_ops_cache[2];
+        mutable std::mutex m_ordered_ops_mutex;
     };
 }
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
@@ -32,6 +33,26 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_graph_version(0);
+
+namespace
+{
+    // Number of recent graph changes kept for functions to repair their order from
+    const size_t s_max_graph_changes = 1 << 16;
+
+    struct GraphChangeLog
+    {
+        mutex m_mutex;
+        // Oldest first, with consecutive versions
+        deque<Node::GraphChange> m_changes;
+    };
+
+    GraphChangeLog& get_graph_change_log()
+    {
+        static GraphChangeLog log;
+        return log;
+    }
+}
 
 Node::Node(size_t output_size)
     : Node()
@@ -337,6 +358,43 @@ const std::set<std::shared_ptr<Node>>& Node::get_control_dependencies() const
 void Node::add_control_dependency(std::shared_ptr<Node> node)
 {
     m_control_dependencies.insert(node);
+    record_graph_change(this, nullptr);
+}
+
+void Node::remove_control_dependency(std::shared_ptr<Node> node)
+{
+    m_control_dependencies.erase(node);
+    record_graph_change(this, node.get());
+}
+
+size_t Node::get_graph_version()
+{
+    return m_graph_version;
+}
+
+void Node::record_graph_change(Node* node, Node* previous_dependency)
+{
+    GraphChangeLog& log = get_graph_change_log();
+    lock_guard<mutex> lock(log.m_mutex);
+    size_t version = ++m_graph_version;
+    log.m_changes.push_back({version, node, previous_dependency});
+    if (log.m_changes.size() > s_max_graph_changes)
+    {
+        log.m_changes.pop_front();
+    }
+}
+
+bool Node::get_graph_changes(size_t since, vector<GraphChange>& changes)
+{
+    GraphChangeLog& log = get_graph_change_log();
+    lock_guard<mutex> lock(log.m_mutex);
+    size_t count = m_graph_version - since;
+    if (count > log.m_changes.size())
+    {
+        return false;
+    }
+    changes.insert(changes.end(), log.m_changes.end() - count, log.m_changes.end());
+    return true;
 }
 
 namespace ngraph
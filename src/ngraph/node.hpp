@@ -240,10 +240,29 @@ namespace ngraph
 
         void add_control_dependency(std::shared_ptr<Node> node);
 
-        void remove_control_dependency(std::shared_ptr<Node> node)
-        {
-            m_control_dependencies.erase(node);
-        }
+        void remove_control_dependency(std::shared_ptr<Node> node);
+
+        /// \brief Returns a counter that changes whenever an input of any node is connected to
+        ///        a different output or a control dependency is added or removed. Functions use
+        ///        it to tell when their cached topological order must be repaired.
+        static size_t get_graph_version();
+
+        /// \brief One change to the arguments or control dependencies of a node.
+        struct GraphChange
+        {
+            /// The graph version the change produced
+            size_t version;
+            /// The node whose input or control dependency changed
+            Node* node;
+            /// The node it depended on before, or nullptr if a dependency was added
+            Node* previous_dependency;
+        };
+
+        /// \brief Appends the graph changes made after graph version `since` to `changes`.
+        ///        Only the most recent changes are kept, so a function can repair just the ops
+        ///        they touch.
+        /// \returns false if some of those changes are no longer kept.
+        static bool get_graph_changes(size_t since, std::vector<GraphChange>& changes);
 
         /// Returns the number of outputs from the node.
         size_t get_output_size() const;
@@ -389,6 +408,7 @@ namespace ngraph
     private:
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
+        static void record_graph_change(Node* node, Node* previous_dependency);
 
         std::set<std::shared_ptr<Node>> m_control_dependencies;
         const std::string m_node_type;
@@ -396,6 +416,7 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<size_t> m_graph_version;
         std::unordered_set<std::string> m_provenance_tags;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
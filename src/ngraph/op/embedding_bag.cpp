@@ -0,0 +1,118 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/embedding_bag.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+const string op::EmbeddingBag::type_name{"EmbeddingBag"};
+
+op::EmbeddingBag::EmbeddingBag(const Output<Node>& indices,
+                               const Output<Node>& weights,
+                               const Output<Node>& offsets,
+                               Mode mode)
+    : Op({indices, weights, offsets})
+    , m_mode(mode)
+{
+    constructor_validate_and_infer_types();
+}
+
+op::EmbeddingBag::EmbeddingBag(const Output<Node>& indices,
+                               const Output<Node>& weights,
+                               const Output<Node>& offsets,
+                               const Output<Node>& per_sample_weights,
+                               Mode mode)
+    : Op({indices, weights, offsets, per_sample_weights})
+    , m_mode(mode)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::EmbeddingBag::validate_and_infer_types()
+{
+    element::Type indices_et = get_input_element_type(0);
+    element::Type result_et = get_input_element_type(1);
+
+    const PartialShape& indices_shape = get_input_partial_shape(0);
+    const PartialShape& weights_shape = get_input_partial_shape(1);
+    const PartialShape& offsets_shape = get_input_partial_shape(2);
+
+    NODE_VALIDATION_CHECK(this,
+                          indices_et.is_dynamic() || indices_et == element::i32 ||
+                              indices_et == element::i64,
+                          "indices must be i32 or i64, got ",
+                          indices_et);
+
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(2).compatible(indices_et),
+                          "offsets element type (",
+                          get_input_element_type(2),
+                          ") must match indices element type (",
+                          indices_et,
+                          ")");
+
+    NODE_VALIDATION_CHECK(this,
+                          indices_shape.rank().compatible(1),
+                          "indices are expected to be a vector");
+
+    NODE_VALIDATION_CHECK(
+        this, offsets_shape.rank().compatible(1), "offsets are expected to be a vector");
+
+    NODE_VALIDATION_CHECK(this,
+                          weights_shape.rank().compatible(2),
+                          "weights are expected to be a matrix");
+
+    if (has_per_sample_weights())
+    {
+        NODE_VALIDATION_CHECK(this,
+                              m_mode == Mode::SUM,
+                              "per_sample_weights are only supported in SUM mode");
+
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(3).compatible(result_et),
+                              "per_sample_weights element type (",
+                              get_input_element_type(3),
+                              ") must match weights element type (",
+                              result_et,
+                              ")");
+
+        NODE_VALIDATION_CHECK(this,
+                              get_input_partial_shape(3).compatible(indices_shape),
+                              "per_sample_weights shape (",
+                              get_input_partial_shape(3),
+                              ") must match indices shape (",
+                              indices_shape,
+                              ")");
+    }
+
+    Dimension bags = offsets_shape.rank().is_static() ? offsets_shape[0] : Dimension::dynamic();
+    Dimension embedding_length =
+        weights_shape.rank().is_static() ? weights_shape[1] : Dimension::dynamic();
+
+    set_output_type(0, result_et, PartialShape{bags, embedding_length});
+}
+
+shared_ptr<Node> op::EmbeddingBag::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 4)
+    {
+        return make_shared<EmbeddingBag>(
+            new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_mode);
+    }
+    return make_shared<EmbeddingBag>(new_args.at(0), new_args.at(1), new_args.at(2), m_mode);
+}
@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Looks up a bag of embeddings per sample and pools them into one vector.
+        ///
+        /// EmbeddingBag is the fusion of EmbeddingLookup with a reduction over each bag, so the
+        /// [indices, embedding length] intermediate is never materialized.
+        class EmbeddingBag : public Op
+        {
+        public:
+            NGRAPH_API
+            static const std::string type_name;
+            const std::string& description() const override { return type_name; }
+            enum class Mode
+            {
+                SUM,
+                MEAN,
+                MAX
+            };
+
+            /// \brief Constructs a EmbeddingBag operation.
+            EmbeddingBag() = default;
+            /// \brief Constructs a EmbeddingBag operation.
+            ///
+            /// Bag b covers indices[offsets[b]:offsets[b + 1]], the last bag running to the end
+            /// of indices. Each bag is reduced into row b of the [B, M] output; empty bags
+            /// produce zeros.
+            ///
+            /// \param indices 1D tensor of row indices into weights, `element::i32` or
+            ///                `element::i64`
+            /// \param weights is a dense matrix [N,M] where each row is an embedding of length M
+            /// \param offsets 1D tensor [B] with the start of each bag in indices; same element
+            ///                type as indices
+            /// \param mode How the embeddings of a bag are reduced
+            EmbeddingBag(const Output<Node>& indices,
+                         const Output<Node>& weights,
+                         const Output<Node>& offsets,
+                         Mode mode = Mode::SUM);
+            /// \brief Constructs a EmbeddingBag operation with per-sample weights.
+            ///
+            /// \param per_sample_weights 1D tensor with one scale per index, same element type
+            ///                           as weights. Only supported in SUM mode.
+            EmbeddingBag(const Output<Node>& indices,
+                         const Output<Node>& weights,
+                         const Output<Node>& offsets,
+                         const Output<Node>& per_sample_weights,
+                         Mode mode = Mode::SUM);
+
+            void validate_and_infer_types() override;
+
+            void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) override
+            {
+                throw ngraph_error("Not yet implemented");
+            }
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            Mode get_mode() const { return m_mode; }
+            bool has_per_sample_weights() const { return get_input_size() == 4; }
+        protected:
+            Mode m_mode{Mode::SUM};
+        };
+    }
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/op/convert.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -59,3 +60,17 @@ shared_ptr<Node> op::EmbeddingLookup::copy_with_new_args(const NodeVector& new_a
     check_new_args_count(this, new_args);
     return make_shared<EmbeddingLookup>(new_args.at(0), new_args.at(1));
 }
+
+void op::EmbeddingLookup::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    auto delta = deltas.at(0);
+    auto indices = get_argument(0);
+    auto weights = get_argument(1);
+
+    // Only the looked-up rows of weights receive a gradient; the indices have none
+    if (indices->get_element_type() != element::i32 && indices->get_element_type() != element::i64)
+    {
+        indices = make_shared<op::Convert>(indices, element::i64);
+    }
+    adjoints.add_sparse_delta(weights, indices, delta);
+}
@@ -49,10 +49,7 @@ namespace ngraph
 
             void validate_and_infer_types() override;
 
-            void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) override
-            {
-                throw ngraph_error("Not yet implemented");
-            }
+            void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) override;
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
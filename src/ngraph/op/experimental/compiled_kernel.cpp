@@ -57,27 +57,20 @@ shared_ptr<Node> ngraph::op::CompiledKernel::copy_with_new_args(const NodeVector
         new_outputs.push_back(nm.at(o.get()));
     }
 
-    return std::make_shared<CompiledKernel>(new_node_list, new_outputs, new_args);
+    return std::make_shared<CompiledKernel>(new_node_list, new_outputs, new_args, m_scratch_size);
 }
 
 ngraph::op::CompiledKernel::CompiledKernel(const NodeVector& node_list,
                                            const NodeVector& outputs,
-                                           const NodeVector& args)
+                                           const NodeVector& args,
+                                           size_t scratch_size)
     : Op("CompiledKernel", check_single_output_args({args}))
     , m_node_list(node_list)
     , m_output_nodes(outputs)
+    , m_scratch_size(scratch_size)
 {
     constructor_validate_and_infer_types();
-    set_output_size(m_output_nodes.size());
-
-    auto ref = node_list.at(0);
-    for (auto n : node_list)
-    {
-        if (n->get_shape() != ref->get_shape() || n->get_element_type() != ref->get_element_type())
-        {
-            throw ngraph_error("types and shapes of the nodes in node_list are different");
-        }
-    }
+    set_output_size(m_output_nodes.size() + (m_scratch_size != 0 ? 1 : 0));
 
     for (size_t i = 0; i < outputs.size(); ++i)
     {
@@ -89,4 +82,21 @@ ngraph::op::CompiledKernel::CompiledKernel(const NodeVector& node_list,
         }
         set_output_type(i, o->get_element_type(), o->get_shape());
     }
+    if (m_scratch_size != 0)
+    {
+        set_output_type(outputs.size(), element::u8, Shape{m_scratch_size});
+    }
+}
+
+bool ngraph::op::CompiledKernel::has_uniform_shape() const
+{
+    auto ref = m_node_list.at(0);
+    for (auto n : m_node_list)
+    {
+        if (n->get_shape() != ref->get_shape() || n->get_element_type() != ref->get_element_type())
+        {
+            return false;
+        }
+    }
+    return true;
 }
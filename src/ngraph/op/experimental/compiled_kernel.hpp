@@ -29,20 +29,34 @@ namespace ngraph
         /// This op can be used to delimit sub-graphs that with special compilation requirements
         /// within a function. For example, we currently use it to delimit sub-graphs that will be
         /// independently compiled and executed by MLIR backend.
+        ///
+        /// A kernel that needs memory for temporaries may request scratch_size bytes of it. The
+        /// scratch is an extra output, after the outputs of the sub-graph, so backends plan it
+        /// with their other intermediate tensors instead of allocating it when the kernel runs.
+        /// Like those of other ops with several outputs, the outputs of such a kernel are used
+        /// through GetOutputElement.
         class CompiledKernel : public ngraph::op::Op
         {
         public:
             CompiledKernel(const NodeVector& node_list,
                            const NodeVector& outputs,
-                           const NodeVector& args);
+                           const NodeVector& args,
+                           size_t scratch_size = 0);
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
             const NodeVector& get_node_list() const { return m_node_list; }
             const NodeVector& get_kernel_outputs() const { return m_output_nodes; }
+            /// \brief Returns true if all the nodes of the sub-graph have the same shape and
+            ///        element type, as needed to compile it into a single elementwise loop.
+            bool has_uniform_shape() const;
+            /// \brief Returns the size in bytes of the scratch output, or 0 if there is none.
+            size_t get_scratch_size() const { return m_scratch_size; }
+
         private:
             NodeVector m_node_list;
             NodeVector m_output_nodes;
+            size_t m_scratch_size;
         };
     }
 }
@@ -80,3 +80,13 @@ void op::Gather::validate_and_infer_types()
 
     set_output_type(0, result_et, result_shape);
 }
+
+void op::Gather::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    if (m_axis != 0)
+    {
+        throw ngraph_error("Gather adjoints are only implemented for axis 0");
+    }
+    // Only the gathered slices of params receive a gradient; the indices have none
+    adjoints.add_sparse_delta(get_argument(PARAMS), get_argument(INDICES), deltas.at(0));
+}
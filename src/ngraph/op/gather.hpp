@@ -40,10 +40,7 @@ namespace ngraph
 
             void validate_and_infer_types() override;
 
-            void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) override
-            {
-                throw ngraph_error("Not yet implemented");
-            }
+            void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) override;
 
             size_t get_axis() const { return m_axis; }
             virtual std::shared_ptr<Node>
@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct Bucket
+    {
+        vector<shared_ptr<op::AllReduce>> members;
+        size_t bytes = 0;
+        int64_t id = -1;
+    };
+
+    void fuse_bucket(const Bucket& bucket)
+    {
+        auto reduce_type = bucket.members.front()->get_reduce_type();
+        NodeVector flat_args;
+        for (auto& member : bucket.members)
+        {
+            auto arg = member->get_argument(0);
+            const Shape& shape = member->get_input_shape(0);
+            if (shape.size() == 1)
+            {
+                flat_args.push_back(arg);
+            }
+            else
+            {
+                flat_args.push_back(make_shared<op::Reshape>(
+                    arg, get_default_order(shape), Shape{shape_size(shape)}));
+            }
+        }
+        auto fused = make_shared<op::AllReduce>(make_shared<op::Concat>(flat_args, 0), reduce_type);
+        NGRAPH_DEBUG << "AllReduceBucketing: " << fused->get_name() << " reduces "
+                     << bucket.members.size() << " tensors, " << bucket.bytes << " bytes";
+
+        size_t offset = 0;
+        for (auto& member : bucket.members)
+        {
+            const Shape& shape = member->get_output_shape(0);
+            size_t count = shape_size(shape);
+            shared_ptr<Node> result =
+                make_shared<op::Slice>(fused, Coordinate{offset}, Coordinate{offset + count});
+            if (shape.size() != 1)
+            {
+                result = make_shared<op::Reshape>(result, AxisVector{0}, shape);
+            }
+            replace_node(member, result);
+            offset += count;
+        }
+    }
+}
+
+pass::AllReduceBucketing::AllReduceBucketing(size_t bucket_bytes)
+    : FunctionPass()
+    , m_bucket_bytes(bucket_bytes)
+{
+    if (m_bucket_bytes == 0)
+    {
+        const char* env = std::getenv("NGRAPH_ALLREDUCE_BUCKET_BYTES");
+        m_bucket_bytes = env != nullptr ? std::strtoull(env, nullptr, 10) : 0;
+        if (m_bucket_bytes == 0)
+        {
+            m_bucket_bytes = s_default_bucket_bytes;
+        }
+    }
+    set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+}
+
+bool pass::AllReduceBucketing::run_on_function(shared_ptr<Function> f)
+{
+    // Buckets are numbered in the order they are opened. For every node, latest_bucket holds
+    // the highest bucket an upstream AllReduce belongs to (-1 if none). An AllReduce may join
+    // an open bucket only if it does not depend on that bucket or on any bucket opened after
+    // it, so fusing never creates a cycle.
+    unordered_map<Node*, int64_t> latest_bucket;
+    map<pair<element::Type_t, reduction::Type>, Bucket> open_buckets;
+    vector<Bucket> buckets;
+    int64_t next_id = 0;
+
+    for (auto& node : f->get_ordered_ops())
+    {
+        int64_t dependency = -1;
+        for (auto& arg : node->get_arguments())
+        {
+            dependency = max(dependency, latest_bucket[arg.get()]);
+        }
+        latest_bucket[node.get()] = dependency;
+
+        auto allreduce = dynamic_pointer_cast<op::AllReduce>(node);
+        if (!allreduce || shape_size(allreduce->get_input_shape(0)) == 0)
+        {
+            continue;
+        }
+        size_t bytes = shape_size(allreduce->get_input_shape(0)) *
+                       allreduce->get_input_element_type(0).size();
+        auto key = make_pair(allreduce->get_input_element_type(0).get_type_enum(),
+                             allreduce->get_reduce_type());
+        Bucket& bucket = open_buckets[key];
+        if (!bucket.members.empty() &&
+            (dependency >= bucket.id || bucket.bytes + bytes > m_bucket_bytes))
+        {
+            buckets.push_back(move(bucket));
+            bucket = Bucket();
+        }
+        if (bucket.members.empty())
+        {
+            bucket.id = next_id++;
+        }
+        bucket.members.push_back(allreduce);
+        bucket.bytes += bytes;
+        latest_bucket[node.get()] = bucket.id;
+    }
+    for (auto& entry : open_buckets)
+    {
+        buckets.push_back(move(entry.second));
+    }
+
+    bool modified = false;
+    for (auto& bucket : buckets)
+    {
+        if (bucket.members.size() > 1)
+        {
+            fuse_bucket(bucket);
+            modified = true;
+        }
+    }
+    return modified;
+}
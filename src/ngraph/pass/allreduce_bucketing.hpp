@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Packs AllReduce ops into buckets that are each reduced by a single AllReduce.
+        ///
+        /// Data-parallel training graphs have one AllReduce per gradient, and for small
+        /// gradients each call is dominated by latency. AllReduces with the same element type
+        /// and reduction are grouped in the order their gradients are produced, which is the
+        /// reverse of the forward layer order. A bucket is closed when it would exceed the
+        /// bucket size, or when the next gradient depends on the result of an AllReduce
+        /// already in it. The gradients of a bucket are flattened and concatenated, reduced
+        /// once, and sliced back out. A backend that does concat and slice in place (like CPU)
+        /// adds no copies.
+        class AllReduceBucketing : public FunctionPass
+        {
+        public:
+            /// \param bucket_bytes Maximum bytes per bucket. If 0, uses
+            ///     NGRAPH_ALLREDUCE_BUCKET_BYTES if it is set, otherwise
+            ///     s_default_bucket_bytes.
+            AllReduceBucketing(size_t bucket_bytes = 0);
+
+            bool run_on_function(std::shared_ptr<Function> f) override;
+
+            static const size_t s_default_bucket_bytes = 25 * 1024 * 1024;
+
+        private:
+            size_t m_bucket_bytes;
+        };
+    }
+}
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <future>
+#include <set>
 #include <stdint.h>
 
 #include "constant_folding.hpp"
@@ -54,6 +57,7 @@
 #include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/runtime/reference/sqrt.hpp"
 #include "ngraph/runtime/reference/subtract.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -157,26 +161,26 @@ void pass::ConstantFolding::construct_constant_pad()
         auto type = constant_match->get_element_type();
         if (type == element::i32)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_pad<int>(constant_match, pad_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_pad<int>(constant_match, pad_match, func));
             return true;
         }
         else if (type == element::i8)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_pad<int8_t>(constant_match, pad_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_pad<int8_t>(constant_match, pad_match, func));
             return true;
         }
         else if (type == element::f32)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_pad<float>(constant_match, pad_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_pad<float>(constant_match, pad_match, func));
             return true;
         }
         else if (type == element::f64)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_pad<double>(constant_match, pad_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_pad<double>(constant_match, pad_match, func));
             return true;
         }
 
@@ -214,31 +218,31 @@ void pass::ConstantFolding::construct_constant_reshape()
         auto type = constant_match->get_element_type();
         if (type == element::i32)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_reshape<int>(constant_match, reshape_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_reshape<int>(constant_match, reshape_match, func));
             return true;
         }
         else if (type == element::i8)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_reshape<int8_t>(constant_match, reshape_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_reshape<int8_t>(constant_match, reshape_match, func));
             return true;
         }
         else if (type == element::f32)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_reshape<float>(constant_match, reshape_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_reshape<float>(constant_match, reshape_match, func));
             return true;
         }
         else if (type == element::f64)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_reshape<double>(constant_match, reshape_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_reshape<double>(constant_match, reshape_match, func));
             return true;
         }
         else if (type == element::bf16)
         {
-            replace_node(
+            replace_folded(
                 m.get_match_root(),
                 fold_constant_reshape<ngraph::bfloat16>(constant_match, reshape_match, func));
             return true;
@@ -310,31 +314,31 @@ void pass::ConstantFolding::construct_constant_broadcast()
         auto type = constant_match->get_element_type();
         if (type == element::i32)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_broadcast<int>(constant_match, broadcast_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_broadcast<int>(constant_match, broadcast_match, func));
             return true;
         }
         else if (type == element::i8)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_broadcast<int8_t>(constant_match, broadcast_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_broadcast<int8_t>(constant_match, broadcast_match, func));
             return true;
         }
         else if (type == element::f32)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_broadcast<float>(constant_match, broadcast_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_broadcast<float>(constant_match, broadcast_match, func));
             return true;
         }
         else if (type == element::f64)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_broadcast<double>(constant_match, broadcast_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_broadcast<double>(constant_match, broadcast_match, func));
             return true;
         }
         else if (type == element::bf16)
         {
-            replace_node(
+            replace_folded(
                 m.get_match_root(),
                 fold_constant_broadcast<ngraph::bfloat16>(constant_match, broadcast_match, func));
             return true;
@@ -461,26 +465,26 @@ void pass::ConstantFolding::construct_constant_binary()
         auto type = a_match->get_element_type();
         if (type == element::i32)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_binary<int>(a_match, b_match, binary_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_binary<int>(a_match, b_match, binary_match, func));
             return true;
         }
         else if (type == element::i8)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_binary<int8_t>(a_match, b_match, binary_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_binary<int8_t>(a_match, b_match, binary_match, func));
             return true;
         }
         else if (type == element::f32)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_binary<float>(a_match, b_match, binary_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_binary<float>(a_match, b_match, binary_match, func));
             return true;
         }
         else if (type == element::f64)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_binary<double>(a_match, b_match, binary_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_binary<double>(a_match, b_match, binary_match, func));
             return true;
         }
 
@@ -592,26 +596,26 @@ void pass::ConstantFolding::construct_constant_unary()
         auto type = constant_match->get_element_type();
         if (type == element::i32)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_unary<int>(constant_match, unary_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_unary<int>(constant_match, unary_match, func));
             return true;
         }
         else if (type == element::i8)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_unary<int8_t>(constant_match, unary_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_unary<int8_t>(constant_match, unary_match, func));
             return true;
         }
         else if (type == element::f32)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_unary<float>(constant_match, unary_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_unary<float>(constant_match, unary_match, func));
             return true;
         }
         else if (type == element::f64)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_unary<double>(constant_match, unary_match, func));
+            replace_folded(m.get_match_root(),
+                           fold_constant_unary<double>(constant_match, unary_match, func));
             return true;
         }
 
@@ -652,7 +656,7 @@ void pass::ConstantFolding::construct_constant_dequantize()
         make_shared<op::Dequantize>(constant_label, dq_scale, dq_offset, element::f32, AxisSet{});
     auto dequant = make_shared<pattern::op::Label>(dequant_op, nullptr, NodeVector{dequant_op});
 
-    auto constant_dequantize_callback = [constant_label, dequant](pattern::Matcher& m) {
+    auto constant_dequantize_callback = [this, constant_label, dequant](pattern::Matcher& m) {
         NGRAPH_DEBUG << "In callback for constant_dequantize_callback against node = "
                      << m.get_match_root()->get_name();
 
@@ -674,15 +678,15 @@ void pass::ConstantFolding::construct_constant_dequantize()
 
         if (type == element::u8)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_dequantize<uint8_t, float>(
+            replace_folded(m.get_match_root(),
+                           fold_constant_dequantize<uint8_t, float>(
                              constant_match, dequantize_op, scale, offset));
             return true;
         }
         else if (type == element::i8)
         {
-            replace_node(m.get_match_root(),
-                         fold_constant_dequantize<int8_t, float>(
+            replace_folded(m.get_match_root(),
+                           fold_constant_dequantize<int8_t, float>(
                              constant_match, dequantize_op, scale, offset));
             return true;
         }
@@ -728,7 +732,7 @@ void pass::ConstantFolding::construct_constant_quantize()
         make_shared<op::Quantize>(constant_label, q_scale, q_offset, element::i8, AxisSet{}, mode);
     auto quant = make_shared<pattern::op::Label>(quant_op, nullptr, NodeVector{quant_op});
 
-    auto constant_quantize_callback = [constant_label, quant](pattern::Matcher& m) {
+    auto constant_quantize_callback = [this, constant_label, quant](pattern::Matcher& m) {
         NGRAPH_DEBUG << "In callback for constant_quantize_callback against node = "
                      << m.get_match_root()->get_name();
 
@@ -750,14 +754,14 @@ void pass::ConstantFolding::construct_constant_quantize()
 
         if (type == element::u8)
         {
-            replace_node(
+            replace_folded(
                 m.get_match_root(),
                 fold_constant_quantize<float, uint8_t>(constant_match, quantize_op, scale, offset));
             return true;
         }
         else if (type == element::i8)
         {
-            replace_node(
+            replace_folded(
                 m.get_match_root(),
                 fold_constant_quantize<float, int8_t>(constant_match, quantize_op, scale, offset));
             return true;
@@ -901,7 +905,7 @@ void pass::ConstantFolding::construct_constant_convert()
         element::i32, Shape{2, 3, 4}, pattern::has_class<op::Constant>());
     auto convert_op = make_shared<op::Convert>(constant_label, element::i64);
 
-    auto constant_convert_callback = [constant_label](pattern::Matcher& m) {
+    auto constant_convert_callback = [this, constant_label](pattern::Matcher& m) {
         NGRAPH_DEBUG << "In callback for constant_convert_callback against node = "
                      << m.get_match_root()->get_name();
 
@@ -910,7 +914,7 @@ void pass::ConstantFolding::construct_constant_convert()
         auto constant_match = static_pointer_cast<op::Constant>(pattern_map[constant_label]);
         auto convert_match = static_pointer_cast<op::Convert>(m.get_match_root());
 
-        replace_node(
+        replace_folded(
             m.get_match_root(),
             fold_constant_convert(constant_match, convert_match->get_output_element_type(0)));
         return true;
@@ -928,7 +932,7 @@ void pass::ConstantFolding::construct_constant_shape_of()
     auto arg_label = make_shared<pattern::op::Label>(element::i32, Shape{2, 3, 4});
     auto shape_of_op = make_shared<op::ShapeOf>(arg_label);
 
-    auto constant_shape_of_callback = [arg_label](pattern::Matcher& m) {
+    auto constant_shape_of_callback = [this, arg_label](pattern::Matcher& m) {
         NGRAPH_DEBUG << "In callback for constant_shape_of_callback against node = "
                      << m.get_match_root()->get_name();
 
@@ -942,7 +946,7 @@ void pass::ConstantFolding::construct_constant_shape_of()
             auto replacement =
                 make_shared<op::Constant>(element::i64, Shape{arg_shape.size()}, arg_shape.data());
 
-            replace_node(m.get_match_root(), replacement);
+            replace_folded(m.get_match_root(), replacement);
 
             return true;
         }
@@ -956,3 +960,136 @@ void pass::ConstantFolding::construct_constant_shape_of()
         make_shared<pattern::Matcher>(shape_of_op, "ConstantFolding.ConstantShapeOf");
     this->add_matcher(shape_of_matcher, constant_shape_of_callback, all_pass_property_off);
 }
+
+void pass::ConstantFolding::replace_folded(const shared_ptr<Node>& node,
+                                           const shared_ptr<Node>& replacement)
+{
+    lock_guard<mutex> lock(m_folded_mutex);
+    m_folded[node.get()] = replacement;
+}
+
+bool pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    static const bool s_rerun_dynamic_check =
+        (getenv("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK") != nullptr);
+    // Held for the whole pass so that resizing the compile pool meanwhile cannot stop it
+    shared_ptr<runtime::ThreadPool> pool = runtime::ThreadPool::get_compile_pool();
+
+    // Position of every live node, used to keep each wave in topological order
+    vector<shared_ptr<Node>> ordered_ops;
+    unordered_map<Node*, size_t> position;
+    for (auto node : f->get_ordered_ops())
+    {
+        position[node.get()] = ordered_ops.size();
+        ordered_ops.push_back(node);
+    }
+    vector<shared_ptr<Node>> wave = ordered_ops;
+
+    bool rewritten = false;
+    while (!wave.empty())
+    {
+        bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+
+        // Matching is cheap and uses the shared matchers, so it stays on this thread. Each
+        // successful match is snapshotted for the callbacks to run on.
+        vector<shared_ptr<Node>> candidates;
+        vector<vector<pair<shared_ptr<pattern::Matcher>, graph_rewrite_callback>>> matches;
+        for (auto& node : wave)
+        {
+            vector<pair<shared_ptr<pattern::Matcher>, graph_rewrite_callback>> node_matches;
+            for (auto& closure : get_matchers())
+            {
+                if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+                {
+                    continue;
+                }
+                if (closure.matcher->match(node))
+                {
+                    node_matches.emplace_back(make_shared<pattern::Matcher>(*closure.matcher),
+                                              closure.callback);
+                }
+            }
+            if (!node_matches.empty())
+            {
+                candidates.push_back(node);
+                matches.push_back(move(node_matches));
+            }
+        }
+        if (candidates.empty())
+        {
+            break;
+        }
+
+        // The first callback that accepts its match folds the node, as in GraphRewrite
+        atomic<size_t> next{0};
+        auto fold = [&]() {
+            for (size_t i = next++; i < candidates.size(); i = next++)
+            {
+                for (auto& match : matches[i])
+                {
+                    if (match.second(*match.first))
+                    {
+                        break;
+                    }
+                }
+            }
+        };
+        size_t threads = pool ? min(pool->get_thread_count(), candidates.size()) : 1;
+        if (threads > 1)
+        {
+            vector<future<void>> done;
+            for (size_t t = 0; t < threads; t++)
+            {
+                done.push_back(pool->submit(fold));
+            }
+            // Let every task finish before an exception unwinds the state they share
+            for (auto& d : done)
+            {
+                d.wait();
+            }
+            for (auto& d : done)
+            {
+                d.get();
+            }
+        }
+        else
+        {
+            fold();
+        }
+
+        vector<shared_ptr<Node>> replacements;
+        for (auto& node : candidates)
+        {
+            auto it = m_folded.find(node.get());
+            if (it != m_folded.end())
+            {
+                ngraph::replace_node(node, it->second);
+                position.erase(node.get());
+                replacements.push_back(it->second);
+            }
+        }
+        m_folded.clear();
+        rewritten |= !replacements.empty();
+
+        set<size_t> next_wave;
+        for (auto& replacement : replacements)
+        {
+            for (auto& user : replacement->get_users())
+            {
+                auto user_position = position.find(user.get());
+                if (user_position != position.end())
+                {
+                    next_wave.insert(user_position->second);
+                }
+            }
+        }
+
+        // Only users of freshly folded nodes can become foldable
+        wave.clear();
+        for (size_t i : next_wave)
+        {
+            wave.push_back(ordered_ops[i]);
+        }
+    }
+    return rewritten;
+}
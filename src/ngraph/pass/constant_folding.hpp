@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <mutex>
+#include <unordered_map>
+
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/util.hpp"
 
@@ -82,6 +85,12 @@ public:
         }
     }
 
+    /// \brief Folds the function in waves. Each wave evaluates every node whose inputs are
+    ///     already constant, spread over the compile thread pool (see
+    ///     runtime::ThreadPool::set_compile_thread_count), then substitutes the results in
+    ///     topological order. The folded graph does not depend on the thread count.
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
 private:
     void construct_constant_reshape();
     void construct_constant_broadcast();
@@ -93,5 +102,12 @@ private:
     void construct_constant_convert();
     void construct_constant_shape_of();
 
+    /// \brief Records the folded value of \p node; called by the matcher callbacks, possibly
+    ///     from several threads at once.
+    void replace_folded(const std::shared_ptr<Node>& node,
+                        const std::shared_ptr<Node>& replacement);
+
     ngraph::BuildNodeExecutorMap m_cfmap;
+    std::mutex m_folded_mutex;
+    std::unordered_map<Node*, std::shared_ptr<Node>> m_folded;
 };
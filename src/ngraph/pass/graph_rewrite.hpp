@@ -71,13 +71,16 @@ public:
 protected:
     bool is_enabled(const std::shared_ptr<pattern::Matcher>& m) const;
 
-private:
     struct MatchClosure
     {
         std::shared_ptr<pattern::Matcher> matcher;
         ngraph::graph_rewrite_callback callback;
         PassPropertyMask property;
     };
+    /// \brief The matchers added so far, for passes that schedule the matching themselves.
+    const std::vector<MatchClosure>& get_matchers() const { return m_matchers; }
+
+private:
     std::vector<MatchClosure> m_matchers;
 };
 
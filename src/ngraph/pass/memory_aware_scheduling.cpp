@@ -0,0 +1,299 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/pass/memory_aware_scheduling.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Dependencies and temporary tensors of one op, indexed by its position in the original
+    // order
+    struct OpInfo
+    {
+        shared_ptr<Node> node;
+        vector<size_t> users;
+        size_t pending_deps{0};
+        vector<descriptor::Tensor*> inputs;
+        vector<descriptor::Tensor*> outputs;
+    };
+
+    class Scheduler
+    {
+    public:
+        Scheduler(const list<shared_ptr<Node>>& order,
+                  const unordered_set<descriptor::Tensor*>& persistent)
+        {
+            unordered_map<Node*, size_t> index;
+            for (const shared_ptr<Node>& node : order)
+            {
+                index[node.get()] = m_ops.size();
+                m_ops.push_back(OpInfo());
+                m_ops.back().node = node;
+            }
+            for (size_t i = 0; i < m_ops.size(); i++)
+            {
+                Node* node = m_ops[i].node.get();
+                unordered_set<size_t> deps;
+                for (auto& input : node->inputs())
+                {
+                    deps.insert(index.at(input.get_source_output().get_node()));
+                    descriptor::Tensor* tensor = &input.get_tensor();
+                    if (persistent.count(tensor) == 0 &&
+                        find(m_ops[i].inputs.begin(), m_ops[i].inputs.end(), tensor) ==
+                            m_ops[i].inputs.end())
+                    {
+                        m_ops[i].inputs.push_back(tensor);
+                        m_remaining_uses[tensor]++;
+                    }
+                }
+                for (const shared_ptr<Node>& dep : node->get_control_dependencies())
+                {
+                    deps.insert(index.at(dep.get()));
+                }
+                for (size_t dep : deps)
+                {
+                    m_ops[dep].users.push_back(i);
+                }
+                m_ops[i].pending_deps = deps.size();
+                for (auto& output : node->outputs())
+                {
+                    descriptor::Tensor* tensor = &output.get_tensor();
+                    if (persistent.count(tensor) == 0)
+                    {
+                        m_ops[i].outputs.push_back(tensor);
+                        m_remaining_uses[tensor];
+                    }
+                }
+            }
+        }
+
+        list<shared_ptr<Node>> schedule(bool lookahead)
+        {
+            vector<OpInfo> ops = m_ops;
+            unordered_map<descriptor::Tensor*, size_t> uses = m_remaining_uses;
+            vector<size_t> ready;
+            for (size_t i = 0; i < ops.size(); i++)
+            {
+                if (ops[i].pending_deps == 0)
+                {
+                    ready.push_back(i);
+                }
+            }
+
+            list<shared_ptr<Node>> result;
+            while (!ready.empty())
+            {
+                size_t best = 0;
+                int64_t best_score = numeric_limits<int64_t>::max();
+                for (size_t r = 0; r < ready.size(); r++)
+                {
+                    int64_t score = growth(ops[ready[r]], uses, nullptr);
+                    if (lookahead && score > 0)
+                    {
+                        score += min<int64_t>(0, best_unlocked_growth(ops, ready[r], uses));
+                    }
+                    // Ties go to the op that came first in the original order
+                    if (score < best_score ||
+                        (score == best_score && ready[r] < ready[best]))
+                    {
+                        best = r;
+                        best_score = score;
+                    }
+                }
+
+                size_t op = ready[best];
+                ready.erase(ready.begin() + best);
+                result.push_back(ops[op].node);
+                for (descriptor::Tensor* tensor : ops[op].inputs)
+                {
+                    uses[tensor]--;
+                }
+                for (size_t user : ops[op].users)
+                {
+                    if (--ops[user].pending_deps == 0)
+                    {
+                        ready.push_back(user);
+                    }
+                }
+            }
+            NGRAPH_CHECK(result.size() == m_ops.size());
+            return result;
+        }
+
+    private:
+        // Bytes op adds to the live memory: its outputs, less the outputs nothing uses and the
+        // inputs it is the last user of. If after is given, that op has already run.
+        static int64_t growth(const OpInfo& op,
+                              const unordered_map<descriptor::Tensor*, size_t>& uses,
+                              const OpInfo* after)
+        {
+            int64_t bytes = 0;
+            for (descriptor::Tensor* tensor : op.outputs)
+            {
+                if (uses.at(tensor) != 0)
+                {
+                    bytes += tensor->size();
+                }
+            }
+            for (descriptor::Tensor* tensor : op.inputs)
+            {
+                size_t remaining = uses.at(tensor);
+                if (after != nullptr &&
+                    find(after->inputs.begin(), after->inputs.end(), tensor) != after->inputs.end())
+                {
+                    remaining--;
+                }
+                if (remaining == 1)
+                {
+                    bytes -= tensor->size();
+                }
+            }
+            return bytes;
+        }
+
+        // Smallest growth of the ops that become ready once op has run
+        static int64_t best_unlocked_growth(const vector<OpInfo>& ops,
+                                            size_t op,
+                                            const unordered_map<descriptor::Tensor*, size_t>& uses)
+        {
+            int64_t best = numeric_limits<int64_t>::max();
+            for (size_t user : ops[op].users)
+            {
+                if (ops[user].pending_deps == 1)
+                {
+                    best = min(best, growth(ops[user], uses, &ops[op]));
+                }
+            }
+            return best;
+        }
+
+        vector<OpInfo> m_ops;
+        unordered_map<descriptor::Tensor*, size_t> m_remaining_uses;
+    };
+}
+
+// Pool size MemoryLayout plans for order, without in-place outputs
+static size_t simulate_pool_size(const list<shared_ptr<Node>>& order,
+                                 const unordered_set<descriptor::Tensor*>& persistent,
+                                 size_t alignment)
+{
+    unordered_map<descriptor::Tensor*, size_t> last_use;
+    size_t position = 0;
+    for (const shared_ptr<Node>& node : order)
+    {
+        for (auto& input : node->inputs())
+        {
+            last_use[&input.get_tensor()] = position;
+        }
+        for (auto& output : node->outputs())
+        {
+            last_use.insert({&output.get_tensor(), position});
+        }
+        position++;
+    }
+    vector<vector<descriptor::Tensor*>> free_at(order.size());
+    for (auto& use : last_use)
+    {
+        if (persistent.count(use.first) == 0)
+        {
+            free_at[use.second].push_back(use.first);
+        }
+    }
+
+    pass::MemoryManager mm(alignment);
+    unordered_map<descriptor::Tensor*, size_t> offsets;
+    position = 0;
+    for (const shared_ptr<Node>& node : order)
+    {
+        for (auto& output : node->outputs())
+        {
+            descriptor::Tensor* tensor = &output.get_tensor();
+            if (persistent.count(tensor) == 0)
+            {
+                offsets[tensor] = mm.allocate(tensor->size());
+            }
+        }
+        for (descriptor::Tensor* tensor : free_at[position])
+        {
+            mm.free(offsets.at(tensor));
+        }
+        position++;
+    }
+    return mm.max_allocated();
+}
+
+pass::MemoryAwareScheduling::MemoryAwareScheduling(size_t alignment)
+    : m_alignment(alignment)
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+}
+
+bool pass::MemoryAwareScheduling::run_on_function(shared_ptr<Function> f)
+{
+    // Same tensors as Liveness keeps out of the pool
+    unordered_set<descriptor::Tensor*> persistent;
+    list<shared_ptr<Node>> order = f->get_ordered_ops();
+    for (const shared_ptr<Node>& node : order)
+    {
+        if (node->is_parameter() || node->is_output() || node->is_constant())
+        {
+            for (auto& output : node->outputs())
+            {
+                persistent.insert(&output.get_tensor());
+            }
+        }
+    }
+
+    m_initial_pool_size = simulate_pool_size(order, persistent, m_alignment);
+    m_scheduled_pool_size = m_initial_pool_size;
+    list<shared_ptr<Node>> best_order;
+    Scheduler scheduler(order, persistent);
+    for (bool lookahead : {false, true})
+    {
+        list<shared_ptr<Node>> candidate = scheduler.schedule(lookahead);
+        size_t pool_size = simulate_pool_size(candidate, persistent, m_alignment);
+        if (pool_size < m_scheduled_pool_size)
+        {
+            m_scheduled_pool_size = pool_size;
+            best_order = move(candidate);
+        }
+    }
+
+    NGRAPH_DEBUG << "MemoryAwareScheduling " << f->get_name() << ": pool size "
+                 << m_initial_pool_size << " -> " << m_scheduled_pool_size << " bytes";
+    if (best_order.empty())
+    {
+        return false;
+    }
+    f->set_ordered_ops(best_order);
+    return true;
+}
@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Reorders ops to reduce the size of the temporary memory pool.
+        ///
+        /// The order of a function's ops decides which intermediate tensors are live at the
+        /// same time, and so how large the pool planned by MemoryLayout must be. Wide graphs,
+        /// like U-Nets, DenseNets or multi-branch encoders, can need much less memory when
+        /// each branch is finished before the next one starts. The schedule is built greedily:
+        /// the ready op that grows the live memory the least runs next, looking one op ahead
+        /// when every ready op grows it. The pool size of the current and the new order is
+        /// simulated with the first-fit allocator of MemoryLayout, and the new order is only
+        /// kept if its pool is smaller. The order is set with Function::set_ordered_ops, so
+        /// it holds for the passes and the executor that follow.
+        class MemoryAwareScheduling : public FunctionPass
+        {
+        public:
+            /// \param alignment Alignment of the simulated pool, as for MemoryLayout
+            MemoryAwareScheduling(size_t alignment = 1);
+
+            bool run_on_function(std::shared_ptr<Function> f) override;
+
+            /// \brief Simulated pool size of the order the function had before the last run
+            size_t get_initial_pool_size() const { return m_initial_pool_size; }
+            /// \brief Simulated pool size of the order the function has after the last run
+            size_t get_scheduled_pool_size() const { return m_scheduled_pool_size; }
+        private:
+            size_t m_alignment;
+            size_t m_initial_pool_size{0};
+            size_t m_scheduled_pool_size{0};
+        };
+    }
+}
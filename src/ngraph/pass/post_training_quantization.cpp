@@ -0,0 +1,764 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/experimental/quantized_avg_pool.hpp"
+#include "ngraph/op/experimental/quantized_conv.hpp"
+#include "ngraph/op/experimental/quantized_conv_bias.hpp"
+#include "ngraph/op/experimental/quantized_conv_relu.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
+#include "ngraph/op/experimental/quantized_dot_bias.hpp"
+#include "ngraph/op/experimental/quantized_max_pool.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/pass/post_training_quantization.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // A Convolution or Dot with constant weights and the bias Add and Relu that follow it
+    struct QuantizableChain
+    {
+        shared_ptr<Node> anchor;
+        shared_ptr<op::Constant> weights;
+        shared_ptr<op::Constant> bias;
+        shared_ptr<Node> bias_broadcast;
+        shared_ptr<Node> output;
+        bool with_relu;
+    };
+
+    shared_ptr<Node> get_single_user(const shared_ptr<Node>& node)
+    {
+        auto users = node->get_users();
+        return users.size() == 1 ? users[0] : nullptr;
+    }
+
+    // Returns the bias if add adds a constant, broadcast along channel_axis, to input
+    shared_ptr<op::Constant> match_bias(const shared_ptr<Node>& add,
+                                        const shared_ptr<Node>& input,
+                                        size_t channel_axis)
+    {
+        if (!dynamic_pointer_cast<op::Add>(add))
+        {
+            return nullptr;
+        }
+        auto other = add->get_argument(0) == input ? add->get_argument(1) : add->get_argument(0);
+        auto broadcast = dynamic_pointer_cast<op::Broadcast>(other);
+        if (!broadcast)
+        {
+            return nullptr;
+        }
+        auto bias = dynamic_pointer_cast<op::Constant>(broadcast->get_argument(0));
+        const Shape& shape = input->get_shape();
+        if (!bias || bias->get_element_type() != element::f32 ||
+            bias->get_shape() != Shape{shape[channel_axis]})
+        {
+            return nullptr;
+        }
+        AxisSet broadcast_axes;
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            if (i != channel_axis)
+            {
+                broadcast_axes.insert(i);
+            }
+        }
+        return broadcast->get_broadcast_axes() == broadcast_axes ? bias : nullptr;
+    }
+
+    bool match_chain(const shared_ptr<Node>& node, QuantizableChain& chain)
+    {
+        if (dynamic_pointer_cast<op::Convolution>(node))
+        {
+            if (node->get_input_shape(0).size() != 4)
+            {
+                return false;
+            }
+        }
+        else if (auto dot = dynamic_pointer_cast<op::Dot>(node))
+        {
+            if (node->get_input_shape(0).size() != 2 || node->get_input_shape(1).size() != 2 ||
+                dot->get_reduction_axes_count() != 1)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+        auto weights = dynamic_pointer_cast<op::Constant>(node->get_argument(1));
+        if (node->get_element_type() != element::f32 || !weights)
+        {
+            return false;
+        }
+
+        // Both chains have their channels on axis 1
+        const size_t channel_axis = 1;
+        chain = QuantizableChain{node, weights, nullptr, nullptr, node, false};
+        auto user = get_single_user(chain.output);
+        if (user)
+        {
+            if (auto bias = match_bias(user, chain.output, channel_axis))
+            {
+                chain.bias = bias;
+                chain.bias_broadcast = user->get_argument(0) == chain.output
+                                           ? user->get_argument(1)
+                                           : user->get_argument(0);
+                chain.output = user;
+                user = get_single_user(user);
+            }
+        }
+        if (user && dynamic_pointer_cast<op::Relu>(user))
+        {
+            chain.with_relu = true;
+            chain.output = user;
+        }
+        return true;
+    }
+
+    float max_abs(const pass::QuantizationRange& range)
+    {
+        return max(fabs(range.min), fabs(range.max));
+    }
+
+    // Scale of the symmetric quantization of [-max_abs, max_abs] to type
+    float get_scale(float max_abs, const element::Type& type)
+    {
+        float levels = type == element::u8 ? 255.0f : 127.0f;
+        return max_abs > 0 ? max_abs / levels : 1.0f;
+    }
+
+    // Quantizes weights to i8, with one scale per slice along axis 0 if per_channel is set
+    vector<float> quantize_weights(const op::Constant& weights,
+                                   bool per_channel,
+                                   vector<int8_t>& quantized)
+    {
+        vector<float> values = weights.get_vector<float>();
+        size_t channels = per_channel ? weights.get_shape()[0] : 1;
+        size_t channel_size = values.size() / channels;
+        vector<float> scales(channels);
+        quantized.resize(values.size());
+        for (size_t c = 0; c < channels; c++)
+        {
+            auto begin = values.begin() + c * channel_size;
+            float channel_max = 0;
+            for (auto it = begin; it != begin + channel_size; ++it)
+            {
+                channel_max = max(channel_max, fabs(*it));
+            }
+            scales[c] = get_scale(channel_max, element::i8);
+            for (size_t i = c * channel_size; i < (c + 1) * channel_size; i++)
+            {
+                float q = nearbyint(values[i] / scales[c]);
+                quantized[i] = static_cast<int8_t>(min(127.0f, max(-127.0f, q)));
+            }
+        }
+        return scales;
+    }
+
+    // The chain's input in type. The quantized output of a previous chain is used directly
+    // when the chain input is its Dequantize.
+    shared_ptr<Node>
+        quantize_input(const shared_ptr<Node>& input, const element::Type& type, float& scale)
+    {
+        auto dequantize = dynamic_pointer_cast<op::Dequantize>(input);
+        if (dequantize && dequantize->get_axes().empty() &&
+            dequantize->get_input_element_type(0) == type)
+        {
+            auto dq_scale = dynamic_pointer_cast<op::Constant>(dequantize->get_argument(1));
+            auto dq_zero_point = dynamic_pointer_cast<op::Constant>(dequantize->get_argument(2));
+            if (dq_scale && dq_zero_point && dq_zero_point->get_vector<int8_t>()[0] == 0)
+            {
+                scale = dq_scale->get_vector<float>()[0];
+                return dequantize->get_argument(0);
+            }
+        }
+        return make_shared<op::Quantize>(input,
+                                         op::Constant::create(element::f32, Shape{}, {scale}),
+                                         op::Constant::create(type, Shape{}, {0}),
+                                         type,
+                                         AxisSet{},
+                                         op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+    }
+
+    shared_ptr<Node> dequantize_output(const shared_ptr<Node>& output, float scale)
+    {
+        return make_shared<op::Dequantize>(
+            output,
+            op::Constant::create(element::f32, Shape{}, {scale}),
+            op::Constant::create(output->get_element_type(), Shape{}, {0}),
+            element::f32,
+            AxisSet{});
+    }
+
+    shared_ptr<Node> quantize_chain(const QuantizableChain& chain,
+                                    const pass::QuantizationRange& input_range,
+                                    const pass::QuantizationRange& output_range,
+                                    bool simulate)
+    {
+        // MKLDNN's int8 convolutions and inner products only read u8 data, and quantizing a
+        // signed input to u8 would clip its negative half, so such chains stay f32
+        if (input_range.min < 0)
+        {
+            return nullptr;
+        }
+        auto conv = dynamic_pointer_cast<op::Convolution>(chain.anchor);
+        element::Type input_type = element::u8;
+        element::Type output_type = chain.with_relu ? element::u8 : element::i8;
+        float input_scale = get_scale(max_abs(input_range), input_type);
+        float output_scale = get_scale(max_abs(output_range), output_type);
+        shared_ptr<Node> input = chain.anchor->get_argument(0);
+        if (simulate)
+        {
+            // Round-trip through the int8 grid, keeping this chain's own input scale
+            input = dequantize_output(quantize_input(input, input_type, input_scale), input_scale);
+        }
+        else
+        {
+            input = quantize_input(input, input_type, input_scale);
+        }
+
+        // QuantizedDot takes a single requantization scale, so only convolution weights are
+        // quantized per output channel
+        vector<int8_t> weights;
+        vector<float> weight_scales = quantize_weights(*chain.weights, conv != nullptr, weights);
+        size_t channels = chain.anchor->get_shape()[1];
+        vector<float> requantization_scales(weight_scales.size());
+        vector<int32_t> bias(chain.bias ? channels : 0);
+        vector<float> bias_values = chain.bias ? chain.bias->get_vector<float>() : vector<float>{};
+        for (size_t c = 0; c < weight_scales.size(); c++)
+        {
+            requantization_scales[c] = input_scale * weight_scales[c] / output_scale;
+        }
+        for (size_t c = 0; c < bias.size(); c++)
+        {
+            float bias_scale = input_scale * weight_scales[weight_scales.size() == 1 ? 0 : c];
+            bias[c] = static_cast<int32_t>(nearbyint(bias_values[c] / bias_scale));
+            bias_values[c] = bias[c] * bias_scale;
+        }
+
+        if (simulate)
+        {
+            const Shape& weights_shape = chain.weights->get_shape();
+            size_t channel_size = weights.size() / weight_scales.size();
+            vector<float> weight_values(weights.size());
+            for (size_t i = 0; i < weights.size(); i++)
+            {
+                weight_values[i] = weights[i] * weight_scales[i / channel_size];
+            }
+            shared_ptr<Node> output = chain.anchor->copy_with_new_args(
+                {input, op::Constant::create(element::f32, weights_shape, weight_values)});
+            if (chain.bias)
+            {
+                auto bias_constant =
+                    op::Constant::create(element::f32, chain.bias->get_shape(), bias_values);
+                output = make_shared<op::Add>(
+                    output, chain.bias_broadcast->copy_with_new_args({bias_constant}));
+            }
+            if (chain.with_relu)
+            {
+                output = make_shared<op::Relu>(output);
+            }
+            float scale = output_scale;
+            return dequantize_output(quantize_input(output, output_type, scale), output_scale);
+        }
+
+        auto weights_constant =
+            op::Constant::create(element::i8, chain.weights->get_shape(), weights);
+        auto bias_constant = op::Constant::create(element::i32, Shape{bias.size()}, bias);
+        auto scale_constant = op::Constant::create(
+            element::f32,
+            conv ? Shape{requantization_scales.size()} : Shape{},
+            requantization_scales);
+        shared_ptr<Node> quantized;
+        if (conv && chain.bias)
+        {
+            quantized = make_shared<op::QuantizedConvolutionBias>(
+                input,
+                weights_constant,
+                bias_constant,
+                conv->get_window_movement_strides(),
+                conv->get_window_dilation_strides(),
+                conv->get_padding_below(),
+                conv->get_padding_above(),
+                conv->get_data_dilation_strides(),
+                scale_constant,
+                chain.with_relu);
+        }
+        else if (conv && chain.with_relu)
+        {
+            quantized = make_shared<op::QuantizedConvolutionRelu>(
+                input,
+                weights_constant,
+                conv->get_window_movement_strides(),
+                conv->get_window_dilation_strides(),
+                conv->get_padding_below(),
+                conv->get_padding_above(),
+                conv->get_data_dilation_strides(),
+                scale_constant);
+        }
+        else if (conv)
+        {
+            quantized = make_shared<op::QuantizedConvolution>(
+                input,
+                weights_constant,
+                conv->get_window_movement_strides(),
+                conv->get_window_dilation_strides(),
+                conv->get_padding_below(),
+                conv->get_padding_above(),
+                conv->get_data_dilation_strides(),
+                scale_constant);
+        }
+        else if (chain.bias)
+        {
+            // QuantizedDotBias takes its weights transposed, as {output channels, inputs}
+            const Shape& weights_shape = chain.weights->get_shape();
+            vector<int8_t> transposed(weights.size());
+            for (size_t i = 0; i < weights_shape[0]; i++)
+            {
+                for (size_t j = 0; j < weights_shape[1]; j++)
+                {
+                    transposed[j * weights_shape[0] + i] = weights[i * weights_shape[1] + j];
+                }
+            }
+            weights_constant = op::Constant::create(
+                element::i8, Shape{weights_shape[1], weights_shape[0]}, transposed);
+            quantized = make_shared<op::QuantizedDotBias>(
+                input, weights_constant, bias_constant, scale_constant, true, chain.with_relu);
+        }
+        else
+        {
+            quantized = make_shared<op::QuantizedDot>(
+                input, weights_constant, scale_constant, true, chain.with_relu);
+        }
+        return dequantize_output(quantized, output_scale);
+    }
+
+    // Pooling of the Dequantize of quantized data, pooled in the quantized domain
+    shared_ptr<Node> quantize_pool(const shared_ptr<Node>& pool)
+    {
+        auto dequantize = dynamic_pointer_cast<op::Dequantize>(pool->get_argument(0));
+        if (!dequantize || !dequantize->get_axes().empty() ||
+            pool->get_input_shape(0).size() != 4)
+        {
+            return nullptr;
+        }
+        shared_ptr<Node> quantized;
+        if (auto max_pool = dynamic_pointer_cast<op::MaxPool>(pool))
+        {
+            quantized = make_shared<op::QuantizedMaxPool>(dequantize->get_argument(0),
+                                                          max_pool->get_window_shape(),
+                                                          max_pool->get_window_movement_strides(),
+                                                          max_pool->get_padding_below(),
+                                                          max_pool->get_padding_above());
+        }
+        else if (auto avg_pool = dynamic_pointer_cast<op::AvgPool>(pool))
+        {
+            quantized = make_shared<op::QuantizedAvgPool>(
+                dequantize->get_argument(0),
+                avg_pool->get_window_shape(),
+                avg_pool->get_window_movement_strides(),
+                avg_pool->get_padding_below(),
+                avg_pool->get_padding_above(),
+                avg_pool->get_include_padding_in_avg_computation());
+        }
+        else
+        {
+            return nullptr;
+        }
+        return make_shared<op::Dequantize>(quantized,
+                                           dequantize->get_argument(1),
+                                           dequantize->get_argument(2),
+                                           element::f32,
+                                           AxisSet{});
+    }
+
+    vector<shared_ptr<runtime::Tensor>>
+        copy_to_backend(const shared_ptr<runtime::Backend>& backend,
+                        const vector<shared_ptr<runtime::Tensor>>& tensors)
+    {
+        vector<shared_ptr<runtime::Tensor>> copies;
+        vector<char> data;
+        for (const shared_ptr<runtime::Tensor>& tensor : tensors)
+        {
+            auto copy = backend->create_tensor(tensor->get_element_type(), tensor->get_shape());
+            data.resize(tensor->get_size_in_bytes());
+            tensor->read(data.data(), data.size());
+            copy->write(data.data(), data.size());
+            copies.push_back(copy);
+        }
+        return copies;
+    }
+
+    vector<shared_ptr<runtime::Tensor>> create_outputs(const shared_ptr<runtime::Backend>& backend,
+                                                       const Function& f)
+    {
+        vector<shared_ptr<runtime::Tensor>> outputs;
+        for (size_t i = 0; i < f.get_output_size(); i++)
+        {
+            outputs.push_back(
+                backend->create_tensor(f.get_output_element_type(i), f.get_output_shape(i)));
+        }
+        return outputs;
+    }
+
+    void read_values(const runtime::Tensor& tensor, vector<float>& values)
+    {
+        NGRAPH_CHECK(tensor.get_element_type() == element::f32,
+                     "Quantization expects f32 tensors, got ",
+                     tensor.get_element_type());
+        values.resize(shape_size(tensor.get_shape()));
+        tensor.read(values.data(), values.size() * sizeof(float));
+    }
+
+    // The ops of f in post-order of a depth first walk over arguments from the results. Unlike
+    // get_ordered_ops, which follows users, the order does not depend on node addresses and is
+    // the same for clones of f.
+    NodeVector get_structural_order(const Function& f)
+    {
+        NodeVector order;
+        unordered_set<Node*> visited;
+        vector<pair<shared_ptr<Node>, size_t>> stack;
+        for (const shared_ptr<Node>& result : f.get_results())
+        {
+            if (!visited.insert(result.get()).second)
+            {
+                continue;
+            }
+            stack.emplace_back(result, 0);
+            while (!stack.empty())
+            {
+                shared_ptr<Node> node = stack.back().first;
+                size_t next = stack.back().second++;
+                if (next < node->get_input_size())
+                {
+                    shared_ptr<Node> arg = node->get_argument(next);
+                    if (visited.insert(arg.get()).second)
+                    {
+                        stack.emplace_back(arg, 0);
+                    }
+                }
+                else
+                {
+                    order.push_back(node);
+                    stack.pop_back();
+                }
+            }
+        }
+        return order;
+    }
+
+    // TensorRT-style entropy calibration: the number of histogram bins, counted from zero,
+    // to keep unclipped so that the 128-level quantization of the clipped histogram diverges
+    // the least from the histogram
+    size_t find_kl_threshold_bins(const vector<double>& histogram)
+    {
+        const size_t levels = 128;
+        size_t bins = histogram.size();
+        size_t best_bins = bins;
+        double best_divergence = numeric_limits<double>::max();
+        vector<double> p;
+        vector<double> q;
+        for (size_t i = levels; i <= bins; i++)
+        {
+            p.assign(histogram.begin(), histogram.begin() + i);
+            p[i - 1] += accumulate(histogram.begin() + i, histogram.end(), 0.0);
+            q.assign(i, 0.0);
+            for (size_t level = 0; level < levels; level++)
+            {
+                size_t begin = level * i / levels;
+                size_t end = (level + 1) * i / levels;
+                double sum = 0;
+                size_t nonzero = 0;
+                for (size_t j = begin; j < end; j++)
+                {
+                    sum += histogram[j];
+                    nonzero += histogram[j] != 0 ? 1 : 0;
+                }
+                for (size_t j = begin; j < end; j++)
+                {
+                    q[j] = histogram[j] != 0 ? sum / nonzero : 0;
+                }
+            }
+            double p_sum = accumulate(p.begin(), p.end(), 0.0);
+            double q_sum = accumulate(q.begin(), q.end(), 0.0);
+            if (p_sum == 0 || q_sum == 0)
+            {
+                continue;
+            }
+            double divergence = 0;
+            for (size_t j = 0; j < i; j++)
+            {
+                if (p[j] > 0)
+                {
+                    double pj = p[j] / p_sum;
+                    double qj = max(q[j] / q_sum, 1e-12);
+                    divergence += pj * log(pj / qj);
+                }
+            }
+            if (divergence < best_divergence)
+            {
+                best_divergence = divergence;
+                best_bins = i;
+            }
+        }
+        return best_bins;
+    }
+}
+
+pass::PostTrainingQuantization::PostTrainingQuantization(const QuantizationRanges& ranges,
+                                                         bool simulate)
+    : m_ranges(ranges)
+    , m_simulate(simulate)
+{
+}
+
+bool pass::PostTrainingQuantization::run_on_function(shared_ptr<Function> f)
+{
+    // Chains are matched and their ranges looked up before any rewriting, since rewriting a
+    // chain replaces the input of the next one
+    struct Rewrite
+    {
+        shared_ptr<Node> node;
+        QuantizableChain chain;
+        QuantizationRange input_range;
+        QuantizationRange output_range;
+    };
+    NodeVector calibration_nodes = get_calibration_nodes(f);
+    NGRAPH_CHECK(calibration_nodes.size() == m_ranges.size(),
+                 "Function has ",
+                 calibration_nodes.size(),
+                 " tensors to calibrate but ",
+                 m_ranges.size(),
+                 " ranges were given; were they calibrated on another function?");
+    unordered_map<Node*, QuantizationRange> ranges;
+    for (size_t i = 0; i < calibration_nodes.size(); i++)
+    {
+        ranges[calibration_nodes[i].get()] = m_ranges[i];
+    }
+
+    vector<Rewrite> rewrites;
+    for (const shared_ptr<Node>& node : f->get_ordered_ops())
+    {
+        Rewrite rewrite{node, QuantizableChain{}, QuantizationRange{}, QuantizationRange{}};
+        if (match_chain(node, rewrite.chain))
+        {
+            rewrite.input_range = ranges.at(node->get_argument(0).get());
+            rewrite.output_range = ranges.at(rewrite.chain.output.get());
+            rewrites.push_back(rewrite);
+        }
+        else if (!m_simulate && (dynamic_pointer_cast<op::MaxPool>(node) ||
+                                 dynamic_pointer_cast<op::AvgPool>(node)))
+        {
+            rewrites.push_back(rewrite);
+        }
+    }
+
+    m_quantized_op_count = 0;
+    for (const Rewrite& rewrite : rewrites)
+    {
+        shared_ptr<Node> replaced = rewrite.chain.anchor ? rewrite.chain.output : rewrite.node;
+        shared_ptr<Node> replacement =
+            rewrite.chain.anchor
+                ? quantize_chain(
+                      rewrite.chain, rewrite.input_range, rewrite.output_range, m_simulate)
+                : quantize_pool(rewrite.node);
+        if (replacement)
+        {
+            NGRAPH_DEBUG << "Quantized " << rewrite.node->get_name();
+            replace_node(replaced, replacement);
+            m_quantized_op_count++;
+        }
+    }
+    return m_quantized_op_count > 0;
+}
+
+NodeVector pass::PostTrainingQuantization::get_calibration_nodes(const shared_ptr<Function>& f)
+{
+    NodeVector nodes;
+    auto add = [&nodes](const shared_ptr<Node>& node) {
+        if (find(nodes.begin(), nodes.end(), node) == nodes.end())
+        {
+            nodes.push_back(node);
+        }
+    };
+    for (const shared_ptr<Node>& node : get_structural_order(*f))
+    {
+        QuantizableChain chain;
+        if (match_chain(node, chain))
+        {
+            add(node->get_argument(0));
+            add(chain.output);
+        }
+    }
+    return nodes;
+}
+
+pass::QuantizationRanges pass::PostTrainingQuantization::calibrate(
+    const shared_ptr<Function>& f,
+    const shared_ptr<runtime::Backend>& backend,
+    const vector<vector<shared_ptr<runtime::Tensor>>>& batches,
+    CalibrationMethod method)
+{
+    NodeVector nodes = get_calibration_nodes(f);
+
+    // Run a clone of f that also returns every calibrated tensor
+    NodeMap node_map;
+    auto clone = clone_function(*f, node_map);
+    ResultVector results = clone->get_results();
+    for (const shared_ptr<Node>& node : nodes)
+    {
+        results.push_back(make_shared<op::Result>(node_map.at(node.get())));
+    }
+    auto observed = make_shared<Function>(results, clone->get_parameters());
+    auto executable = backend->compile(observed);
+    auto outputs = create_outputs(backend, *observed);
+    size_t first = f->get_output_size();
+    vector<float> values;
+    auto run = [&](function<void(size_t, const vector<float>&)> visit) {
+        for (const vector<shared_ptr<runtime::Tensor>>& batch : batches)
+        {
+            executable->call(outputs, copy_to_backend(backend, batch));
+            for (size_t i = 0; i < nodes.size(); i++)
+            {
+                read_values(*outputs[first + i], values);
+                visit(i, values);
+            }
+        }
+    };
+
+    vector<QuantizationRange> ranges(
+        nodes.size(),
+        QuantizationRange{numeric_limits<float>::max(), numeric_limits<float>::lowest()});
+    run([&](size_t i, const vector<float>& tensor_values) {
+        for (float value : tensor_values)
+        {
+            ranges[i].min = min(ranges[i].min, value);
+            ranges[i].max = max(ranges[i].max, value);
+        }
+    });
+
+    if (method == CalibrationMethod::KL_DIVERGENCE)
+    {
+        const size_t bins = 2048;
+        vector<vector<double>> histograms(nodes.size(), vector<double>(bins, 0.0));
+        run([&](size_t i, const vector<float>& tensor_values) {
+            float range = max_abs(ranges[i]);
+            if (range == 0)
+            {
+                return;
+            }
+            for (float value : tensor_values)
+            {
+                size_t bin = static_cast<size_t>(fabs(value) / range * bins);
+                histograms[i][min(bin, bins - 1)]++;
+            }
+        });
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            float threshold = find_kl_threshold_bins(histograms[i]) * max_abs(ranges[i]) / bins;
+            ranges[i].min = max(ranges[i].min, -threshold);
+            ranges[i].max = min(ranges[i].max, threshold);
+        }
+    }
+
+    return ranges;
+}
+
+vector<pass::QuantizationAccuracy> pass::PostTrainingQuantization::compare_accuracy(
+    const shared_ptr<Function>& reference,
+    const shared_ptr<runtime::Backend>& reference_backend,
+    const shared_ptr<Function>& quantized,
+    const shared_ptr<runtime::Backend>& quantized_backend,
+    const vector<vector<shared_ptr<runtime::Tensor>>>& batches)
+{
+    NGRAPH_CHECK(reference->get_output_size() == quantized->get_output_size(),
+                 "Reference and quantized functions have different outputs");
+    auto reference_executable = reference_backend->compile(reference);
+    auto quantized_executable = quantized_backend->compile(quantized);
+    auto reference_outputs = create_outputs(reference_backend, *reference);
+    auto quantized_outputs = create_outputs(quantized_backend, *quantized);
+
+    size_t output_count = reference->get_output_size();
+    vector<QuantizationAccuracy> accuracy(output_count, QuantizationAccuracy{0, 0, 0, 0});
+    vector<double> squared_error(output_count, 0);
+    vector<double> squared_reference(output_count, 0);
+    vector<size_t> count(output_count, 0);
+    vector<float> expected;
+    vector<float> actual;
+    for (const vector<shared_ptr<runtime::Tensor>>& batch : batches)
+    {
+        reference_executable->call(reference_outputs, copy_to_backend(reference_backend, batch));
+        quantized_executable->call(quantized_outputs, copy_to_backend(quantized_backend, batch));
+        for (size_t i = 0; i < output_count; i++)
+        {
+            read_values(*reference_outputs[i], expected);
+            read_values(*quantized_outputs[i], actual);
+            for (size_t j = 0; j < expected.size(); j++)
+            {
+                double error = fabs(static_cast<double>(actual[j]) - expected[j]);
+                accuracy[i].max_abs_error = max(accuracy[i].max_abs_error, error);
+                accuracy[i].mean_abs_error += error;
+                squared_error[i] += error * error;
+                squared_reference[i] += static_cast<double>(expected[j]) * expected[j];
+            }
+            count[i] += expected.size();
+        }
+    }
+    for (size_t i = 0; i < output_count; i++)
+    {
+        accuracy[i].output = i;
+        accuracy[i].mean_abs_error /= max<size_t>(count[i], 1);
+        accuracy[i].relative_error =
+            squared_reference[i] > 0 ? sqrt(squared_error[i] / squared_reference[i]) : 0;
+    }
+    return accuracy;
+}
+
+ostream& pass::operator<<(ostream& out, const vector<QuantizationAccuracy>& accuracy)
+{
+    out << setw(8) << "output" << setw(16) << "max abs error" << setw(16) << "mean abs error"
+        << setw(16) << "relative error" << "\n";
+    for (const QuantizationAccuracy& output : accuracy)
+    {
+        out << setw(8) << output.output << setw(16) << output.max_abs_error << setw(16)
+            << output.mean_abs_error << setw(16) << output.relative_error << "\n";
+    }
+    return out;
+}
@@ -0,0 +1,122 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Range of the values of a tensor seen during calibration
+        struct QuantizationRange
+        {
+            float min;
+            float max;
+        };
+
+        /// \brief Calibrated ranges, one per node of PostTrainingQuantization::
+        ///        get_calibration_nodes and in the same order
+        using QuantizationRanges = std::vector<QuantizationRange>;
+
+        /// \brief How the range of a tensor is derived from the calibration data
+        enum class CalibrationMethod
+        {
+            /// The observed minimum and maximum
+            MIN_MAX,
+            /// The saturation threshold that minimizes the Kullback-Leibler divergence between
+            /// the histogram of the values and its 8-bit quantization, which clips outliers
+            KL_DIVERGENCE
+        };
+
+        /// \brief Accuracy of one output of a quantized function against the f32 function
+        struct QuantizationAccuracy
+        {
+            size_t output;
+            double max_abs_error;
+            double mean_abs_error;
+            /// ||quantized - reference|| / ||reference||, over all batches
+            double relative_error;
+        };
+
+        /// \brief Post-training int8 quantization of an f32 function.
+        ///
+        /// Rewrites Convolution (2D) and Dot chains with constant weights, each optionally
+        /// followed by a broadcast bias Add and a Relu, into QuantizedConvolution{,Bias,Relu}
+        /// and QuantizedDot{,Bias}. The chain input is quantized to u8, the weights to i8 (per
+        /// output channel for convolutions) and the bias to i32, all symmetrically. Chains
+        /// whose input has a negative calibrated minimum stay f32, since the int8 kernels
+        /// only take u8 data. The weights and the
+        /// requantization scales are folded into constants. Each chain ends in a Dequantize,
+        /// and a chain whose input is the Dequantize of another chain reads its quantized
+        /// output directly. MaxPool and AvgPool of a quantized chain's output become
+        /// QuantizedMaxPool and QuantizedAvgPool.
+        ///
+        /// With simulate set, the ops stay f32 and the chain input, weights, bias and output
+        /// are rounded to their int8/int32 grids instead (fake quantization), so the accuracy
+        /// of the quantized function can be measured on backends without int8 kernels.
+        ///
+        /// The ranges come from calibrate(), which runs calibration batches through the f32
+        /// function, and compare_accuracy() reports the error of the quantized function. They
+        /// are matched to the function by position, so ranges calibrated on a function apply
+        /// to its clones, and running the pass on a function of another structure throws.
+        class PostTrainingQuantization : public FunctionPass
+        {
+        public:
+            PostTrainingQuantization(const QuantizationRanges& ranges, bool simulate = false);
+
+            bool run_on_function(std::shared_ptr<Function> f) override;
+
+            /// \brief Number of Convolution, Dot and pooling ops quantized by the last run
+            size_t get_quantized_op_count() const { return m_quantized_op_count; }
+            /// \brief Nodes whose output ranges the pass needs from calibration, in an order
+            ///        that only depends on the structure of f
+            static NodeVector get_calibration_nodes(const std::shared_ptr<Function>& f);
+
+            /// \brief Runs batches of inputs through f on backend and records the range of
+            ///        each tensor returned by get_calibration_nodes, in that order.
+            /// \param batches One vector of input tensors, in parameter order, per batch
+            static QuantizationRanges
+                calibrate(const std::shared_ptr<Function>& f,
+                          const std::shared_ptr<runtime::Backend>& backend,
+                          const std::vector<std::vector<std::shared_ptr<runtime::Tensor>>>& batches,
+                          CalibrationMethod method = CalibrationMethod::MIN_MAX);
+
+            /// \brief Runs batches through the f32 function and the quantized function, each on
+            ///        its backend, and compares their outputs.
+            static std::vector<QuantizationAccuracy> compare_accuracy(
+                const std::shared_ptr<Function>& reference,
+                const std::shared_ptr<runtime::Backend>& reference_backend,
+                const std::shared_ptr<Function>& quantized,
+                const std::shared_ptr<runtime::Backend>& quantized_backend,
+                const std::vector<std::vector<std::shared_ptr<runtime::Tensor>>>& batches);
+
+        private:
+            QuantizationRanges m_ranges;
+            bool m_simulate;
+            size_t m_quantized_op_count{0};
+        };
+
+        std::ostream& operator<<(std::ostream& out,
+                                 const std::vector<QuantizationAccuracy>& accuracy);
+    }
+}
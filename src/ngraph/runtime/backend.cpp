@@ -14,12 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
 #include <sstream>
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
+#include "ngraph/runtime/memoize/memoize_backend.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -40,14 +42,17 @@ std::shared_ptr<runtime::Backend> runtime::Backend::create(const string& type,
 {
     auto inner_backend = BackendManager::create_backend(type);
 
-    if (!must_support_dynamic || inner_backend->supports_dynamic_tensors())
+    if (must_support_dynamic && !inner_backend->supports_dynamic_tensors())
     {
-        return inner_backend;
+        inner_backend = make_shared<runtime::dynamic::DynamicBackend>(inner_backend);
     }
-    else
+    if (std::getenv("NGRAPH_MEMOIZE") != nullptr)
     {
-        return make_shared<runtime::dynamic::DynamicBackend>(inner_backend);
+        const char* hash_inputs = std::getenv("NGRAPH_MEMOIZE_HASH_INPUTS");
+        return make_shared<runtime::memoize::MemoizeBackend>(
+            inner_backend, hash_inputs != nullptr && string(hash_inputs) != "0");
     }
+    return inner_backend;
 }
 
 vector<string> runtime::Backend::get_registered_devices()
@@ -17,6 +17,7 @@
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_collective_executor.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -51,6 +52,29 @@ namespace ngraph
                     node->get_friendly_name().c_str(),
                     count);
 
+                if (external_function->is_async_collectives())
+                {
+                    // Start the AllReduce on the communication thread. The executor waits for
+                    // it before the first op that reads its result or reuses its buffers.
+                    auto slot = external_function->add_async_collective(node);
+                    auto functor = [&,
+                                    count,
+                                    reduce_type,
+                                    data_type,
+                                    arg_buffer_index,
+                                    out_buffer_index,
+                                    slot](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        void* in = ctx->buffer_data[arg_buffer_index];
+                        void* out = ctx->buffer_data[out_buffer_index];
+                        ctx->collective_tickets[slot] = ctx->collective_executor->start([=]() {
+                            get_distributed_interface()->all_reduce(
+                                in, out, data_type, reduce_type, count);
+                        });
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 auto functor =
                     [&, count, reduce_type, data_type, arg_buffer_index, out_buffer_index](
                         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
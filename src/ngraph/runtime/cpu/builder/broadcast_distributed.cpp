@@ -16,6 +16,7 @@
 
 #include "ngraph/op/broadcast_distributed.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_collective_executor.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -36,6 +37,20 @@ namespace ngraph
                 auto data_type = args[0].get_element_type().get_type_enum();
                 auto broadcast = static_cast<const ngraph::op::BroadcastDistributed*>(node);
                 auto root_id = broadcast->get_root_id();
+                if (external_function->is_async_collectives())
+                {
+                    // Keep the broadcast in order with AllReduces still queued on the
+                    // communication thread
+                    auto functor = [&, count, data_type, arg_buffer_index, root_id](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        void* in = ctx->buffer_data[arg_buffer_index];
+                        ctx->collective_executor->run([=]() {
+                            get_distributed_interface()->broadcast(in, data_type, count, root_id);
+                        });
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
                 auto functor = [&, count, data_type, arg_buffer_index, root_id](
                     CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                     get_distributed_interface()->broadcast(
@@ -53,6 +53,10 @@ namespace ngraph
             {
                 const ngraph::op::CompiledKernel* hs =
                     static_cast<const ngraph::op::CompiledKernel*>(node);
+                if (!hs->has_uniform_shape())
+                {
+                    throw ngraph_error("types and shapes of the nodes in node_list are different");
+                }
 
                 const auto& generators = ngraph::runtime::cpu::halide::get_halide_generators();
 
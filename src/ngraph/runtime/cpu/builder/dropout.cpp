@@ -28,6 +28,46 @@ namespace ngraph
     {
         namespace cpu
         {
+            template <typename T>
+            static CPUKernelFunctor make_dropout_functor(size_t element_count,
+                                                         size_t arg_buffer_index,
+                                                         size_t arg1_buffer_index,
+                                                         size_t arg4_buffer_index,
+                                                         size_t out0_buffer_index,
+                                                         size_t out1_buffer_index,
+                                                         size_t state_index,
+                                                         bool use_seed,
+                                                         uint64_t seed,
+                                                         bool packed_mask)
+            {
+                return [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    bool training =
+                        static_cast<bool>(static_cast<T*>(ctx->buffer_data[arg1_buffer_index])[0]);
+                    double keep_prob = static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
+                    // As in GenerateMask, a seeded mask is the same on every execution and an
+                    // unseeded one continues the stream of the node's RNGState
+                    uint64_t key = seed;
+                    uint64_t offset = 0;
+                    if (!use_seed)
+                    {
+                        auto state = static_cast<RNGState*>(ctx->states[state_index]);
+                        key = state->get_seed();
+                        offset = state->advance(element_count);
+                    }
+                    void* mask = ctx->buffer_data[out1_buffer_index];
+                    runtime::cpu::kernel::generate_dropout(
+                        static_cast<T*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<T*>(ctx->buffer_data[out0_buffer_index]),
+                        packed_mask ? nullptr : static_cast<T*>(mask),
+                        packed_mask ? static_cast<uint8_t*>(mask) : nullptr,
+                        element_count,
+                        training,
+                        keep_prob,
+                        key,
+                        offset);
+                };
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Dropout)
             {
@@ -45,88 +85,101 @@ namespace ngraph
                 size_t element_count = out[0].get_size();
 
                 bool use_seed = drop->get_use_seed();
+                uint64_t seed = drop->get_seed();
+                bool packed_mask = drop->get_packed_mask();
+
+                // Unlike GenerateMask, whose unseeded stream always starts from seed 0, each
+                // unseeded Dropout draws its stream's seed once here
+                auto state_seed = use_seed ? seed : static_cast<uint64_t>(rand());
+                auto state_index = external_function->add_state(
+                    ngraph::RNGState::create_rng_state(state_seed, drop->get_keep_prob()));
 
-                // Note: for performance optimization in addition to parallel RNG with multiple,
-                // threads, we create, initialize and advance each msr here in builder instead of
-                // in kernel. By doing so here, we saved 30% vs. kernel
-                // msr.discard() has the biggest impact on performance.
-                // But we need discard only when use_seed==true to generate same mask.
-                size_t nthr = ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
-                size_t chunk_size = (element_count + nthr - 1) / nthr;
-                std::vector<std::minstd_rand> vmsr(nthr);
-                if (use_seed)
+                if (args[0].get_element_type() == element::f32)
                 {
-                    uint64_t seed = drop->get_seed();
-                    for (size_t i = 0; i < nthr; i++)
-                    {
-                        std::minstd_rand msr;
-                        msr.seed(seed);
-                        msr.discard(i * chunk_size);
-                        vmsr[i] = msr;
-                    }
+                    functor = make_dropout_functor<float>(element_count,
+                                                          arg_buffer_index,
+                                                          arg1_buffer_index,
+                                                          arg4_buffer_index,
+                                                          out0_buffer_index,
+                                                          out1_buffer_index,
+                                                          state_index,
+                                                          use_seed,
+                                                          seed,
+                                                          packed_mask);
                 }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    functor = make_dropout_functor<double>(element_count,
+                                                           arg_buffer_index,
+                                                           arg1_buffer_index,
+                                                           arg4_buffer_index,
+                                                           out0_buffer_index,
+                                                           out1_buffer_index,
+                                                           state_index,
+                                                           use_seed,
+                                                           seed,
+                                                           packed_mask);
+                }
+                else
+                {
+                    throw ngraph_error(std::string("Unsupported type") +
+                                       args[0].get_element_type().c_type_string() + "for Dropout");
+                }
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DropoutBackprop)
+            {
+                auto& functors = external_function->get_functors();
+                CPUKernelFunctor functor;
+
+                auto delta_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto mask_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t element_count = out[0].get_size();
 
                 if (args[0].get_element_type() == element::f32)
                 {
                     functor = [&,
                                element_count,
-                               arg_buffer_index,
-                               arg1_buffer_index,
-                               arg4_buffer_index,
-                               out0_buffer_index,
-                               out1_buffer_index,
-                               vmsr,
-                               use_seed](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        bool training = static_cast<bool>(
-                            static_cast<float*>(ctx->buffer_data[arg1_buffer_index])[0]);
-                        double keep_prob =
-                            static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
-                        runtime::cpu::kernel::generate_dropout(
-                            static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                            static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
-                            static_cast<float*>(ctx->buffer_data[out1_buffer_index]),
-                            element_count,
-                            training,
-                            keep_prob,
-                            vmsr,
-                            use_seed);
+                               delta_buffer_index,
+                               mask_buffer_index,
+                               out_buffer_index](CPURuntimeContext* ctx,
+                                                 CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::dropout_backprop(
+                            static_cast<float*>(ctx->buffer_data[delta_buffer_index]),
+                            static_cast<uint8_t*>(ctx->buffer_data[mask_buffer_index]),
+                            static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                            element_count);
                     };
                 }
                 else if (args[0].get_element_type() == element::f64)
                 {
                     functor = [&,
                                element_count,
-                               arg_buffer_index,
-                               arg1_buffer_index,
-                               arg4_buffer_index,
-                               out0_buffer_index,
-                               out1_buffer_index,
-                               vmsr,
-                               use_seed](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        bool training = static_cast<bool>(
-                            static_cast<double*>(ctx->buffer_data[arg1_buffer_index])[0]);
-                        double keep_prob =
-                            static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
-                        runtime::cpu::kernel::generate_dropout(
-                            static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                            static_cast<double*>(ctx->buffer_data[out0_buffer_index]),
-                            static_cast<double*>(ctx->buffer_data[out1_buffer_index]),
-                            element_count,
-                            training,
-                            keep_prob,
-                            vmsr,
-                            use_seed);
+                               delta_buffer_index,
+                               mask_buffer_index,
+                               out_buffer_index](CPURuntimeContext* ctx,
+                                                 CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::dropout_backprop(
+                            static_cast<double*>(ctx->buffer_data[delta_buffer_index]),
+                            static_cast<uint8_t*>(ctx->buffer_data[mask_buffer_index]),
+                            static_cast<double*>(ctx->buffer_data[out_buffer_index]),
+                            element_count);
                     };
                 }
                 else
                 {
                     throw ngraph_error(std::string("Unsupported type") +
-                                       args[0].get_element_type().c_type_string() + "for Dropout");
+                                       args[0].get_element_type().c_type_string() +
+                                       "for DropoutBackprop");
                 }
                 functors.emplace_back(functor);
             }
 
             REGISTER_OP_BUILDER(Dropout);
+            REGISTER_OP_BUILDER(DropoutBackprop);
         }
     }
 }
@@ -0,0 +1,106 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/embedding_bag.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_bag.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::EmbeddingBag)
+            {
+                auto& functors = external_function->get_functors();
+                auto bag = static_cast<const ngraph::op::EmbeddingBag*>(node);
+
+                auto indices_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto weights_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto offsets_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                bool has_per_sample_weights = bag->has_per_sample_weights();
+                size_t per_sample_weights_buffer_index =
+                    has_per_sample_weights
+                        ? external_function->get_buffer_index(args[3].get_name())
+                        : 0;
+
+                auto element_type = out[0].get_element_type();
+                auto index_element_type = args[0].get_element_type();
+                std::function<decltype(runtime::cpu::kernel::embedding_bag<float, int32_t>)>
+                    kernel;
+                if (element_type == element::f32 && index_element_type == element::i32)
+                {
+                    kernel = runtime::cpu::kernel::embedding_bag<float, int32_t>;
+                }
+                else if (element_type == element::f32 && index_element_type == element::i64)
+                {
+                    kernel = runtime::cpu::kernel::embedding_bag<float, int64_t>;
+                }
+                else if (element_type == element::f64 && index_element_type == element::i32)
+                {
+                    kernel = runtime::cpu::kernel::embedding_bag<double, int32_t>;
+                }
+                else if (element_type == element::f64 && index_element_type == element::i64)
+                {
+                    kernel = runtime::cpu::kernel::embedding_bag<double, int64_t>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type in CPU Builder for EmbeddingBag");
+                }
+
+                size_t indices_count = shape_size(args[0].get_shape());
+                size_t bag_count = shape_size(args[2].get_shape());
+                size_t vec_len = out[0].get_shape().at(1);
+                auto mode = bag->get_mode();
+
+                auto functor = [&,
+                                kernel,
+                                indices_count,
+                                bag_count,
+                                vec_len,
+                                mode,
+                                has_per_sample_weights,
+                                indices_buffer_index,
+                                weights_buffer_index,
+                                offsets_buffer_index,
+                                per_sample_weights_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[indices_buffer_index],
+                           ctx->buffer_data[weights_buffer_index],
+                           ctx->buffer_data[offsets_buffer_index],
+                           has_per_sample_weights
+                               ? ctx->buffer_data[per_sample_weights_buffer_index]
+                               : nullptr,
+                           ctx->buffer_data[out_buffer_index],
+                           indices_count,
+                           bag_count,
+                           vec_len,
+                           mode);
+                };
+                functors.emplace_back(functor);
+            }
+            REGISTER_OP_BUILDER(EmbeddingBag);
+        }
+    }
+}
@@ -53,11 +53,16 @@ namespace ngraph
                     buffer_indices.push_back(buffer_index);
                 }
 
-                // Create functor that will be executed to compile and run this CompiledKernel.
-                // Note that 'double_ptr_args' must be captured by value since it's a local var.
-                auto functor = [node, buffer_indices](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* ectx) {
+                // Compile nodes within the CompiledKernel op once, when the function is built. The
+                // functor only runs the jitted code on the tensors of each call. Its temporaries
+                // live in the scratch output, which is planned with the other intermediates, so
+                // concurrent runtime contexts share the compiler but none of the memory it uses.
+                auto* compiled_kernel = static_cast<const CompiledKernel*>(node);
+                auto mlir_compiler = std::make_shared<MLIRCompiler>(compiled_kernel);
+                mlir_compiler->compile();
 
+                auto functor = [mlir_compiler, buffer_indices](CPURuntimeContext* ctx,
+                                                               CPUExecutionContext* ectx) {
                     // MLIR requires a list of type-erased pointer to arguments. Tensors must have
                     // been allocated at this point so we can get rid of the extra reference.
                     std::vector<void*> ptr_args;
@@ -65,14 +70,7 @@ namespace ngraph
                     {
                         ptr_args.push_back(ctx->buffer_data[buffer_index]);
                     }
-
-                    // Compile nodes within the CompiledKernel op.
-                    auto* compiled_kernel = static_cast<const CompiledKernel*>(node);
-
-                    MLIRCompiler mlir_compiler(compiled_kernel, ptr_args);
-                    // TODO: Decouple 'compile' and 'run' APIs. We want to be able to run the same
-                    // jitted code on different arguments.
-                    mlir_compiler.compile_and_run();
+                    mlir_compiler->run(ptr_args);
                 };
 
                 functors.emplace_back(functor);
@@ -29,6 +29,29 @@ namespace ngraph
     {
         namespace cpu
         {
+            template <typename IndicesType>
+            static decltype(&runtime::cpu::kernel::scatter_add<float, IndicesType>)
+                get_scatter_add_kernel(const element::Type& element_type)
+            {
+                if (element_type == element::f64)
+                {
+                    return runtime::cpu::kernel::scatter_add<double, IndicesType>;
+                }
+                else if (element_type == element::f32)
+                {
+                    return runtime::cpu::kernel::scatter_add<float, IndicesType>;
+                }
+                else if (element_type == element::u8)
+                {
+                    return runtime::cpu::kernel::scatter_add<uint8_t, IndicesType>;
+                }
+                else if (element_type == element::i8)
+                {
+                    return runtime::cpu::kernel::scatter_add<int8_t, IndicesType>;
+                }
+                throw ngraph_error("Unsupported type in CPU Builder for ScatterAdd");
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::ScatterAdd)
             {
@@ -39,105 +62,42 @@ namespace ngraph
                 auto updates_buffer_index = external_function->get_buffer_index(args[2].get_name());
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
-                if (args[1].get_element_type() != element::i64 &&
-                    args[1].get_element_type() != element::i32)
-                {
-                    throw ngraph_error("Unsupported index element type");
-                }
-
-                if (args[0].get_element_type() != element::f64 &&
-                    args[0].get_element_type() != element::f32 &&
-                    args[0].get_element_type() != element::u8 &&
-                    args[0].get_element_type() != element::i8)
+                std::function<void(void*, void*, void*, void*, const Shape&, const Shape&, int)>
+                    kernel;
+                if (args[1].get_element_type() == element::i64)
                 {
-                    throw ngraph_error("Unsupported type in CPU Builder for ScatterAdd");
+                    kernel = get_scatter_add_kernel<int64_t>(args[0].get_element_type());
                 }
-
-                bool is_int64 = args[1].get_element_type() == element::i64;
-                auto inputs_shape = args[0].get_shape();
-                auto indices_shape = args[1].get_shape();
-                auto updates_shape = args[2].get_shape();
-                auto out_shape = out[0].get_shape();
-                auto element_type = args[0].get_element_type();
-
-                if (is_int64)
+                else if (args[1].get_element_type() == element::i32)
                 {
-                    if (inputs_shape.size() <= 3 && updates_shape.size() <= 3)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::scatter_add_i64<float, 2, 2>)>
-                            kernel;
-
-                        SELECT_KERNEL_BY_2RANKS(kernel,
-                                                args[0].get_element_type(),
-                                                inputs_shape.size(),
-                                                updates_shape.size(),
-                                                runtime::cpu::kernel::scatter_add_i64);
-
-                        auto functor = [&,
-                                        kernel,
-                                        inputs_shape,
-                                        indices_shape,
-                                        updates_shape,
-                                        inputs_buffer_index,
-                                        indices_buffer_index,
-                                        updates_buffer_index,
-                                        out_buffer_index](CPURuntimeContext* ctx,
-                                                          CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[inputs_buffer_index],
-                                   ctx->buffer_data[indices_buffer_index],
-                                   ctx->buffer_data[updates_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   ectx->arena);
-                        };
-                        functors.emplace_back(functor);
-                    }
-                    else
-                    {
-                        throw ngraph_error("Unsupported ranks in CPU Builder for ScatterAdd");
-                    }
+                    kernel = get_scatter_add_kernel<int32_t>(args[0].get_element_type());
                 }
                 else
                 {
-                    if (inputs_shape.size() <= 3 && updates_shape.size() <= 3)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::scatter_add_i32<float, 2, 2>)>
-                            kernel;
+                    throw ngraph_error("Unsupported index element type");
+                }
 
-                        SELECT_KERNEL_BY_2RANKS(kernel,
-                                                args[0].get_element_type(),
-                                                inputs_shape.size(),
-                                                updates_shape.size(),
-                                                runtime::cpu::kernel::scatter_add_i32);
+                auto inputs_shape = args[0].get_shape();
+                auto indices_shape = args[1].get_shape();
 
-                        auto functor = [&,
-                                        kernel,
-                                        inputs_shape,
-                                        indices_shape,
-                                        updates_shape,
-                                        inputs_buffer_index,
-                                        indices_buffer_index,
-                                        updates_buffer_index,
-                                        out_buffer_index](CPURuntimeContext* ctx,
-                                                          CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[inputs_buffer_index],
-                                   ctx->buffer_data[indices_buffer_index],
-                                   ctx->buffer_data[updates_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   ectx->arena);
-                        };
-                        functors.emplace_back(functor);
-                    }
-                    else
-                    {
-                        throw ngraph_error("Unsupported ranks in CPU Builder for ScatterAdd");
-                    }
-                }
+                auto functor = [&,
+                                kernel,
+                                inputs_shape,
+                                indices_shape,
+                                inputs_buffer_index,
+                                indices_buffer_index,
+                                updates_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[inputs_buffer_index],
+                           ctx->buffer_data[indices_buffer_index],
+                           ctx->buffer_data[updates_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           inputs_shape,
+                           indices_shape,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
             }
             REGISTER_OP_BUILDER(ScatterAdd);
         }
@@ -16,7 +16,7 @@
 
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/cpu/kernel/dropout.hpp"
 #include "ngraph/state/rng_state.hpp"
 
 using namespace std;
@@ -72,23 +72,21 @@ namespace ngraph
                             static_cast<uint64_t*>(ctx->buffer_data[arg3_buffer_index])[0];
                         double prob = static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
 
+                        uint64_t offset = 0;
                         if (use_seed == false)
                         {
-                            reference::generate_mask(
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                static_cast<RNGState*>(ctx->states[index]),
-                                training);
-                        }
-                        else
-                        {
-                            reference::generate_mask_no_state(
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                training,
-                                seed,
-                                prob);
+                            auto state = static_cast<RNGState*>(ctx->states[index]);
+                            seed = state->get_seed();
+                            prob = state->get_probability();
+                            offset = state->advance(element_count);
                         }
+                        runtime::cpu::kernel::generate_mask(
+                            static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                            element_count,
+                            training,
+                            seed,
+                            prob,
+                            offset);
                     };
                 }
                 else if (args[0].get_element_type() == element::f64)
@@ -111,23 +109,21 @@ namespace ngraph
                             static_cast<uint64_t*>(ctx->buffer_data[arg3_buffer_index])[0];
                         double prob = static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
 
+                        uint64_t offset = 0;
                         if (use_seed == false)
                         {
-                            reference::generate_mask(
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                static_cast<RNGState*>(ctx->states[index]),
-                                training);
-                        }
-                        else
-                        {
-                            reference::generate_mask_no_state(
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                training,
-                                seed,
-                                prob);
+                            auto state = static_cast<RNGState*>(ctx->states[index]);
+                            seed = state->get_seed();
+                            prob = state->get_probability();
+                            offset = state->advance(element_count);
                         }
+                        runtime::cpu::kernel::generate_mask(
+                            static_cast<double*>(ctx->buffer_data[out_buffer_index]),
+                            element_count,
+                            training,
+                            seed,
+                            prob,
+                            offset);
                     };
                 }
                 else
@@ -23,6 +23,7 @@
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/util.hpp"
 
 #ifdef NGRAPH_MLIR_ENABLE
@@ -133,6 +134,10 @@ runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
         instance.m_external_function->m_emit_timing = performance_counters_enabled;
         auto cf = instance.m_external_function->make_call_frame(pass_config);
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        if (std::getenv("NGRAPH_CPU_WARMUP_AT_COMPILE") != nullptr)
+        {
+            m_warmup_microseconds = instance.m_call_frame->warmup();
+        }
     }
     set_parameters_and_results(*func);
 }
@@ -160,6 +165,22 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
     return rc;
 }
 
+future<bool>
+    runtime::cpu::CPU_Executable::call_async(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    FunctionInstance& instance = m_function_instance;
+    if (instance.m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before call_async().");
+    }
+
+    call_once(m_call_pool_init, [this, &instance]() {
+        m_call_pool.reset(new ThreadPool(instance.m_call_frame->get_num_ctx()));
+    });
+    return m_call_pool->submit([this, outputs, inputs]() { return call(outputs, inputs); });
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable> exec)
 {
     std::lock_guard<std::mutex> guard(m_exec_map_mutex);
@@ -199,3 +220,19 @@ bool runtime::cpu::CPU_Backend::is_supported_property(const Property prop) const
 
     return false;
 }
+
+runtime::cpu::MKLDNNPrimitiveCacheStats
+    runtime::cpu::CPU_Backend::get_mkldnn_primitive_cache_stats()
+{
+    return MKLDNNPrimitiveCache::instance().get_stats();
+}
+
+void runtime::cpu::CPU_Backend::set_mkldnn_primitive_cache_size(size_t size)
+{
+    MKLDNNPrimitiveCache::instance().set_capacity(size);
+}
+
+size_t runtime::cpu::CPU_Backend::get_mkldnn_primitive_cache_size()
+{
+    return MKLDNNPrimitiveCache::instance().get_capacity();
+}
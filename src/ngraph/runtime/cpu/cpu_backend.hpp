@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -23,6 +24,7 @@
 #include "cpu_backend_visibility.h"
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 
 namespace ngraph
 {
@@ -33,6 +35,19 @@ namespace ngraph
             class CPU_ExternalFunction;
             class CPU_CallFrame;
 
+            /// \brief Counters of the MKLDNN primitive cache shared by all CPU executables
+            struct MKLDNNPrimitiveCacheStats
+            {
+                size_t hits;
+                size_t misses;
+                /// Time spent creating primitive descriptors on misses
+                int64_t build_time_us;
+                double get_hit_rate() const
+                {
+                    return hits + misses == 0 ? 0.0 : double(hits) / (hits + misses);
+                }
+            };
+
             class CPU_BACKEND_API CPU_Backend : public runtime::Backend
             {
             public:
@@ -63,6 +78,14 @@ namespace ngraph
                 bool is_supported(const Node& node) const override;
                 bool is_supported_property(const Property prop) const override;
 
+                /// \brief Hits and misses of the process-wide MKLDNN primitive cache, through
+                ///     which executables with identical layers share primitive descriptors.
+                static MKLDNNPrimitiveCacheStats get_mkldnn_primitive_cache_stats();
+                /// \brief Sets how many primitive descriptors the cache keeps; 0, the default
+                ///     unless NGRAPH_MKLDNN_PRIMITIVE_CACHE_SIZE is set, disables it.
+                static void set_mkldnn_primitive_cache_size(size_t size);
+                static size_t get_mkldnn_primitive_cache_size();
+
             private:
                 // this mutex will be used to protect the addition and deletion
                 // of function to m_exec_map across multiple threads
@@ -80,8 +103,19 @@ namespace ngraph
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+                /// \brief Runs call() on a pool with one thread per runtime context so that
+                ///     up to NGRAPH_CPU_CONCURRENCY requests execute concurrently.
+                std::future<bool>
+                    call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                /// \brief Time compile() spent warming up runtime contexts. Warmup is enabled
+                ///     by setting NGRAPH_CPU_WARMUP_AT_COMPILE, and skipped for functions with
+                ///     ops that warmup cannot run safely.
+                size_t get_warmup_microseconds() const { return m_warmup_microseconds; }
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
             private:
@@ -92,6 +126,11 @@ namespace ngraph
                     std::shared_ptr<CPU_CallFrame> m_call_frame = nullptr;
                     bool m_performance_counters_enabled = false;
                 } m_function_instance;
+                size_t m_warmup_microseconds = 0;
+
+                // Declared last so queued executions drain before the call frame is destroyed
+                std::once_flag m_call_pool_init;
+                std::unique_ptr<ThreadPool> m_call_pool;
             };
         }
     }
@@ -15,14 +15,20 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstring>
 #include <thread>
+#include <unordered_set>
 
+#include "ngraph/log.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_collective_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -84,8 +90,11 @@ void runtime::cpu::CPU_CallFrame::inner_call(
         }
         else
         {
-            m_ctx_vec[id]->p_en[i] = tv->get_stale();
+            // Inputs written since the last call are recomputed even if not marked stale
+            m_ctx_vec[id]->p_en[i] =
+                tv->get_stale() || tv->get_version() != m_input_versions[id][i];
         }
+        m_input_versions[id][i] = tv->get_version();
 
         inputs.push_back(tv->get_data_ptr());
     }
@@ -158,6 +167,145 @@ void runtime::cpu::CPU_CallFrame::call(
     m_cv.notify_one();
 }
 
+// Warmup runs the compiled function on zero-filled scratch tensors, so it is limited to ops
+// whose kernels only read their inputs, write their outputs and are defined for zero inputs.
+// Collectives, random number generators, division, quantization (whose primitives take their
+// scales from input values) and index-driven ops are deliberately left out.
+static bool can_warm_up(const vector<runtime::cpu::OpAttributes>& ops, string& blocker)
+{
+    static const unordered_set<string> s_warmup_ops{
+        "Abs",
+        "Add",
+        "AvgPool",
+        "AvgPoolBackprop",
+        "BatchMatMul",
+        "BatchMatMulTranspose",
+        "BatchNormInference",
+        "BatchNormInferenceRelu",
+        "BatchNormTraining",
+        "BatchNormTrainingRelu",
+        "BoundedRelu",
+        "Broadcast",
+        "Concat",
+        "Convert",
+        "ConvertLayout",
+        "Convolution",
+        "ConvolutionAdd",
+        "ConvolutionBackpropData",
+        "ConvolutionBackpropFilters",
+        "ConvolutionBias",
+        "ConvolutionBiasAdd",
+        "ConvolutionRelu",
+        "CPULeakyRelu",
+        "DeconvolutionBias",
+        "Dot",
+        "Exp",
+        "GroupConvolution",
+        "GroupConvolutionBias",
+        "LRN",
+        "Lstm",
+        "MatmulBias",
+        "Max",
+        "Maximum",
+        "MaxPool",
+        "MaxPoolBackprop",
+        "Min",
+        "Minimum",
+        "Multiply",
+        "Negative",
+        "Pad",
+        "Relu",
+        "ReluBackprop",
+        "Reshape",
+        "Result",
+        "Reverse",
+        "Rnn",
+        "Sigmoid",
+        "SigmoidBackprop",
+        "Slice",
+        "Softmax",
+        "Sqrt",
+        "Subtract",
+        "Sum",
+        "Tanh"};
+
+    for (auto& op : ops)
+    {
+        if (s_warmup_ops.count(op.Description) == 0)
+        {
+            blocker = op.Description;
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t runtime::cpu::CPU_CallFrame::warmup()
+{
+    if (!m_external_function->is_direct_execution())
+    {
+        return 0;
+    }
+    if (!m_external_function->m_states.empty())
+    {
+        NGRAPH_DEBUG << "Not warming up " << m_external_function->get_function_name()
+                     << ": function has state";
+        return 0;
+    }
+    // Checked on the ops that were actually compiled, including those introduced by passes
+    string blocker;
+    if (!can_warm_up(m_external_function->get_op_attrs(), blocker))
+    {
+        NGRAPH_DEBUG << "Not warming up " << m_external_function->get_function_name() << ": "
+                     << blocker << " is not known to be safe to run on zero inputs";
+        return 0;
+    }
+
+    stopwatch timer;
+    timer.start();
+
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    vector<unique_ptr<AlignedBuffer>> scratch;
+    auto allocate = [&](const LayoutDescriptorPtrs& layouts) {
+        vector<void*> ptrs;
+        for (auto& layout : layouts)
+        {
+            size_t size = layout->get_allocated_size();
+            scratch.emplace_back(new AlignedBuffer(size, alignment));
+            memset(scratch.back()->get_ptr(), 0, size);
+            ptrs.push_back(scratch.back()->get_ptr());
+        }
+        return ptrs;
+    };
+    vector<void*> inputs = allocate(m_external_function->get_parameter_layout_descriptors());
+    vector<void*> outputs = allocate(m_external_function->get_result_layout_descriptors());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto ctx : m_ctx_vec)
+    {
+        if (!ctx->first_iteration)
+        {
+            continue;
+        }
+        std::fill(ctx->p_en, ctx->p_en + inputs.size(), true);
+        ctx->pc = 0;
+        m_external_function->get_executor()(ctx, inputs, outputs);
+    }
+    // Cached results now hold values computed from the scratch inputs, so the next call must
+    // not trust staleness hints
+    m_prev_ctx = m_num_ctx;
+    for (auto& counter : m_external_function->m_perf_counters)
+    {
+        counter.m_total_microseconds = 0;
+        counter.m_call_count = 0;
+    }
+
+    timer.stop();
+    NGRAPH_DEBUG << "Warmed up " << m_num_ctx << " runtime context(s) in "
+                 << timer.get_microseconds() << "us";
+    return timer.get_microseconds();
+}
+
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
     const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
     const LayoutDescriptorPtrs& layouts) const
@@ -193,6 +341,8 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
             ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
         }
         ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+        m_input_versions.emplace_back(
+            m_external_function->get_parameter_layout_descriptors().size());
 
         ctx->first_iteration = true;
 
@@ -222,6 +372,12 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
 
         ctx->states = m_external_function->m_states.data();
 
+        ctx->collective_executor = nullptr;
+        if (m_external_function->is_async_collectives())
+        {
+            ctx->collective_executor = new executor::CPUCollectiveExecutor;
+        }
+
         if (m_external_function->is_direct_execution() &&
             std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
         {
@@ -246,6 +402,7 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 
         delete[] ctx->op_durations;
         delete[] ctx->p_en;
+        delete ctx->collective_executor;
         for (auto p : ctx->mkldnn_primitives)
         {
             delete p;
@@ -277,4 +434,9 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         delete ctx;
     }
     m_num_ctx_available = 0;
+
+    auto stats = MKLDNNPrimitiveCache::instance().get_stats();
+    NGRAPH_DEBUG << "MKLDNN primitive cache: " << stats.hits << " hits, " << stats.misses
+                 << " misses (hit rate " << stats.get_hit_rate() << "), "
+                 << stats.build_time_us << "us creating primitive descriptors";
 }
@@ -71,6 +71,16 @@ namespace ngraph
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
+                /// \brief Number of runtime contexts, i.e. how many calls may run concurrently.
+                size_t get_num_ctx() const { return m_num_ctx; }
+                /// \brief Runs the first iteration of every DEX runtime context on zero-filled
+                ///     scratch tensors so that MKLDNN primitives, buffer bindings and the TBB
+                ///     flow graph exist before the first call().
+                ///
+                /// The run is real, so it only happens when every op of the compiled function
+                /// is known to be pure and defined for zero inputs.
+                /// \returns Time spent in microseconds, or 0 if the function was not warmed up.
+                size_t warmup();
                 void setup_runtime_context();
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
@@ -94,6 +104,8 @@ namespace ngraph
                 size_t m_num_ctx = 1;
                 std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
+                // Versions of the input tensors of the last call, per context
+                std::vector<std::vector<size_t>> m_input_versions;
 
                 /* Codegen specific */
 
@@ -0,0 +1,118 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/cpu_collective_executor.hpp"
+
+using namespace std;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace executor
+            {
+                CPUCollectiveExecutor::~CPUCollectiveExecutor()
+                {
+                    {
+                        lock_guard<mutex> lock(m_mutex);
+                        m_shutdown = true;
+                    }
+                    m_queued.notify_one();
+                    if (m_thread.joinable())
+                    {
+                        m_thread.join();
+                    }
+                }
+
+                size_t CPUCollectiveExecutor::start(function<void()> task)
+                {
+                    size_t ticket;
+                    {
+                        lock_guard<mutex> lock(m_mutex);
+                        if (!m_thread.joinable())
+                        {
+                            m_thread = thread(&CPUCollectiveExecutor::worker, this);
+                        }
+                        m_tasks.push_back(move(task));
+                        ticket = ++m_started;
+                    }
+                    m_queued.notify_one();
+                    return ticket;
+                }
+
+                void CPUCollectiveExecutor::wait(size_t ticket)
+                {
+                    unique_lock<mutex> lock(m_mutex);
+                    m_completed.wait(lock, [&] { return m_finished >= ticket; });
+                    auto it = m_errors.find(ticket);
+                    if (it != m_errors.end())
+                    {
+                        exception_ptr error = it->second;
+                        m_errors.erase(it);
+                        rethrow_exception(error);
+                    }
+                }
+
+                void CPUCollectiveExecutor::wait_all()
+                {
+                    unique_lock<mutex> lock(m_mutex);
+                    m_completed.wait(lock, [&] { return m_finished >= m_started; });
+                    if (!m_errors.empty())
+                    {
+                        exception_ptr error = m_errors.begin()->second;
+                        m_errors.clear();
+                        rethrow_exception(error);
+                    }
+                }
+
+                void CPUCollectiveExecutor::worker()
+                {
+                    unique_lock<mutex> lock(m_mutex);
+                    while (true)
+                    {
+                        m_queued.wait(lock, [&] { return m_shutdown || !m_tasks.empty(); });
+                        if (m_tasks.empty())
+                        {
+                            return;
+                        }
+                        function<void()> task = move(m_tasks.front());
+                        m_tasks.pop_front();
+                        lock.unlock();
+                        exception_ptr error;
+                        try
+                        {
+                            task();
+                        }
+                        catch (...)
+                        {
+                            error = current_exception();
+                        }
+                        lock.lock();
+                        // Tasks finish in the order they were started
+                        m_finished++;
+                        if (error)
+                        {
+                            m_errors[m_finished] = error;
+                        }
+                        m_completed.notify_all();
+                    }
+                }
+            }
+        }
+    }
+}
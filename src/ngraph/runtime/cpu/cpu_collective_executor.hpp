@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace executor
+            {
+                /// \brief Runs collective operations on a dedicated communication thread, in the
+                ///     order they are started, so they overlap with computation on the calling
+                ///     thread. All ranks issue collectives in the same order, and a single thread
+                ///     keeps that order. Each CPURuntimeContext owns one, so waiting never blocks
+                ///     on collectives of another call.
+                class CPUCollectiveExecutor
+                {
+                public:
+                    CPUCollectiveExecutor() = default;
+                    ~CPUCollectiveExecutor();
+
+                    /// \brief Queues `task` and returns a ticket to wait on. Tickets start at 1,
+                    ///     so waiting on ticket 0 returns immediately.
+                    size_t start(std::function<void()> task);
+
+                    /// \brief Blocks until the task with `ticket`, and every task started before
+                    ///     it, has run. Rethrows the exception raised by that task, if any.
+                    void wait(size_t ticket);
+
+                    /// \brief Blocks until every started task has run. Rethrows the exception of
+                    ///     the earliest failed task not yet waited on, and drops the others.
+                    void wait_all();
+
+                    /// \brief Runs `task` on the communication thread and waits for it. Used for
+                    ///     collectives that are not overlapped, to keep them in issue order.
+                    void run(std::function<void()> task) { wait(start(std::move(task))); }
+                private:
+                    void worker();
+
+                    std::mutex m_mutex;
+                    std::condition_variable m_queued;
+                    std::condition_variable m_completed;
+                    std::deque<std::function<void()>> m_tasks;
+                    size_t m_started = 0;
+                    size_t m_finished = 0;
+                    // exceptions of failed tasks not yet waited on, by ticket
+                    std::map<size_t, std::exception_ptr> m_errors;
+                    bool m_shutdown = false;
+                    std::thread m_thread;
+                };
+            }
+        }
+    }
+}
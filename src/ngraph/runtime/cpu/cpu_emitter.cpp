@@ -48,6 +48,7 @@
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_bag.hpp"
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/erf.hpp"
@@ -1621,6 +1622,31 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::EmbeddingBag)
+            {
+                writer.block_begin();
+                auto bag = static_cast<const ngraph::op::EmbeddingBag*>(node);
+                auto index_type_name = args[0].get_element_type().c_type_string();
+                auto type_name = out[0].get_element_type().c_type_string();
+
+                writer << "reference::embedding_bag<" << type_name << "," << index_type_name
+                       << ">(";
+                writer << "            " << args[0].get_name() << ",\n";
+                writer << "            " << args[1].get_name() << ",\n";
+                writer << "            " << args[2].get_name() << ",\n";
+                writer << "            "
+                       << (bag->has_per_sample_weights() ? args[3].get_name() : "nullptr")
+                       << ",\n";
+                writer << "            " << out[0].get_name() << ",\n";
+                writer << "            " << args[0].get_size() << ",\n";
+                writer << "            " << args[2].get_size() << ",\n";
+                writer << "            " << out[0].get_shape().at(1) << ",\n";
+                writer << "            static_cast<ngraph::op::EmbeddingBag::Mode>("
+                       << static_cast<int>(bag->get_mode()) << "));\n";
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::EmbeddingLookup)
             {
@@ -1903,18 +1929,16 @@ namespace ngraph
                      args[0].get_element_type() == element::f32 ||
                      args[0].get_element_type() == element::u8 ||
                      args[0].get_element_type() == element::i8) &&
-                    args[0].get_shape().size() <= 3 && args[2].get_shape().size() <= 3)
+                    args[0].get_shape().size() > 0)
                 {
                     writer << "cpu::kernel::scatter_add<" << args[0].get_type() << ", "
-                           << args[1].get_element_type().c_type_string() << ", "
-                           << args[0].get_shape().size() << ", " << args[2].get_shape().size()
-                           << ">(" << args[0].get_name() << ",\n";
+                           << args[1].get_element_type().c_type_string() << ">("
+                           << args[0].get_name() << ",\n";
                     writer << "                   " << args[1].get_name() << ",\n";
                     writer << "                   " << args[2].get_name() << ",\n";
                     writer << "                   " << out[0].get_name() << ",\n";
                     writer << "                   {" << join(args[0].get_shape()) << "},\n";
                     writer << "                   {" << join(args[1].get_shape()) << "},\n";
-                    writer << "                   {" << join(args[2].get_shape()) << "},\n";
                     writer << "                   0);\n";
                 }
                 else
@@ -3907,6 +3931,10 @@ namespace ngraph
                 const ngraph::op::CompiledKernel* ck =
                     static_cast<const ngraph::op::CompiledKernel*>(node);
 
+                if (!ck->has_uniform_shape())
+                {
+                    throw ngraph_error("types and shapes of the nodes in node_list are different");
+                }
                 NodeVector output_nodes = ck->get_kernel_outputs();
                 NodeVector node_list = ck->get_node_list();
 
@@ -4017,6 +4045,12 @@ namespace ngraph
                 throw ngraph_error("Not yet implemented");
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::DropoutBackprop)
+            {
+                throw ngraph_error("Not yet implemented");
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Dequantize)
             {
@@ -65,6 +65,7 @@
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_bag.hpp"
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/erf.hpp"
@@ -131,6 +132,7 @@
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/op/topk.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
 #include "ngraph/pass/constant_folding.hpp"
@@ -143,6 +145,7 @@
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_aware_scheduling.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
 #include "ngraph/pass/propagate_cacheability.hpp"
@@ -153,6 +156,7 @@
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_collective_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_cse.hpp"
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
@@ -232,6 +236,7 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_release_function(release_function)
     , m_emit_timing(false)
     , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    , m_async_collectives(std::getenv("NGRAPH_CPU_ASYNC_COLLECTIVES") != nullptr)
 #if !defined(NGRAPH_DEX_ONLY)
     , m_is_compiled(false)
     , m_direct_execution((std::getenv("NGRAPH_CODEGEN") == nullptr) ||
@@ -263,6 +268,27 @@ public:
 
 static const string s_output_dir = "cpu_codegen";
 
+// Compiled objects are cached in NGRAPH_CODEGEN_CACHE_DIR when it is set, keeping at most
+// NGRAPH_CODEGEN_CACHE_SIZE_MB (default 1024) megabytes of them
+static shared_ptr<codegen::ObjectCache> get_codegen_object_cache()
+{
+    static shared_ptr<codegen::ObjectCache> s_cache = []() {
+        shared_ptr<codegen::ObjectCache> cache;
+        const char* directory = std::getenv("NGRAPH_CODEGEN_CACHE_DIR");
+        if (directory != nullptr && directory[0] != '\0')
+        {
+            size_t size_mb = 1024;
+            if (const char* size = std::getenv("NGRAPH_CODEGEN_CACHE_SIZE_MB"))
+            {
+                size_mb = strtoull(size, nullptr, 10);
+            }
+            cache = make_shared<codegen::ObjectCache>(directory, size_mb << 20);
+        }
+        return cache;
+    }();
+    return s_cache;
+}
+
 static string emit_string_array(const vector<string>& s, size_t max_line_length)
 {
     stringstream ss;
@@ -342,6 +368,7 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Sign), &runtime::cpu::CPU_Emitter::emit<op::Sign>},
     {TI(ngraph::op::Slice), &runtime::cpu::CPU_Emitter::emit<op::Slice>},
     {TI(ngraph::op::Sum), &runtime::cpu::CPU_Emitter::emit<op::Sum>},
+    {TI(ngraph::op::EmbeddingBag), &runtime::cpu::CPU_Emitter::emit<op::EmbeddingBag>},
     {TI(ngraph::op::EmbeddingLookup), &runtime::cpu::CPU_Emitter::emit<op::EmbeddingLookup>},
     {TI(ngraph::op::Exp), &runtime::cpu::CPU_Emitter::emit<op::Exp>},
     {TI(ngraph::op::Sin), &runtime::cpu::CPU_Emitter::emit<op::Sin>},
@@ -440,6 +467,7 @@ static const runtime::cpu::OpMap dispatcher{
      &runtime::cpu::CPU_Emitter::emit<ngraph::op::DeconvolutionBias>},
     {TI(ngraph::op::QuantizedConcat), &runtime::cpu::CPU_Emitter::emit<op::QuantizedConcat>},
     {TI(ngraph::op::Dropout), &runtime::cpu::CPU_Emitter::emit<op::Dropout>},
+    {TI(ngraph::op::DropoutBackprop), &runtime::cpu::CPU_Emitter::emit<op::DropoutBackprop>},
     {TI(ngraph::op::Tile), &runtime::cpu::CPU_Emitter::emit<op::Tile>},
 };
 
@@ -538,6 +566,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 #include "ngraph/runtime/reference/convolution.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/embedding_bag.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/gather.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
@@ -633,6 +662,9 @@ using namespace ngraph::runtime;
         writer << "\n";
     }
 
+    // Constant data is bound by bind_constants after the code is loaded, rather than written
+    // into the code, so that the code does not change from one process to the next and its
+    // compiled object can be cached
     writer << "// Declare all constants\n";
     for (shared_ptr<Node> node : ordered_ops)
     {
@@ -642,8 +674,7 @@ using namespace ngraph::runtime;
             m_active_constants.push_back(node);
             shared_ptr<descriptor::Tensor> tv = node->get_outputs()[0].get_tensor_ptr();
             string type = tv->get_element_type().c_type_string();
-            writer << "static " << type << "* " << tv->get_name() << " = ((" << type << "*)("
-                   << c->get_data_ptr() << "));\n";
+            writer << "static " << type << "* " << tv->get_name() << " = nullptr;\n";
 
             auto output_tensor = &node->get_output_tensor();
             auto tensor_set = get_tensor_set(output_tensor);
@@ -657,6 +688,19 @@ using namespace ngraph::runtime;
         }
     }
 
+    writer << "extern \"C\" void bind_constants(void* const* constants)\n";
+    writer << "{\n";
+    writer.indent++;
+    for (size_t i = 0; i < m_active_constants.size(); i++)
+    {
+        shared_ptr<descriptor::Tensor> tv = m_active_constants[i]->get_output_tensor_ptr();
+        string type = tv->get_element_type().c_type_string();
+        writer << tv->get_name() << " = static_cast<" << type << "*>(constants[" << i
+               << "]);\n";
+    }
+    writer.indent--;
+    writer << "}\n\n";
+
     generate_class_declarations(writer);
 
     const char* func_params =
@@ -1057,15 +1101,57 @@ using namespace ngraph::runtime;
 
     m_compiler->set_precompiled_header_source(pch_header_source);
 
-    auto codegen_module = m_compiler->compile(code);
+    // The object compiled for code is reused from the cache when the same code was compiled
+    // before with the same options, skipping clang and LLVM entirely
+    bool loaded_from_cache = false;
+    shared_ptr<codegen::ObjectCache> object_cache = get_codegen_object_cache();
+    string cache_key;
+    if (object_cache)
+    {
+        cache_key = codegen::ObjectCache::make_key(code, m_compiler->get_options());
+        vector<char> object;
+        if (object_cache->load(cache_key, object))
+        {
+            loaded_from_cache = m_execution_engine->add_object(object);
+            if (!loaded_from_cache)
+            {
+                NGRAPH_WARN << "Could not load cached object " << cache_key
+                            << ", compiling instead";
+                m_execution_engine.reset(new codegen::ExecutionEngine());
+            }
+        }
+    }
 
-    if (codegen_module == nullptr)
+    if (!loaded_from_cache)
     {
-        throw runtime_error("function failed to compile");
+        auto codegen_module = m_compiler->compile(code);
+
+        if (codegen_module == nullptr)
+        {
+            throw runtime_error("function failed to compile");
+        }
+        if (object_cache)
+        {
+            m_execution_engine->set_object_cache(object_cache, cache_key);
+        }
+        m_execution_engine->add_module(codegen_module);
     }
-    m_execution_engine->add_module(codegen_module);
     m_execution_engine->finalize();
 
+    auto bind_constants =
+        m_execution_engine->find_function<void(void* const*)>("bind_constants");
+    if (bind_constants == nullptr)
+    {
+        throw runtime_error("could not find compiled bind constants function");
+    }
+    vector<void*> constant_data;
+    for (auto& node : m_active_constants)
+    {
+        constant_data.push_back(
+            const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
+    }
+    bind_constants(constant_data.data());
+
     m_compiled_init_ctx_func = m_execution_engine->find_function<InitContextFuncTy>("init_cg_ctx");
 
     if (m_compiled_init_ctx_func == nullptr)
@@ -1190,6 +1276,7 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(AllReduceBucketing, true, ngraph::pass);
 #if defined(NGRAPH_HALIDE)
     REGISTER_KNOBBED_PASS(HalideSubgraphExtraction, true, ngraph::runtime::cpu::pass);
 #endif
@@ -1214,6 +1301,8 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(GetOutputElementElimination, false, ngraph::pass);
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory());
+    REGISTER_KNOBBED_PASS_WITH_ARGS(
+        MemoryAwareScheduling, false, ngraph::pass, size_t(s_memory_pool_alignment));
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                         pass_config.get_pass_attribute("ReuseMemory");
     pass_manager.register_pass<runtime::cpu::pass::CPUMemoryAssignment>(
@@ -1387,6 +1476,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    NodeVector functor_nodes;
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1421,6 +1511,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names);
         op_names.push_back(node->get_name());
+        functor_nodes.push_back(node);
         handler->second(this, node.get(), in, out);
 
         auto cacheable = true;
@@ -1562,6 +1653,11 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     //This check ensures we have exactly one functor for Op.
     NGRAPH_CHECK(m_op_attrs.size() == functors.size());
 
+    if (!m_async_collective_slots.empty())
+    {
+        schedule_collective_waits(functor_nodes);
+    }
+
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
         cpu::Timestamp start_ts, end_ts;
         int profiler_count = 0;
@@ -1578,6 +1674,8 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             {
                 ctx->buffer_data[p.first] = p.second;
             }
+
+            ctx->collective_tickets.assign(m_async_collective_slots.size(), 0);
         }
 
         for (const auto& p : function_input_index_offset)
@@ -1731,6 +1829,13 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
                 auto index = profiler_count++;
+                if (!m_collective_waits.empty())
+                {
+                    for (auto slot : m_collective_waits[ctx->pc])
+                    {
+                        ctx->collective_executor->wait(ctx->collective_tickets[slot]);
+                    }
+                }
                 if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration)
                 {
                     // Each Op will have exactly one functor, start the clock before the exceution of functor
@@ -1780,6 +1885,11 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
             }
         }
+        if (!m_async_collective_slots.empty())
+        {
+            // Collectives without a later reader finish before the call returns
+            ctx->collective_executor->wait_all();
+        }
         ctx->first_iteration = false;
         if (runtime::cpu::IsTracingEnabled())
         {
@@ -1796,6 +1906,101 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     }
 }
 
+bool runtime::cpu::CPU_ExternalFunction::tensors_overlap(descriptor::Tensor* a,
+                                                         descriptor::Tensor* b)
+{
+    auto it_a = tensor_to_bufferID.find(a);
+    auto it_b = tensor_to_bufferID.find(b);
+    if (it_a == tensor_to_bufferID.end() || it_b == tensor_to_bufferID.end())
+    {
+        return true;
+    }
+    // All intermediates share the temporary pool; any other buffer set is its own allocation
+    size_t id_a = it_a->second;
+    size_t id_b = it_b->second;
+    if (id_a != id_b && (bufferID_to_tensorSets.at(id_a).first != TensorRole::INTERMEDIATE ||
+                         bufferID_to_tensorSets.at(id_b).first != TensorRole::INTERMEDIATE))
+    {
+        return false;
+    }
+    return a->get_pool_offset() < b->get_pool_offset() + b->size() &&
+           b->get_pool_offset() < a->get_pool_offset() + a->size();
+}
+
+void runtime::cpu::CPU_ExternalFunction::schedule_collective_waits(const NodeVector& nodes)
+{
+    m_collective_waits.assign(nodes.size(), vector<size_t>());
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        auto it = m_async_collective_slots.find(nodes[i].get());
+        if (it == m_async_collective_slots.end())
+        {
+            continue;
+        }
+        vector<descriptor::Tensor*> reads;
+        vector<descriptor::Tensor*> writes;
+        for (const descriptor::Input& input : nodes[i]->get_inputs())
+        {
+            reads.push_back(input.get_output().get_tensor_ptr().get());
+        }
+        for (const descriptor::Output& output : nodes[i]->get_outputs())
+        {
+            writes.push_back(output.get_tensor_ptr().get());
+        }
+
+        // Wait as late as possible: before the first op that reads the collective's result,
+        // or writes memory the collective is still reading or writing
+        for (size_t j = i + 1; j < nodes.size(); j++)
+        {
+            bool hazard = false;
+            for (const descriptor::Input& input : nodes[j]->get_inputs())
+            {
+                for (auto tensor : writes)
+                {
+                    hazard = hazard ||
+                             tensors_overlap(input.get_output().get_tensor_ptr().get(), tensor);
+                }
+            }
+
+            set<size_t> pass_through_outputs;
+            if (auto op = dynamic_pointer_cast<ngraph::op::Op>(nodes[j]))
+            {
+                if (auto op_annotations = op->get_op_annotations())
+                {
+                    for (auto& oi_pair : op_annotations->get_in_place_oi_pairs())
+                    {
+                        if (!oi_pair.destructive)
+                        {
+                            pass_through_outputs.insert(oi_pair.output);
+                        }
+                    }
+                }
+            }
+            for (const descriptor::Output& output : nodes[j]->get_outputs())
+            {
+                if (pass_through_outputs.count(output.get_index()))
+                {
+                    continue;
+                }
+                for (auto tensor : reads)
+                {
+                    hazard = hazard || tensors_overlap(output.get_tensor_ptr().get(), tensor);
+                }
+                for (auto tensor : writes)
+                {
+                    hazard = hazard || tensors_overlap(output.get_tensor_ptr().get(), tensor);
+                }
+            }
+
+            if (hazard)
+            {
+                m_collective_waits[j].push_back(it->second);
+                break;
+            }
+        }
+    }
+}
+
 size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& name)
 {
     if (tensor_alias.count(name))
@@ -132,6 +132,22 @@ namespace ngraph
                     return m_states.size() - 1;
                 }
 
+                /// \brief True if collectives run on the communication thread and overlap with
+                ///     the ops after them (NGRAPH_CPU_ASYNC_COLLECTIVES, DEX without TBB only).
+                bool is_async_collectives() const
+                {
+                    return m_async_collectives && m_direct_execution && !m_use_tbb;
+                }
+
+                /// \brief Registers an asynchronous collective started by `node`, and returns
+                ///     the slot for its ticket in CPURuntimeContext::collective_tickets.
+                size_t add_async_collective(const Node* node)
+                {
+                    size_t slot = m_async_collective_slots.size();
+                    m_async_collective_slots[node] = slot;
+                    return slot;
+                }
+
                 const std::string& get_function_name() const { return m_function_name; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
                 // Temporary Memory Pool alignment
@@ -194,6 +210,11 @@ namespace ngraph
                                             ngraph::pass::PassConfig& pass_config);
 
                 bool computes_result(Node* node);
+                // True if the tensors may share memory
+                bool tensors_overlap(descriptor::Tensor* a, descriptor::Tensor* b);
+                // Fills m_collective_waits for the asynchronous collectives among the functor
+                // nodes, given in execution order
+                void schedule_collective_waits(const NodeVector& nodes);
                 void release_function() { m_function = nullptr; }
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(CodeWriter& writer,
@@ -235,6 +256,7 @@ namespace ngraph
                 bool m_emit_timing;
 
                 bool m_use_tbb;
+                bool m_async_collectives;
 #if !defined(NGRAPH_DEX_ONLY)
                 bool m_is_compiled;
 #endif
@@ -309,6 +331,10 @@ namespace ngraph
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
+                // ticket slot of each collective started asynchronously
+                std::unordered_map<const Node*, size_t> m_async_collective_slots;
+                // for each functor, the ticket slots to wait on before it runs
+                std::vector<std::vector<size_t>> m_collective_waits;
 
 #if defined(NGRAPH_HALIDE)
                 std::unordered_map<std::string, Halide::Func> halide_functions;
@@ -18,7 +18,6 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <random>
 #include <vector>
 
 // CBLAS types and wrappers
@@ -250,27 +249,31 @@ namespace ngraph
                             size_t axis,
                             int arena);
 
-                template <typename ElementType,
-                          typename IndicesType,
-                          unsigned int Rank1,
-                          unsigned int Rank2>
+                template <typename ElementType, typename IndicesType>
                 void scatter_add(void* inputs,
                                  void* indices,
                                  void* updates,
                                  void* output,
                                  const Shape& inputs_shape,
                                  const Shape& indices_shape,
-                                 const Shape& updates_shape,
                                  int arena);
 
                 template <typename T>
-                void generate_dropout(T* input,
+                void generate_dropout(const T* input,
                                       T* out0,
                                       T* out1_mask,
-                                      size_t nelems,
-                                      bool training,
-                                      const double value,
-                                      const std::vector<std::minstd_rand>& vmsr);
+                                      uint8_t* packed_mask,
+                                      const size_t nelems,
+                                      const bool training,
+                                      const double keep_prob,
+                                      const uint64_t seed,
+                                      const uint64_t offset);
+
+                template <typename T>
+                void dropout_backprop(const T* delta,
+                                      const uint8_t* packed_mask,
+                                      T* out,
+                                      const size_t nelems);
             }
         }
     }
@@ -36,6 +36,14 @@ namespace ngraph
     namespace runtime
     {
         class AlignedBuffer;
+
+        namespace cpu
+        {
+            namespace executor
+            {
+                class CPUCollectiveExecutor;
+            }
+        }
     }
 
     class State;
@@ -67,6 +75,10 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                // tickets of the asynchronous collectives, indexed by slot
+                std::vector<size_t> collective_tickets;
+                // runs the asynchronous collectives of this context, if any
+                executor::CPUCollectiveExecutor* collective_executor;
             };
             }
 
@@ -101,6 +101,7 @@ void runtime::cpu::CPUTensorView::write(const void* source, size_t n)
     }
     char* target = get_data_ptr();
     memcpy(target, source, n);
+    update_version();
 }
 
 void runtime::cpu::CPUTensorView::read(void* target, size_t n) const
@@ -186,6 +187,7 @@ void runtime::cpu::CPUTensorView::copy_from(const ngraph::runtime::Tensor& sourc
             m_descriptor->set_tensor_layout(
                 std::make_shared<runtime::cpu::LayoutDescriptor>(*m_descriptor));
         }
+        update_version();
     }
     else
     {
@@ -16,10 +16,12 @@
 
 #pragma once
 
-#include <random>
+#include <algorithm>
+#include <cstdint>
 
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/shape.hpp"
-#include "ngraph/state/rng_state.hpp"
+#include "ngraph/state/philox.hpp"
 
 namespace ngraph
 {
@@ -29,76 +31,145 @@ namespace ngraph
         {
             namespace kernel
             {
-                // Note: this kernel is for doing upscale in train
+                // Packed-mask bytes generated per work item. Each tile draws its random bits in
+                // one vectorizable loop before applying them.
+                static const size_t s_dropout_tile_bytes = 512;
+
+                // Calls f(begin, end, bits) for every tile [begin, end) of the packed mask, where
+                // bits[j] is packed-mask byte offset + begin + j. Tiles are independent, so the split
+                // across threads does not change the values.
+                template <typename F>
+                void for_each_mask_tile(
+                    size_t nbytes, uint64_t seed, double keep_prob, uint64_t offset, F f)
+                {
+                    uint64_t threshold = philox::bernoulli_threshold(keep_prob);
+                    size_t ntiles = (nbytes + s_dropout_tile_bytes - 1) / s_dropout_tile_bytes;
+#ifdef _OPENMP
+                    size_t nthr = executor::GetCPUExecutor().get_num_cores();
+#pragma omp parallel for schedule(static) num_threads(nthr) if (ntiles > 1)
+#endif
+                    for (size_t tile = 0; tile < ntiles; tile++)
+                    {
+                        size_t begin = tile * s_dropout_tile_bytes;
+                        size_t end = std::min(begin + s_dropout_tile_bytes, nbytes);
+                        uint8_t bits[s_dropout_tile_bytes];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                        for (size_t j = 0; j < end - begin; j++)
+                        {
+                            bits[j] = philox::bernoulli_byte(seed, offset + begin + j, threshold);
+                        }
+                        f(begin, end, bits);
+                    }
+                }
+
+                /// \brief Parallel GenerateMask. Produces the same mask as
+                ///     reference::generate_mask_from_offset for any number of threads.
                 template <typename T>
-                void generate_dropout(T* input,
+                void generate_mask(T* out,
+                                   const size_t nelems,
+                                   const bool training,
+                                   const uint64_t seed,
+                                   const double prob,
+                                   const uint64_t offset)
+                {
+                    if (!training)
+                    {
+                        std::fill(out, out + nelems, static_cast<T>(1));
+                        return;
+                    }
+                    for_each_mask_tile(philox::packed_size(nelems),
+                                       seed,
+                                       prob,
+                                       offset,
+                                       [&](size_t begin, size_t end, const uint8_t* bits) {
+                                           size_t last = std::min(end * 8, nelems);
+                                           for (size_t i = begin * 8; i < last; i++)
+                                           {
+                                               out[i] = static_cast<T>(
+                                                   (bits[i / 8 - begin] >> (i % 8)) & 1);
+                                           }
+                                       });
+                }
+
+                // Note: this kernel is for doing upscale in train. The mask is written with one
+                // element per input element, or one bit per input element when out1_mask is
+                // null and packed_mask is not.
+                template <typename T>
+                void generate_dropout(const T* input,
                                       T* out0,
                                       T* out1_mask,
+                                      uint8_t* packed_mask,
                                       const size_t nelems,
                                       const bool training,
                                       const double keep_prob,
-                                      const std::vector<std::minstd_rand>& vmsr,
-                                      const bool use_seed)
+                                      const uint64_t seed,
+                                      const uint64_t offset)
                 {
-                    if (training)
-
+                    if (!training)
                     {
-                        int32_t rnd_seed = rand();
-                        double dropout_prob = 1 - keep_prob;
-#ifdef _OPENMP
-                        size_t nthr =
-                            ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
-                        size_t chunk_size = (nelems + nthr - 1) / nthr;
-
-#pragma omp parallel num_threads(nthr)
+                        // this is inference, ideally it should be optimized earlier
+                        T scale = static_cast<T>(1) / static_cast<T>(keep_prob);
+                        for (size_t i = 0; i < nelems; i++)
                         {
-                            size_t tid = omp_get_thread_num();
-#else
-                        size_t chunk_size = nelems;
+                            out0[i] = input[i] * scale;
+                        }
+                        if (out1_mask)
                         {
-                            size_t tid = 0;
-#endif
-                            /* Note :
-                              In this implementation of dropout, we are trying to be same as PDPD
-                              native implementation (and other frameworks).
-                              https://github.com/NervanaSystems/ngraph-paddle/blob/14d88829b386c9f7601788c5539c08326dcbe2fe/paddle/fluid/operators/dropout_op.h#L58-L78
-                              So, if framework passes same seed, then we will get same mask.*/
-                            std::minstd_rand msr;
-                            if (use_seed)
-                            {
-                                msr = vmsr[tid];
-                            }
-                            else
+                            std::fill(out1_mask, out1_mask + nelems, static_cast<T>(1));
+                        }
+                        else
+                        {
+                            std::fill(packed_mask, packed_mask + philox::packed_size(nelems), 0xFF);
+                        }
+                        return;
+                    }
+
+                    /* Note :
+                      As in the PDPD native implementation (and other frameworks), a framework
+                      that passes the same seed gets the same mask.
+                      https://github.com/NervanaSystems/ngraph-paddle/blob/14d88829b386c9f7601788c5539c08326dcbe2fe/paddle/fluid/operators/dropout_op.h#L58-L78
+                      The mask matches GenerateMask with the same seed, probability and offset.*/
+                    T keep = static_cast<T>(keep_prob);
+                    for_each_mask_tile(
+                        philox::packed_size(nelems),
+                        seed,
+                        keep_prob,
+                        offset,
+                        [&](size_t begin, size_t end, const uint8_t* bits) {
+                            if (packed_mask)
                             {
-                                msr.seed(rnd_seed + tid);
+                                std::copy(bits, bits + (end - begin), packed_mask + begin);
                             }
-                            std::uniform_real_distribution<> gen(0, 1);
-
-                            size_t idx_start = tid * chunk_size;
-                            size_t idx_end = std::min(idx_start + chunk_size, nelems);
-                            for (size_t idx = idx_start; idx < idx_end; ++idx)
+                            size_t last = std::min(end * 8, nelems);
+                            for (size_t i = begin * 8; i < last; i++)
                             {
-                                if (static_cast<T>(gen(msr)) < dropout_prob)
+                                bool kept = (bits[i / 8 - begin] >> (i % 8)) & 1;
+                                out0[i] = kept ? input[i] / keep : static_cast<T>(0);
+                                if (out1_mask)
                                 {
-                                    out1_mask[idx] = 0;
-                                    out0[idx] = 0;
-                                }
-                                else
-                                {
-                                    out1_mask[idx] = 1;
-                                    out0[idx] = input[idx] / static_cast<T>(keep_prob);
+                                    out1_mask[i] = static_cast<T>(kept);
                                 }
                             }
-                        }
-                    }
-                    else
+                        });
+                }
+
+                /// \brief Zeroes the elements of delta whose bit in the packed mask is clear.
+                template <typename T>
+                void dropout_backprop(const T* delta,
+                                      const uint8_t* packed_mask,
+                                      T* out,
+                                      const size_t nelems)
+                {
+#ifdef _OPENMP
+                    size_t nthr = executor::GetCPUExecutor().get_num_cores();
+#pragma omp parallel for simd schedule(static) num_threads(nthr)
+#endif
+                    for (size_t i = 0; i < nelems; i++)
                     {
-                        // this is inference, ideally it should be optimized earlier
-                        for (size_t i = 0; i < nelems; i++)
-                        {
-                            out1_mask[i] = 1;
-                            out0[i] = static_cast<T>(1);
-                        }
+                        bool kept = (packed_mask[i / 8] >> (i % 8)) & 1;
+                        out[i] = kept ? delta[i] : static_cast<T>(0);
                     }
                 }
             }
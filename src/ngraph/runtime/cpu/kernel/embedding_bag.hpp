@@ -0,0 +1,163 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "ngraph/op/embedding_bag.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Rows are prefetched this many indices ahead of the one being accumulated.
+                static const size_t s_embedding_bag_prefetch_distance = 4;
+
+                template <typename T>
+                inline void prefetch_embedding_row(const T* row, size_t vec_len)
+                {
+#if defined(__GNUC__)
+                    const char* bytes = reinterpret_cast<const char*>(row);
+                    for (size_t b = 0; b < vec_len * sizeof(T); b += 64)
+                    {
+                        __builtin_prefetch(bytes + b, 0, 1);
+                    }
+#endif
+                }
+
+                // Bags are distributed across threads; within a bag the rows are accumulated
+                // straight into the output row, vectorized over the embedding length.
+                template <typename ElementType, typename IndicesType>
+                void embedding_bag(void* indices,
+                                   void* weights,
+                                   void* offsets,
+                                   void* per_sample_weights,
+                                   void* out,
+                                   size_t indices_count,
+                                   size_t bag_count,
+                                   size_t vec_len,
+                                   op::EmbeddingBag::Mode mode)
+                {
+                    const IndicesType* indices_ptr = static_cast<const IndicesType*>(indices);
+                    const IndicesType* offsets_ptr = static_cast<const IndicesType*>(offsets);
+                    const ElementType* weights_ptr = static_cast<const ElementType*>(weights);
+                    const ElementType* scales_ptr =
+                        static_cast<const ElementType*>(per_sample_weights);
+                    ElementType* out_ptr = static_cast<ElementType*>(out);
+                    auto row = [&](size_t i) {
+                        return weights_ptr + vec_len * static_cast<size_t>(indices_ptr[i]);
+                    };
+
+#ifdef _OPENMP
+                    size_t nthr = ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthr) if (bag_count > 1)
+#endif
+                    for (size_t b = 0; b < bag_count; b++)
+                    {
+                        size_t begin = static_cast<size_t>(offsets_ptr[b]);
+                        size_t end = b + 1 < bag_count ? static_cast<size_t>(offsets_ptr[b + 1])
+                                                       : indices_count;
+                        ElementType* dst = out_ptr + b * vec_len;
+
+                        if (begin >= end)
+                        {
+                            std::fill(dst, dst + vec_len, ElementType(0));
+                            continue;
+                        }
+
+                        size_t prefetch_end =
+                            std::min(end, begin + s_embedding_bag_prefetch_distance);
+                        for (size_t i = begin; i < prefetch_end; i++)
+                        {
+                            prefetch_embedding_row(row(i), vec_len);
+                        }
+
+                        const ElementType* first = row(begin);
+                        ElementType first_scale = scales_ptr ? scales_ptr[begin] : ElementType(1);
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                        for (size_t j = 0; j < vec_len; j++)
+                        {
+                            dst[j] = first_scale * first[j];
+                        }
+
+                        for (size_t i = begin + 1; i < end; i++)
+                        {
+                            if (i + s_embedding_bag_prefetch_distance < end)
+                            {
+                                prefetch_embedding_row(row(i + s_embedding_bag_prefetch_distance),
+                                                       vec_len);
+                            }
+                            const ElementType* src = row(i);
+                            if (mode == op::EmbeddingBag::Mode::MAX)
+                            {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                                for (size_t j = 0; j < vec_len; j++)
+                                {
+                                    dst[j] = src[j] > dst[j] ? src[j] : dst[j];
+                                }
+                            }
+                            else if (scales_ptr)
+                            {
+                                ElementType scale = scales_ptr[i];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                                for (size_t j = 0; j < vec_len; j++)
+                                {
+                                    dst[j] += scale * src[j];
+                                }
+                            }
+                            else
+                            {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                                for (size_t j = 0; j < vec_len; j++)
+                                {
+                                    dst[j] += src[j];
+                                }
+                            }
+                        }
+
+                        if (mode == op::EmbeddingBag::Mode::MEAN)
+                        {
+                            ElementType scale =
+                                ElementType(1) / static_cast<ElementType>(end - begin);
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                            for (size_t j = 0; j < vec_len; j++)
+                            {
+                                dst[j] *= scale;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
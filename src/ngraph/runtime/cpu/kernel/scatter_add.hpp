@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
-#include "ngraph/coordinate.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/shape.hpp"
 
@@ -31,141 +34,82 @@ namespace ngraph
         {
             namespace kernel
             {
-                static void
-                    get_leading_indices(const Shape& shape, int index, std::vector<int>& indices)
-                {
-                    auto rank = shape.size();
-                    std::vector<int> partial_sum(rank);
-
-                    partial_sum[rank - 1] = 1;
-                    for (int j = rank - 2; j >= 0; j--)
-                    {
-                        partial_sum[j] = partial_sum[j + 1] * shape[j + 1];
-                    }
-                    for (int j = 0; j < rank; j++)
-                    {
-                        indices[j] = index / partial_sum[j];
-                        index = index % partial_sum[j];
-                    }
-                }
-
-                // ScatterAdd is to update bunch of slices of the inputs. The rank of slice is 1 less than the rank of the inputs.
-                template <typename ElementType,
-                          typename IndicesType,
-                          unsigned int Rank1,
-                          unsigned int Rank2>
+                // ScatterAdd adds each slice of updates to the row of the inputs selected by the
+                // corresponding index. Updates are stably sorted by destination row so that every
+                // row is owned by one thread: duplicate indices are summed in index order without
+                // atomics, and each row add is a vectorized loop.
+                template <typename ElementType, typename IndicesType>
                 void scatter_add(void* inputs,
                                  void* indices,
                                  void* updates,
                                  void* output,
                                  const Shape& inputs_shape,
                                  const Shape& indices_shape,
-                                 const Shape& updates_shape,
                                  int arena)
                 {
-                    // For Eigen slice op, both parameters (offsets and extents) need to have the same rank.
-                    // Here *_offsets and *_extents have the same rank.
-                    Eigen::array<Eigen::Index, Rank1> in_dims, in_extents, in_offsets;
-                    Eigen::array<Eigen::Index, Rank2> updates_dims, updates_extents,
-                        updates_offsets;
-
-                    for (int i = 0; i < Rank1; i++)
-                    {
-                        in_extents[i] = in_dims[i] = inputs_shape[i];
-                        in_offsets[i] = 0;
-                    }
-                    in_extents[0] = 1;
-                    for (int i = 0; i < Rank2; i++)
-                    {
-                        updates_extents[i] = updates_dims[i] = updates_shape[i];
-                        updates_offsets[i] = 0;
-                    }
-
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank1, Eigen::RowMajor>> out(
-                        static_cast<ElementType*>(output), in_dims);
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank1, Eigen::RowMajor>> in(
-                        static_cast<ElementType*>(inputs), in_dims);
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank2, Eigen::RowMajor>> up(
-                        static_cast<ElementType*>(updates), updates_dims);
-
+                    size_t element_count = shape_size(inputs_shape);
                     // copy if not in place.
                     if (inputs != output)
                     {
+                        Eigen::array<Eigen::Index, 1> dims{
+                            static_cast<Eigen::Index>(element_count)};
+                        Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(
+                            static_cast<ElementType*>(output), dims);
+                        Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in(
+                            static_cast<ElementType*>(inputs), dims);
                         out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
                             arena)) = in;
                     }
 
-                    auto indices_ptr = static_cast<IndicesType*>(indices);
-                    auto indices_rank = indices_shape.size();
-                    if (indices_rank == 0)
+                    size_t index_count = shape_size(indices_shape);
+                    if (index_count == 0 || element_count == 0)
                     {
-                        in_offsets[0] = indices_ptr[0];
-                        out.slice(in_offsets, in_extents)
-                            .device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                                arena)) =
-                            out.slice(in_offsets, in_extents) +
-                            up.slice(updates_offsets, updates_extents).reshape(in_extents);
+                        return;
+                    }
+                    size_t row_len = element_count / inputs_shape[0];
+                    auto indices_ptr = static_cast<const IndicesType*>(indices);
+                    auto updates_ptr = static_cast<const ElementType*>(updates);
+                    auto out_ptr = static_cast<ElementType*>(output);
+
+                    std::vector<size_t> order(index_count);
+                    std::iota(order.begin(), order.end(), 0);
+                    std::stable_sort(order.begin(), order.end(), [indices_ptr](size_t a, size_t b) {
+                        return indices_ptr[a] < indices_ptr[b];
+                    });
+
+                    // Each run of equal indices in the sorted order updates one row
+                    std::vector<size_t> run_begin{0};
+                    for (size_t k = 1; k < index_count; k++)
+                    {
+                        if (indices_ptr[order[k]] != indices_ptr[order[k - 1]])
+                        {
+                            run_begin.push_back(k);
+                        }
                     }
-                    else
+                    size_t run_count = run_begin.size();
+                    run_begin.push_back(index_count);
+
+#ifdef _OPENMP
+                    size_t nthr = ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthr) if (run_count > 1)
+#endif
+                    for (size_t r = 0; r < run_count; r++)
                     {
-                        std::vector<int> leading_indices(indices_rank);
-                        for (int i = 0; i < shape_size(indices_shape); i++)
+                        size_t row = static_cast<size_t>(indices_ptr[order[run_begin[r]]]);
+                        ElementType* dst = out_ptr + row * row_len;
+                        for (size_t k = run_begin[r]; k < run_begin[r + 1]; k++)
                         {
-                            in_offsets[0] = indices_ptr[i];
-                            get_leading_indices(indices_shape, i, leading_indices);
-                            for (int j = 0; j < indices_rank; j++)
+                            const ElementType* src = updates_ptr + order[k] * row_len;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                            for (size_t j = 0; j < row_len; j++)
                             {
-                                updates_extents[j] = 1;
-                                updates_offsets[j] = leading_indices[j];
+                                dst[j] += src[j];
                             }
-                            out.slice(in_offsets, in_extents)
-                                .device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                                    arena)) =
-                                out.slice(in_offsets, in_extents) +
-                                up.slice(updates_offsets, updates_extents).reshape(in_extents);
                         }
                     }
                 }
-
-                template <typename ElementType, unsigned int Rank1, unsigned int Rank2>
-                void scatter_add_i64(void* inputs,
-                                     void* indices,
-                                     void* updates,
-                                     void* output,
-                                     const Shape& inputs_shape,
-                                     const Shape& indices_shape,
-                                     const Shape& updates_shape,
-                                     int arena)
-                {
-                    scatter_add<ElementType, int64_t, Rank1, Rank2>(inputs,
-                                                                    indices,
-                                                                    updates,
-                                                                    output,
-                                                                    inputs_shape,
-                                                                    indices_shape,
-                                                                    updates_shape,
-                                                                    arena);
-                }
-
-                template <typename ElementType, unsigned int Rank1, unsigned int Rank2>
-                void scatter_add_i32(void* inputs,
-                                     void* indices,
-                                     void* updates,
-                                     void* output,
-                                     const Shape& inputs_shape,
-                                     const Shape& indices_shape,
-                                     const Shape& updates_shape,
-                                     int arena)
-                {
-                    scatter_add<ElementType, int32_t, Rank1, Rank2>(inputs,
-                                                                    indices,
-                                                                    updates,
-                                                                    output,
-                                                                    inputs_shape,
-                                                                    indices_shape,
-                                                                    updates_shape,
-                                                                    arena);
-                }
             }
         }
     }
@@ -381,14 +381,22 @@ void MKLDNNEmitter::build_convolution_backward_weights(
     size_t diff_weights_index = deps[2];
     build_memory_primitive(mkldnn_primitives, bwd_desc.data.diff_weights_desc, diff_weights_index);
 
-    mkldnn_primitives[conv_index] = new mkldnn::convolution_backward_weights(
-        {bwd_desc,
-         executor::global_cpu_engine,
-         // Forward primitive descriptor corresponding to this backward weights descriptor
-         {fwd_desc, executor::global_cpu_engine}},
-        *mkldnn_primitives[src_index],
-        *mkldnn_primitives[diff_dst_index],
-        *mkldnn_primitives[diff_weights_index]);
+    using primitive_desc = mkldnn::convolution_backward_weights::primitive_desc;
+    auto pd = MKLDNNPrimitiveCache::instance().get_primitive_desc<primitive_desc>(
+        MKLDNNPrimitiveCache::make_backward_key(
+            "convolution_backward_weights", bwd_desc.data, fwd_desc.data),
+        [&]() {
+            return primitive_desc(
+                bwd_desc,
+                executor::global_cpu_engine,
+                // Forward primitive descriptor corresponding to this backward weights descriptor
+                {fwd_desc, executor::global_cpu_engine});
+        });
+    mkldnn_primitives[conv_index] =
+        new mkldnn::convolution_backward_weights(pd,
+                                                 *mkldnn_primitives[src_index],
+                                                 *mkldnn_primitives[diff_dst_index],
+                                                 *mkldnn_primitives[diff_weights_index]);
 }
 
 void MKLDNNEmitter::build_convolution_backward_data(
@@ -405,14 +413,22 @@ void MKLDNNEmitter::build_convolution_backward_data(
     size_t diff_src_index = deps[2];
     build_memory_primitive(mkldnn_primitives, bwd_desc.data.diff_src_desc, diff_src_index);
 
-    mkldnn_primitives[conv_index] = new mkldnn::convolution_backward_data(
-        {bwd_desc,
-         executor::global_cpu_engine,
-         // Forward primitive descriptor corresponding to this backward data descriptor
-         {fwd_desc, executor::global_cpu_engine}},
-        *mkldnn_primitives[diff_dst_index],
-        *mkldnn_primitives[weights_index],
-        *mkldnn_primitives[diff_src_index]);
+    using primitive_desc = mkldnn::convolution_backward_data::primitive_desc;
+    auto pd = MKLDNNPrimitiveCache::instance().get_primitive_desc<primitive_desc>(
+        MKLDNNPrimitiveCache::make_backward_key(
+            "convolution_backward_data", bwd_desc.data, fwd_desc.data),
+        [&]() {
+            return primitive_desc(
+                bwd_desc,
+                executor::global_cpu_engine,
+                // Forward primitive descriptor corresponding to this backward data descriptor
+                {fwd_desc, executor::global_cpu_engine});
+        });
+    mkldnn_primitives[conv_index] =
+        new mkldnn::convolution_backward_data(pd,
+                                              *mkldnn_primitives[diff_dst_index],
+                                              *mkldnn_primitives[weights_index],
+                                              *mkldnn_primitives[diff_src_index]);
 }
 
 void MKLDNNEmitter::build_pooling_forward(std::vector<mkldnn::primitive*>& mkldnn_primitives,
@@ -425,10 +441,12 @@ void MKLDNNEmitter::build_pooling_forward(std::vector<mkldnn::primitive*>& mkldn
     size_t result_index = deps[1];
     build_memory_primitive(mkldnn_primitives, pool_desc.data.dst_desc, result_index);
 
-    mkldnn_primitives[pool_index] =
-        new mkldnn::pooling_forward({pool_desc, executor::global_cpu_engine},
-                                    *mkldnn_primitives[input_index],
-                                    *mkldnn_primitives[result_index]);
+    using primitive_desc = mkldnn::pooling_forward::primitive_desc;
+    auto pd = MKLDNNPrimitiveCache::instance().get_primitive_desc<primitive_desc>(
+        MKLDNNPrimitiveCache::make_key("pooling_forward", pool_desc.data),
+        [&]() { return primitive_desc(pool_desc, executor::global_cpu_engine); });
+    mkldnn_primitives[pool_index] = new mkldnn::pooling_forward(
+        pd, *mkldnn_primitives[input_index], *mkldnn_primitives[result_index]);
 }
 
 void MKLDNNEmitter::build_pooling_backward(std::vector<mkldnn::primitive*>& mkldnn_primitives,
@@ -49,6 +49,7 @@
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
@@ -58,6 +59,7 @@
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
+#include "ngraph/util.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -1060,10 +1062,20 @@ namespace ngraph
                     mkldnn_primitives[results_idx] =
                         new mkldnn::memory({{desc.data.dst_desc}, engine}, nullptr);
 
+                    // The primitive descriptor may be shared with other contexts; the memory
+                    // primitives and the primitive built from it belong to this one
+                    using primitive_desc = mkldnn::convolution_forward::primitive_desc;
+                    auto key = MKLDNNPrimitiveCache::make_key(
+                        with_bias ? "convolution_forward_bias" : "convolution_forward",
+                        desc.data,
+                        attr);
+                    auto pd = MKLDNNPrimitiveCache::instance().get_primitive_desc<primitive_desc>(
+                        key, [&]() { return primitive_desc(desc, attr, engine); });
+
                     mkldnn::primitive* prim;
                     if (with_bias)
                     {
-                        prim = new mkldnn::convolution_forward({desc, attr, engine},
+                        prim = new mkldnn::convolution_forward(pd,
                                                                *mkldnn_primitives[input_idx],
                                                                *mkldnn_primitives[weights_idx],
                                                                *mkldnn_primitives[bias_idx],
@@ -1071,7 +1083,7 @@ namespace ngraph
                     }
                     else
                     {
-                        prim = new mkldnn::convolution_forward({desc, attr, engine},
+                        prim = new mkldnn::convolution_forward(pd,
                                                                *mkldnn_primitives[input_idx],
                                                                *mkldnn_primitives[weights_idx],
                                                                *mkldnn_primitives[results_idx]);
@@ -1162,10 +1174,20 @@ namespace ngraph
                     mkldnn_primitives[results_idx] =
                         new mkldnn::memory({{desc.data.dst_desc}, engine}, nullptr);
 
+                    // The primitive descriptor may be shared with other contexts; the memory
+                    // primitives and the primitive built from it belong to this one
+                    using primitive_desc = mkldnn::inner_product_forward::primitive_desc;
+                    auto key = MKLDNNPrimitiveCache::make_key(
+                        with_bias ? "inner_product_forward_bias" : "inner_product_forward",
+                        desc.data,
+                        attr);
+                    auto pd = MKLDNNPrimitiveCache::instance().get_primitive_desc<primitive_desc>(
+                        key, [&]() { return primitive_desc(desc, attr, engine); });
+
                     mkldnn::primitive* prim;
                     if (with_bias)
                     {
-                        prim = new mkldnn::inner_product_forward({desc, attr, engine},
+                        prim = new mkldnn::inner_product_forward(pd,
                                                                  *mkldnn_primitives[input_idx],
                                                                  *mkldnn_primitives[weights_idx],
                                                                  *mkldnn_primitives[bias_idx],
@@ -1173,7 +1195,7 @@ namespace ngraph
                     }
                     else
                     {
-                        prim = new mkldnn::inner_product_forward({desc, attr, engine},
+                        prim = new mkldnn::inner_product_forward(pd,
                                                                  *mkldnn_primitives[input_idx],
                                                                  *mkldnn_primitives[weights_idx],
                                                                  *mkldnn_primitives[results_idx]);
@@ -0,0 +1,317 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Writes descriptor fields one at a time so that padding bytes and unused array entries
+    // of the MKLDNN structs never reach the key
+    class KeyWriter
+    {
+    public:
+        explicit KeyWriter(const string& kind)
+            : m_key(kind + ":")
+            , m_valid(true)
+        {
+        }
+
+        void add(int64_t value)
+        {
+            m_key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        void add_float(float value)
+        {
+            int32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            add(bits);
+        }
+
+        // Only the first count entries of MKLDNN's fixed size dims and strides arrays are used
+        template <typename T>
+        void add_array(const T* values, int count)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                add(values[i]);
+            }
+        }
+
+        void add(const mkldnn_memory_desc_t& md)
+        {
+            add(md.primitive_kind);
+            add(md.ndims);
+            add_array(md.dims, md.ndims);
+            add(md.data_type);
+            add(md.format);
+            switch (md.format)
+            {
+            case mkldnn_format_undef:
+            case mkldnn_any: break;
+            case mkldnn_wino_fmt:
+            case mkldnn_rnn_packed:
+                // Opaque layouts whose parameters the key does not describe
+                m_valid = false;
+                break;
+            default:
+            {
+                const mkldnn_blocking_desc_t& blocking = md.layout_desc.blocking;
+                add_array(blocking.block_dims, md.ndims);
+                add_array(blocking.strides[0], md.ndims);
+                add_array(blocking.strides[1], md.ndims);
+                add_array(blocking.padding_dims, md.ndims);
+                add_array(blocking.offset_padding_to_data, md.ndims);
+                add(blocking.offset_padding);
+                break;
+            }
+            }
+        }
+
+        void add(const mkldnn::primitive_attr& attr)
+        {
+            add(static_cast<int64_t>(attr.get_int_output_round_mode()));
+
+            int mask;
+            vector<float> scales;
+            attr.get_output_scales(mask, scales);
+            add(mask);
+            add(static_cast<int64_t>(scales.size()));
+            for (float scale : scales)
+            {
+                add_float(scale);
+            }
+
+            const mkldnn::post_ops ops = attr.get_post_ops();
+            add(ops.len());
+            for (int i = 0; i < ops.len(); i++)
+            {
+                float scale;
+                switch (ops.kind(i))
+                {
+                case mkldnn::primitive::kind::sum:
+                {
+                    ops.get_params_sum(i, scale);
+                    add(static_cast<int64_t>(mkldnn::primitive::kind::sum));
+                    add_float(scale);
+                    break;
+                }
+                case mkldnn::primitive::kind::eltwise:
+                {
+                    mkldnn::algorithm alg;
+                    float alpha;
+                    float beta;
+                    ops.get_params_eltwise(i, scale, alg, alpha, beta);
+                    add(static_cast<int64_t>(mkldnn::primitive::kind::eltwise));
+                    add(static_cast<int64_t>(alg));
+                    add_float(scale);
+                    add_float(alpha);
+                    add_float(beta);
+                    break;
+                }
+                default:
+                    // Post-op kinds we cannot describe must not share descriptors
+                    m_valid = false;
+                    break;
+                }
+            }
+        }
+
+        string get_key() const { return m_valid ? m_key : string(); }
+
+    private:
+        string m_key;
+        bool m_valid;
+    };
+
+    int spatial_dims(const mkldnn_memory_desc_t& src, const mkldnn_memory_desc_t& diff_src)
+    {
+        return max(src.ndims, diff_src.ndims) - 2;
+    }
+
+    void add_convolution(KeyWriter& writer, const mkldnn_convolution_desc_t& desc)
+    {
+        writer.add(desc.primitive_kind);
+        writer.add(desc.prop_kind);
+        writer.add(desc.alg_kind);
+        writer.add(desc.src_desc);
+        writer.add(desc.diff_src_desc);
+        writer.add(desc.weights_desc);
+        writer.add(desc.diff_weights_desc);
+        writer.add(desc.bias_desc);
+        writer.add(desc.diff_bias_desc);
+        writer.add(desc.dst_desc);
+        writer.add(desc.diff_dst_desc);
+        int spatial = spatial_dims(desc.src_desc, desc.diff_src_desc);
+        writer.add_array(desc.strides, spatial);
+        writer.add_array(desc.dilates, spatial);
+        writer.add_array(desc.padding[0], spatial);
+        writer.add_array(desc.padding[1], spatial);
+        writer.add(desc.padding_kind);
+        writer.add(desc.accum_data_type);
+    }
+}
+
+runtime::cpu::MKLDNNPrimitiveCache& runtime::cpu::MKLDNNPrimitiveCache::instance()
+{
+    static MKLDNNPrimitiveCache s_cache;
+    return s_cache;
+}
+
+runtime::cpu::MKLDNNPrimitiveCache::MKLDNNPrimitiveCache()
+    : m_capacity(0)
+    , m_stats{0, 0, 0}
+{
+    if (const char* env = getenv("NGRAPH_MKLDNN_PRIMITIVE_CACHE_SIZE"))
+    {
+        m_capacity = static_cast<size_t>(max(atoi(env), 0));
+    }
+}
+
+string runtime::cpu::MKLDNNPrimitiveCache::make_key(const string& kind,
+                                                    const mkldnn_convolution_desc_t& desc,
+                                                    const mkldnn::primitive_attr& attr)
+{
+    KeyWriter writer(kind);
+    add_convolution(writer, desc);
+    writer.add(attr);
+    return writer.get_key();
+}
+
+string runtime::cpu::MKLDNNPrimitiveCache::make_key(const string& kind,
+                                                    const mkldnn_inner_product_desc_t& desc,
+                                                    const mkldnn::primitive_attr& attr)
+{
+    KeyWriter writer(kind);
+    writer.add(desc.primitive_kind);
+    writer.add(desc.prop_kind);
+    writer.add(desc.src_desc);
+    writer.add(desc.diff_src_desc);
+    writer.add(desc.weights_desc);
+    writer.add(desc.diff_weights_desc);
+    writer.add(desc.bias_desc);
+    writer.add(desc.diff_bias_desc);
+    writer.add(desc.dst_desc);
+    writer.add(desc.diff_dst_desc);
+    writer.add(desc.accum_data_type);
+    writer.add(attr);
+    return writer.get_key();
+}
+
+string runtime::cpu::MKLDNNPrimitiveCache::make_key(const string& kind,
+                                                    const mkldnn_pooling_desc_t& desc)
+{
+    KeyWriter writer(kind);
+    writer.add(desc.primitive_kind);
+    writer.add(desc.prop_kind);
+    writer.add(desc.alg_kind);
+    writer.add(desc.src_desc);
+    writer.add(desc.diff_src_desc);
+    writer.add(desc.dst_desc);
+    writer.add(desc.diff_dst_desc);
+    int spatial = spatial_dims(desc.src_desc, desc.diff_src_desc);
+    writer.add_array(desc.strides, spatial);
+    writer.add_array(desc.kernel, spatial);
+    writer.add_array(desc.padding[0], spatial);
+    writer.add_array(desc.padding[1], spatial);
+    writer.add(desc.padding_kind);
+    writer.add(desc.accum_data_type);
+    return writer.get_key();
+}
+
+string
+    runtime::cpu::MKLDNNPrimitiveCache::make_backward_key(const string& kind,
+                                                          const mkldnn_convolution_desc_t& desc,
+                                                          const mkldnn_convolution_desc_t& fwd_desc)
+{
+    KeyWriter writer(kind);
+    add_convolution(writer, desc);
+    add_convolution(writer, fwd_desc);
+    return writer.get_key();
+}
+
+bool runtime::cpu::MKLDNNPrimitiveCache::is_enabled() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_capacity > 0;
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::set_capacity(size_t capacity)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evict();
+}
+
+size_t runtime::cpu::MKLDNNPrimitiveCache::get_capacity() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+runtime::cpu::MKLDNNPrimitiveCache::Stats runtime::cpu::MKLDNNPrimitiveCache::get_stats() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_stats;
+}
+
+shared_ptr<void> runtime::cpu::MKLDNNPrimitiveCache::lookup(const string& key)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+    {
+        m_stats.misses++;
+        return nullptr;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    m_stats.hits++;
+    return it->second->second;
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::insert(const string& key,
+                                                shared_ptr<void> desc,
+                                                int64_t build_time_us)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_stats.build_time_us += build_time_us;
+    // Another context may have created the same descriptor in the meantime; either copy works
+    if (m_capacity == 0 || m_index.count(key) != 0)
+    {
+        return;
+    }
+    m_entries.emplace_front(key, move(desc));
+    m_index.emplace(key, m_entries.begin());
+    evict();
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::evict()
+{
+    // Callers hold m_mutex. Contexts keep their own references to evicted descriptors.
+    while (m_entries.size() > m_capacity)
+    {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+}
@@ -0,0 +1,128 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <mkldnn.hpp>
+
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Process-wide pool of MKLDNN primitive descriptors keyed by the operation
+            ///     descriptor and attributes they were created from.
+            ///
+            /// Creating a primitive descriptor runs MKLDNN's implementation search, which is the
+            /// part of building a primitive that depends only on the layer. Primitive
+            /// descriptors are immutable, so runtime contexts in this or another executable
+            /// with an identical layer share one and each creates its own primitive and memory
+            /// primitives from it. Nothing is shared at execution time. All primitives are
+            /// created on the global CPU engine, which is therefore not part of the key.
+            ///
+            /// The cache is off unless NGRAPH_MKLDNN_PRIMITIVE_CACHE_SIZE gives the number of
+            /// descriptors to keep; the least recently used ones are evicted beyond that.
+            class MKLDNNPrimitiveCache
+            {
+            public:
+                using Stats = MKLDNNPrimitiveCacheStats;
+
+                static MKLDNNPrimitiveCache& instance();
+
+                /// \brief Returns the cached primitive descriptor for key, or creates one with
+                ///     make_desc and caches it.
+                /// \param key From make_key(); empty keys are never cached.
+                template <typename PRIMITIVE_DESC, typename MAKE_DESC>
+                PRIMITIVE_DESC get_primitive_desc(const std::string& key, MAKE_DESC make_desc)
+                {
+                    if (key.empty() || !is_enabled())
+                    {
+                        return make_desc();
+                    }
+                    if (auto cached = lookup(key))
+                    {
+                        return *std::static_pointer_cast<PRIMITIVE_DESC>(cached);
+                    }
+                    stopwatch timer;
+                    timer.start();
+                    auto desc = std::make_shared<PRIMITIVE_DESC>(make_desc());
+                    timer.stop();
+                    insert(key, desc, timer.get_microseconds());
+                    return *desc;
+                }
+
+                /// \brief Builds the lookup key of a primitive descriptor from the fields of its
+                ///     operation descriptor and from its attributes.
+                /// \param kind Names the primitive and so the primitive descriptor type.
+                /// \returns An empty string if the descriptor has fields the key cannot
+                ///     describe, in which case it must not be cached.
+                static std::string make_key(const std::string& kind,
+                                            const mkldnn_convolution_desc_t& desc,
+                                            const mkldnn::primitive_attr& attr);
+                static std::string make_key(const std::string& kind,
+                                            const mkldnn_inner_product_desc_t& desc,
+                                            const mkldnn::primitive_attr& attr);
+                static std::string make_key(const std::string& kind,
+                                            const mkldnn_pooling_desc_t& desc);
+
+                /// \brief Key of a backward primitive descriptor, which also depends on the
+                ///     forward descriptor used as its hint.
+                static std::string make_backward_key(const std::string& kind,
+                                                     const mkldnn_convolution_desc_t& desc,
+                                                     const mkldnn_convolution_desc_t& fwd_desc);
+
+                bool is_enabled() const;
+                /// \brief Changes the number of descriptors kept, evicting the least recently
+                ///     used ones if there are more. 0 disables the cache.
+                void set_capacity(size_t capacity);
+                size_t get_capacity() const;
+                Stats get_stats() const;
+
+            private:
+                MKLDNNPrimitiveCache();
+                MKLDNNPrimitiveCache(const MKLDNNPrimitiveCache&) = delete;
+                MKLDNNPrimitiveCache& operator=(const MKLDNNPrimitiveCache&) = delete;
+
+                std::shared_ptr<void> lookup(const std::string& key);
+                void insert(const std::string& key,
+                            std::shared_ptr<void> desc,
+                            int64_t build_time_us);
+                void evict();
+
+                using Entry = std::pair<std::string, std::shared_ptr<void>>;
+
+                mutable std::mutex m_mutex;
+                size_t m_capacity;
+                // Most recently used first
+                std::list<Entry> m_entries;
+                std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+                Stats m_stats;
+            };
+        }
+    }
+}
@@ -18,6 +18,7 @@
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/state/philox.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -27,14 +28,23 @@ op::Dropout::Dropout(const std::shared_ptr<Node>& input,
                      const std::shared_ptr<Node>& gm_const,
                      const std::shared_ptr<Node>& use_seed,
                      const std::shared_ptr<Node>& seed,
-                     const std::shared_ptr<Node>& keep_prob)
+                     const std::shared_ptr<Node>& keep_prob,
+                     bool packed_mask)
     : Op("Dropout", check_single_output_args({input, gm_const, use_seed, seed, keep_prob}))
+    , m_packed_mask(packed_mask)
 {
     constructor_validate_and_infer_types();
 
     set_output_size(2);
     set_output_type(0, get_input_element_type(0), input->get_shape());
-    set_output_type(1, get_input_element_type(0), input->get_shape());
+    if (m_packed_mask)
+    {
+        set_output_type(1, element::u8, Shape{philox::packed_size(shape_size(input->get_shape()))});
+    }
+    else
+    {
+        set_output_type(1, get_input_element_type(0), input->get_shape());
+    }
 }
 
 shared_ptr<Node> op::Dropout::copy_with_new_args(const NodeVector& new_args) const
@@ -44,8 +54,12 @@ shared_ptr<Node> op::Dropout::copy_with_new_args(const NodeVector& new_args) con
         throw ngraph_error("Incorrect number of new arguments");
     }
 
-    return make_shared<Dropout>(
-        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), new_args.at(4));
+    return make_shared<Dropout>(new_args.at(0),
+                                new_args.at(1),
+                                new_args.at(2),
+                                new_args.at(3),
+                                new_args.at(4),
+                                m_packed_mask);
 }
 
 bool op::Dropout::get_use_seed() const
@@ -69,3 +83,46 @@ uint64_t op::Dropout::get_seed() const
     }
     return seed;
 }
+
+double op::Dropout::get_keep_prob() const
+{
+    double keep_prob = 0;
+    if (auto const_op = dynamic_pointer_cast<op::Constant>(get_argument(4)))
+    {
+        auto keep_prob_ptr = static_cast<const double*>(const_op->get_data_ptr());
+        keep_prob = *keep_prob_ptr;
+    }
+    return keep_prob;
+}
+
+op::DropoutBackprop::DropoutBackprop(const std::shared_ptr<Node>& delta,
+                                     const std::shared_ptr<Node>& packed_mask)
+    : Op("DropoutBackprop", check_single_output_args({delta, packed_mask}))
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::DropoutBackprop::validate_and_infer_types()
+{
+    const auto& delta_shape = get_input_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1) == element::u8,
+                          "Packed mask element type (",
+                          get_input_element_type(1),
+                          ") must be u8");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_shape(1) == Shape{philox::packed_size(shape_size(delta_shape))},
+                          "Packed mask shape (",
+                          get_input_shape(1),
+                          ") does not hold one bit per element of delta shape (",
+                          delta_shape,
+                          ")");
+
+    set_output_type(0, get_input_element_type(0), delta_shape);
+}
+
+shared_ptr<Node> op::DropoutBackprop::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<DropoutBackprop>(new_args.at(0), new_args.at(1));
+}
@@ -23,6 +23,9 @@ namespace ngraph
 {
     namespace op
     {
+        /// \brief Fused GenerateMask, Multiply and Divide. The second output is the mask; with
+        ///     packed_mask it holds one bit per element in a u8 tensor of shape
+        ///     [ceil(n / 8)], which DropoutBackprop consumes.
         class Dropout : public Op
         {
         public:
@@ -30,11 +33,29 @@ namespace ngraph
                     const std::shared_ptr<Node>& gm_const,
                     const std::shared_ptr<Node>& use_seed,
                     const std::shared_ptr<Node>& seed,
-                    const std::shared_ptr<Node>& keep_prob); // keep_prob = 1 - dropout_prob
+                    const std::shared_ptr<Node>& keep_prob, // keep_prob = 1 - dropout_prob
+                    bool packed_mask = false);
 
             bool get_use_seed() const;
             uint64_t get_seed() const;
             double get_keep_prob() const;
+            bool get_packed_mask() const { return m_packed_mask; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            bool m_packed_mask;
+        };
+
+        /// \brief Passes through the elements of delta whose bit is set in a packed Dropout
+        ///     mask and zeroes the rest.
+        class DropoutBackprop : public Op
+        {
+        public:
+            DropoutBackprop(const std::shared_ptr<Node>& delta,
+                            const std::shared_ptr<Node>& packed_mask);
+
+            void validate_and_infer_types() override;
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
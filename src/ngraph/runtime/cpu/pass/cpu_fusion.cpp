@@ -39,6 +39,8 @@
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_bag.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/quantized_avg_pool.hpp"
@@ -976,18 +978,49 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_dropout()
             return false;
         }
 
+        // When the mask is otherwise only used to multiply gradients (as in the backprop
+        // of dropout) it is kept as one bit per element and consumed by DropoutBackprop
+        auto forward_mult = m_div->get_argument(0);
+        NodeVector backprop_mults;
+        bool packed_mask = true;
+        for (auto user : gm->get_users())
+        {
+            if (user == forward_mult)
+            {
+                continue;
+            }
+            if (!std::dynamic_pointer_cast<ngraph::op::Multiply>(user) ||
+                user->get_shape() != gm->get_shape() ||
+                user->get_argument(0) == user->get_argument(1))
+            {
+                packed_mask = false;
+                break;
+            }
+            backprop_mults.push_back(user);
+        }
+
         auto dropout_n = std::make_shared<ngraph::op::Dropout>(pattern_map[x],
                                                                gm->get_argument(0),
                                                                gm->get_argument(2),
                                                                gm->get_argument(3),
-                                                               gm->get_argument(4));
+                                                               gm->get_argument(4),
+                                                               packed_mask);
 
         auto goe1 = std::make_shared<ngraph::op::GetOutputElement>(dropout_n, 0);
         ngraph::replace_node(m.get_match_root(), goe1);
 
         auto goe2 = std::make_shared<ngraph::op::GetOutputElement>(dropout_n, 1);
-        ngraph::replace_node(pattern_map[genmask_label], goe2);
-
+        if (!packed_mask)
+        {
+            ngraph::replace_node(pattern_map[genmask_label], goe2);
+            return true;
+        }
+        for (auto mult : backprop_mults)
+        {
+            auto delta = mult->get_argument(0) == gm ? mult->get_argument(1)
+                                                     : mult->get_argument(0);
+            ngraph::replace_node(mult, std::make_shared<ngraph::op::DropoutBackprop>(delta, goe2));
+        }
         return true;
     };
 
@@ -1861,6 +1894,62 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_update_slice()
     this->add_matcher(m, callback);
 }
 
+// EmbeddingLookup([B, L] indices) + Sum over L -> EmbeddingBag with B bags of L indices each
+void ngraph::runtime::cpu::pass::CPUFusion::construct_embedding_bag()
+{
+    auto indices = std::make_shared<pattern::op::Label>(element::i64, Shape{2, 3});
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 4});
+    auto lookup = std::make_shared<ngraph::op::EmbeddingLookup>(indices, weights);
+    auto lookup_label = std::make_shared<pattern::op::Label>(lookup, nullptr, NodeVector{lookup});
+    auto sum = std::make_shared<ngraph::op::Sum>(lookup_label, AxisSet{1});
+
+    auto callback = [indices, weights, lookup_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for embedding_bag = " << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+        auto sum_m = std::static_pointer_cast<ngraph::op::Sum>(m.get_match_root());
+        auto indices_m = pattern_map[indices];
+
+        if (indices_m->get_element_type() != element::i32 &&
+            indices_m->get_element_type() != element::i64)
+        {
+            NGRAPH_DEBUG << "EmbeddingBag requires integral indices";
+            return false;
+        }
+
+        if (indices_m->get_shape().size() != 2 || sum_m->get_reduction_axes() != AxisSet{1})
+        {
+            NGRAPH_DEBUG << "Only a sum over the bag axis of 2D indices can be fused";
+            return false;
+        }
+
+        if (pattern_map[lookup_label]->get_users().size() > 1)
+        {
+            NGRAPH_DEBUG << "EmbeddingBag cannot be created, lookup result required elsewhere";
+            return false;
+        }
+
+        size_t bag_count = indices_m->get_shape()[0];
+        size_t bag_size = indices_m->get_shape()[1];
+        std::vector<int64_t> offsets(bag_count);
+        for (size_t b = 0; b < bag_count; b++)
+        {
+            offsets[b] = static_cast<int64_t>(b * bag_size);
+        }
+
+        auto flat_indices = std::make_shared<ngraph::op::Reshape>(
+            indices_m, AxisVector{0, 1}, Shape{bag_count * bag_size});
+        auto offsets_const =
+            ngraph::op::Constant::create(indices_m->get_element_type(), Shape{bag_count}, offsets);
+        auto embedding_bag = std::make_shared<ngraph::op::EmbeddingBag>(
+            flat_indices, pattern_map[weights], offsets_const);
+        ngraph::replace_node(m.get_match_root(), embedding_bag);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(sum, "CPUFusion.EmbeddingBag");
+    this->add_matcher(m, callback);
+}
+
 // QuantizedConvolution + Dequantize + Relu -> QuantizedConvolutionRelu + Dequantize
 void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qconv_relu(bool with_bias)
 {
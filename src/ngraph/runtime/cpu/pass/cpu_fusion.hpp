@@ -70,6 +70,7 @@ public:
             construct_conv_add();
             construct_conv_add_relu();
             construct_update_slice();
+            construct_embedding_bag();
             construct_fuse_lstm_recurrent_state();
             if (std::getenv("NGRAPH_DECONV_FUSE") != nullptr)
             {
@@ -103,6 +104,7 @@ private:
     void construct_groupconv_batchnorm_global_stats_folding();
     void construct_groupconv_batchnorm_global_stats_folding_relu();
     void construct_update_slice();
+    void construct_embedding_bag();
     void construct_fuse_lstm_recurrent_state();
     void construct_deconvolution_affine_folding();
     void construct_deconvolution_affine_folding_relu();
@@ -15,10 +15,13 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstdlib>
 #include <memory>
+#include <set>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
 
 #include <mkldnn.hpp>
 
@@ -293,8 +296,52 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
     }
 }
 
-void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
-                               std::shared_ptr<ngraph::Node> node)
+static bool is_native_md(const mkldnn::memory::desc& md, const Shape& shape, element::Type et)
+{
+    return mkldnn_utils::compare_mkldnn_mds(
+        md, mkldnn_utils::create_blocked_mkldnn_md(shape, row_major_strides(shape), et));
+}
+
+// NGRAPH_PASS_CPU_LAYOUT_ELTWISE selects the argument whose layout a binary eltwise op and its
+// output adopt: 0 or 1 for that argument, or "users" to choose by what the output's users
+// prefer (see compute_blocked_layout_preferences). The first argument is used by default.
+static bool use_eltwise_layout_preferences()
+{
+    const char* env = std::getenv("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
+    return env != nullptr && std::string(env) == "users";
+}
+
+// When one argument is in a blocked MKLDNN layout and the other is native, either choice costs
+// one reorder of the same size here, so the users' preference decides. This only looks one
+// eltwise chain ahead and does not model how fast kernels run in either layout.
+static int select_eltwise_layout(const std::shared_ptr<ngraph::Node>& node,
+                                 const std::vector<mkldnn::memory::desc>& arg_mds,
+                                 int64_t blocked_preference)
+{
+    if (!use_eltwise_layout_preferences())
+    {
+        const char* env = std::getenv("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
+        const int user_select = env != nullptr ? std::atoi(env) : 0;
+        return user_select == 1 ? 1 : 0;
+    }
+    if (blocked_preference == 0)
+    {
+        return 0;
+    }
+    bool native0 =
+        is_native_md(arg_mds[0], node->get_input_shape(0), node->get_input_element_type(0));
+    bool native1 =
+        is_native_md(arg_mds[1], node->get_input_shape(1), node->get_input_element_type(1));
+    if (native0 == native1)
+    {
+        return 0;
+    }
+    return ((blocked_preference > 0) == native0) ? 1 : 0;
+}
+
+static void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
+                                      std::shared_ptr<ngraph::Node> node,
+                                      int64_t blocked_preference)
 {
     std::vector<mkldnn::memory::desc> arg_mds{mkldnn_utils::get_input_mkldnn_md(node.get(), 0),
                                               mkldnn_utils::get_input_mkldnn_md(node.get(), 1)};
@@ -308,13 +355,7 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
     {
         vector<memory::desc> i_mds;
         vector<memory::desc> o_mds;
-        int select = 0;
-        char* ngraph_pass_cpu_layout_eltwise = std::getenv("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
-        if (ngraph_pass_cpu_layout_eltwise != nullptr)
-        {
-            const int user_select = std::atoi(ngraph_pass_cpu_layout_eltwise);
-            select = (user_select == 0 || user_select == 1) ? user_select : select;
-        }
+        int select = select_eltwise_layout(node, arg_mds, blocked_preference);
         i_mds.push_back(arg_mds[select]);
         i_mds.push_back(arg_mds[select]);
         o_mds.push_back(arg_mds[select]);
@@ -2403,8 +2444,119 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::QuantizedMatmul>},
 };
 
+// Ops whose MKLDNN kernels request blocked layouts (e.g. nChw16c) for their data inputs
+static const std::set<std::type_index> s_blocked_layout_ops{
+    TI(ngraph::op::AvgPool),
+    TI(ngraph::op::AvgPoolBackprop),
+    TI(ngraph::op::BatchNormInference),
+    TI(ngraph::op::BatchNormInferenceRelu),
+    TI(ngraph::op::BatchNormTraining),
+    TI(ngraph::op::BatchNormTrainingBackprop),
+    TI(ngraph::op::BatchNormTrainingRelu),
+    TI(ngraph::op::Convolution),
+    TI(ngraph::op::ConvolutionAdd),
+    TI(ngraph::op::ConvolutionBackpropData),
+    TI(ngraph::op::ConvolutionBackpropFilters),
+    TI(ngraph::op::ConvolutionBias),
+    TI(ngraph::op::ConvolutionBiasAdd),
+    TI(ngraph::op::ConvolutionBiasBackpropFiltersBias),
+    TI(ngraph::op::ConvolutionRelu),
+    TI(ngraph::op::DeconvolutionBias),
+    TI(ngraph::op::GroupConvolution),
+    TI(ngraph::op::GroupConvolutionBias),
+    TI(ngraph::op::LRN),
+    TI(ngraph::op::MaxPool),
+    TI(ngraph::op::MaxPoolBackprop),
+    TI(ngraph::op::MaxPoolWithIndices),
+    TI(ngraph::op::MaxPoolWithIndicesBackprop),
+    TI(ngraph::op::QuantizedAvgPool),
+    TI(ngraph::op::QuantizedConvolution),
+    TI(ngraph::op::QuantizedConvolutionBias),
+    TI(ngraph::op::QuantizedConvolutionBiasAdd),
+    TI(ngraph::op::QuantizedConvolutionBiasSignedAdd),
+    TI(ngraph::op::QuantizedConvolutionRelu),
+    TI(ngraph::op::QuantizedMaxPool),
+};
+
+static bool is_eltwise(const std::shared_ptr<Node>& node)
+{
+    return dynamic_pointer_cast<ngraph::op::util::UnaryElementwiseArithmetic>(node) != nullptr ||
+           dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(node) != nullptr;
+}
+
+// For every single-output op, how many bytes of layout conversion its users would be spared if
+// the output were in a blocked MKLDNN layout rather than the native one (negative when the
+// native layout is preferred). MKLDNN data kernels prefer blocked layouts, ops handled by
+// set_native_layouts prefer the native one, and elementwise ops run equally well on either and
+// pass on the preference of their own users. Other layout-aware ops (Reshape, Slice, ...) are
+// treated as indifferent.
+static unordered_map<Node*, int64_t>
+    compute_blocked_layout_preferences(const std::list<std::shared_ptr<Node>>& nodes)
+{
+    unordered_map<Node*, int64_t> preferences;
+    for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+    {
+        const shared_ptr<Node>& node = *it;
+        if (node->get_output_size() != 1)
+        {
+            continue;
+        }
+        int64_t bytes = shape_size(node->get_shape()) * node->get_element_type().size();
+        int64_t preference = 0;
+        for (const shared_ptr<Node>& user : node->get_users())
+        {
+            auto& u = *user;
+            if (s_blocked_layout_ops.count(TI(u)) != 0)
+            {
+                preference += mkldnn_utils::use_mkldnn_kernel(user.get()) ? bytes : -bytes;
+            }
+            else if (is_eltwise(user))
+            {
+                auto user_preference = preferences.find(user.get());
+                if (user_preference != preferences.end())
+                {
+                    preference += user_preference->second;
+                }
+            }
+            else if (auto result = dynamic_pointer_cast<ngraph::op::Result>(user))
+            {
+                preference -= result->needs_default_layout() ? bytes : 0;
+            }
+            else if (s_dispatcher.find(TI(u)) == s_dispatcher.end())
+            {
+                preference -= bytes;
+            }
+        }
+        preferences[node.get()] = preference;
+    }
+    return preferences;
+}
+
+// Number and total size of the layout conversions in a graph
+static pair<size_t, size_t> count_layout_conversions(const std::list<std::shared_ptr<Node>>& nodes)
+{
+    size_t count = 0;
+    size_t bytes = 0;
+    for (const shared_ptr<Node>& node : nodes)
+    {
+        if (dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node) != nullptr)
+        {
+            count++;
+            bytes += shape_size(node->get_shape()) * node->get_element_type().size();
+        }
+    }
+    return make_pair(count, bytes);
+}
+
 bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::shared_ptr<Node>>& nodes)
 {
+    auto conversions_before = count_layout_conversions(nodes);
+    unordered_map<Node*, int64_t> preferences;
+    if (use_eltwise_layout_preferences())
+    {
+        preferences = compute_blocked_layout_preferences(nodes);
+    }
+
     for (const auto& node : nodes)
     {
         auto& n = *node;
@@ -2421,7 +2573,7 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         else if (dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(node) !=
                  nullptr)
         {
-            set_layouts_binaryeltwise(m_external_function, node);
+            set_layouts_binaryeltwise(m_external_function, node, preferences[node.get()]);
         }
         else
         {
@@ -2429,5 +2581,10 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         }
     }
 
+    auto conversions = count_layout_conversions(m_external_function->get_function()->get_ops());
+    NGRAPH_DEBUG << "CPULayout: layout conversions went from " << conversions_before.first << " ("
+                 << conversions_before.second << " bytes) to " << conversions.first << " ("
+                 << conversions.second << " bytes)";
+
     return false;
 }
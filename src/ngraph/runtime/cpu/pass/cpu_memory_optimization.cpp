@@ -52,12 +52,34 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/reshape.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
 using namespace ngraph;
 
+// A non-transposing Reshape whose only user is the concat, and whose input is an intermediate
+// result used by nothing else, can pass the concat's buffer through to that result. This lets
+// flattened tensors (e.g. the gradients packed by AllReduceBucketing) be concatenated in place.
+static bool is_pass_through_reshape(const std::shared_ptr<Node>& arg)
+{
+    if (arg->description() != "Reshape" || arg->get_users().size() != 1 ||
+        std::static_pointer_cast<ngraph::op::Reshape>(arg)->get_is_transpose())
+    {
+        return false;
+    }
+    const auto& input_output = arg->get_inputs().at(0).get_output();
+    auto producer = input_output.get_node();
+    if (producer->is_constant() || producer->is_parameter() || !producer->is_op() ||
+        producer->get_output_size() != 1 || input_output.get_inputs().size() != 1)
+    {
+        return false;
+    }
+    auto annotation = std::static_pointer_cast<ngraph::op::Op>(producer)->get_op_annotations();
+    return !annotation || annotation->get_in_place_oi_pairs().empty();
+}
+
 bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<Function> function)
 {
     for (auto n : function->get_ordered_ops())
@@ -136,8 +158,8 @@ bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<
                     {
                         auto op = std::static_pointer_cast<ngraph::op::Op>(arg);
                         auto annotation = op->get_op_annotations();
-                        if (annotation && annotation->get_in_place_oi_pairs().size() > 0)
-
+                        if (annotation && annotation->get_in_place_oi_pairs().size() > 0 &&
+                            !is_pass_through_reshape(arg))
                         {
                             NGRAPH_DEBUG << "cpu_memory_optimization: " << arg->get_name()
                                          << ": in place non-concat op, no in place concat";
@@ -230,6 +230,7 @@ void runtime::dynamic::DynamicTensor::write(const void* p, size_t n)
     NGRAPH_CHECK(m_wrapped_tensor != nullptr,
                  "tried to write to a dynamic tensor with no allocated storage");
     m_wrapped_tensor->write(p, n);
+    update_version();
 }
 
 void runtime::dynamic::DynamicTensor::read(void* p, size_t n) const
@@ -244,6 +245,7 @@ void runtime::dynamic::DynamicTensor::copy_from(const ngraph::runtime::Tensor& s
     NGRAPH_CHECK(m_wrapped_tensor != nullptr,
                  "tried to copy_from to a dynamic tensor with no allocated storage");
     m_wrapped_tensor->copy_from(source);
+    update_version();
 }
 
 bool runtime::dynamic::DynamicTensor::has_storage() const
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -51,6 +53,18 @@ public:
     bool call_with_validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+    /// \brief Starts a single iteration of a Function without blocking the caller.
+    ///
+    /// The default implementation runs call() on runtime::ThreadPool::get_default() and
+    /// serializes executions of this Executable. The Executable and all tensors must remain
+    /// valid until the returned future is ready.
+    /// \param outputs vector of runtime::Tensor used as outputs
+    /// \param inputs vector of runtime::Tensor used as inputs
+    /// \returns future holding the value returned by call()
+    virtual std::future<bool>
+        call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
     /// \brief Collect performance information gathered on a Function.
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
@@ -82,4 +96,5 @@ protected:
 private:
     ngraph::ParameterVector m_parameters;
     ngraph::ResultVector m_results;
+    std::mutex m_async_call_mutex;
 };
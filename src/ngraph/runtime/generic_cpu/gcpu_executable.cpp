@@ -231,7 +231,7 @@ vector<runtime::PerformanceCounter> runtime::gcpu::GCPUExecutable::get_performan
     vector<runtime::PerformanceCounter> rc;
     for (const pair<const Node*, stopwatch> p : m_timer_map)
     {
-        rc.emplace_back(p.first->get_name().c_str(),
+        rc.emplace_back(p.first->shared_from_this(),
                         p.second.get_total_microseconds(),
                         p.second.get_call_count());
     }
@@ -23,17 +23,21 @@
 #include <vector>
 
 #include "ngraph/op/all.hpp"
+#include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/any.hpp"
 #include "ngraph/op/argmax.hpp"
 #include "ngraph/op/argmin.hpp"
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/broadcast_distributed.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_bag.hpp"
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/shape_of.hpp"
@@ -48,11 +52,13 @@
 #include "ngraph/op/passthrough.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
+#include "ngraph/op/recv.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/send.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sum.hpp"
@@ -60,8 +66,15 @@
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/broadcast.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/concat.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/convolution.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/dot.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/pool.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/reduce.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/reshape.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/slice.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/generic_cpu/node_wrapper.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/node_wrapper.hpp"
@@ -77,6 +90,7 @@
 #include "ngraph/runtime/reference/asin.hpp"
 #include "ngraph/runtime/reference/atan.hpp"
 #include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/batch_mat_mul.hpp"
 #include "ngraph/runtime/reference/batch_norm.hpp"
 #include "ngraph/runtime/reference/broadcast_distributed.hpp"
 #include "ngraph/runtime/reference/ceiling.hpp"
@@ -89,8 +103,10 @@
 #include "ngraph/runtime/reference/cosh.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
+#include "ngraph/runtime/reference/embedding_bag.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/equal.hpp"
+#include "ngraph/runtime/reference/erf.hpp"
 #include "ngraph/runtime/reference/exp.hpp"
 #include "ngraph/runtime/reference/floor.hpp"
 #include "ngraph/runtime/reference/gather.hpp"
@@ -117,6 +133,7 @@
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/recv.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
 #include "ngraph/runtime/reference/replace_slice.hpp"
 #include "ngraph/runtime/reference/result.hpp"
@@ -125,6 +142,7 @@
 #include "ngraph/runtime/reference/scatter_add.hpp"
 #include "ngraph/runtime/reference/scatter_nd_add.hpp"
 #include "ngraph/runtime/reference/select.hpp"
+#include "ngraph/runtime/reference/send.hpp"
 #include "ngraph/runtime/reference/shape_of.hpp"
 #include "ngraph/runtime/reference/sigmoid.hpp"
 #include "ngraph/runtime/reference/sign.hpp"
@@ -205,8 +223,10 @@ private:
         case OP_TYPEID::Abs:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::abs<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            kernel::unary(static_cast<const T*>(args[0]),
+                          static_cast<T*>(out[0]),
+                          element_count,
+                          [](T x) -> T { return (x < 0 ? -x : x); });
             break;
         }
         case OP_TYPEID::Acos:
@@ -218,11 +238,13 @@ private:
         }
         case OP_TYPEID::Add:
         {
-            size_t element_count = shape_size(node.get_output_shape(0));
-            reference::add<T>(static_cast<const T*>(args[0]),
-                              static_cast<const T*>(args[1]),
-                              static_cast<T*>(out[0]),
-                              element_count);
+            kernel::binary(static_cast<const T*>(args[0]),
+                           static_cast<const T*>(args[1]),
+                           static_cast<T*>(out[0]),
+                           node.get_input_shape(0),
+                           node.get_input_shape(1),
+                           node.get_output_shape(0),
+                           [](T x, T y) -> T { return x + y; });
             break;
         }
         case OP_TYPEID::All:
@@ -237,9 +259,12 @@ private:
         }
         case OP_TYPEID::AllReduce:
         {
+            const ngraph::op::AllReduce* allreduce =
+                static_cast<const ngraph::op::AllReduce*>(&node);
             reference::allreduce<T>(static_cast<T*>(const_cast<void*>(args[0])),
                                     static_cast<T*>(out[0]),
-                                    node.get_input_element_type(0),
+                                    node.get_input_element_type(0).get_type_enum(),
+                                    allreduce->get_reduce_type(),
                                     static_cast<int>(shape_size(node.get_input_shape(0))));
             break;
         }
@@ -332,15 +357,15 @@ private:
         {
             const op::AvgPool* avg_pool = static_cast<const op::AvgPool*>(&node);
 
-            reference::avg_pool<T>(static_cast<const T*>(args[0]),
-                                   static_cast<T*>(out[0]),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   avg_pool->get_window_shape(),
-                                   avg_pool->get_window_movement_strides(),
-                                   avg_pool->get_padding_below(),
-                                   avg_pool->get_padding_above(),
-                                   avg_pool->get_include_padding_in_avg_computation());
+            kernel::avg_pool<T>(static_cast<const T*>(args[0]),
+                                static_cast<T*>(out[0]),
+                                node.get_input_shape(0),
+                                node.get_output_shape(0),
+                                avg_pool->get_window_shape(),
+                                avg_pool->get_window_movement_strides(),
+                                avg_pool->get_padding_below(),
+                                avg_pool->get_padding_above(),
+                                avg_pool->get_include_padding_in_avg_computation());
             break;
         }
         case OP_TYPEID::GenerateMask:
@@ -369,6 +394,16 @@ private:
             std::memcpy(static_cast<T*>(out[0]), args[n], num_bytes);
             break;
         }
+        case OP_TYPEID::BatchMatMul:
+        {
+            reference::batch_mat_mul(static_cast<const T*>(args[0]),
+                                     static_cast<const T*>(args[1]),
+                                     static_cast<T*>(out[0]),
+                                     node.get_input_shape(0),
+                                     node.get_input_shape(1),
+                                     node.get_output_shape(0));
+            break;
+        }
         case OP_TYPEID::BatchNormTraining:
         {
             const ngraph::op::BatchNormTraining* bn =
@@ -443,23 +478,27 @@ private:
         }
         case OP_TYPEID::BroadcastDistributed:
         {
+            const ngraph::op::BroadcastDistributed* broadcast =
+                static_cast<const ngraph::op::BroadcastDistributed*>(&node);
             int rank_ID = get_distributed_interface()->get_rank();
-            if (rank_ID == 0)
+            int root_id = broadcast->get_root_id();
+            if (rank_ID == root_id)
             {
                 reference::broadcastdistributed<T>(
-                    static_cast<T*>(args[0]),
-                    node.get_input_element_type(0),
-                    static_cast<int>(shape_size(node.get_input_shape(0))));
-                auto memSize = static_cast<int>(shape_size(node.get_input_shape(0))) *
-                               sizeof(node.get_input_element_type(0));
+                    static_cast<T*>(const_cast<void*>(args[0])),
+                    node.get_input_element_type(0).get_type_enum(),
+                    static_cast<int>(shape_size(node.get_input_shape(0))),
+                    root_id);
+                auto memSize = static_cast<int>(shape_size(node.get_input_shape(0))) * sizeof(T);
                 memcpy(out[0], args[0], memSize);
             }
             else
             {
                 reference::broadcastdistributed<T>(
                     static_cast<T*>(out[0]),
-                    node.get_input_element_type(0),
-                    static_cast<int>(shape_size(node.get_input_shape(0))));
+                    node.get_input_element_type(0).get_type_enum(),
+                    static_cast<int>(shape_size(node.get_input_shape(0))),
+                    root_id);
             }
             break;
         }
@@ -481,11 +520,11 @@ private:
                 in_args.push_back(static_cast<const T*>(args[i]));
                 in_shapes.push_back(node.get_input_shape(i));
             }
-            reference::concat<T>(in_args,
-                                 static_cast<T*>(out[0]),
-                                 in_shapes,
-                                 node.get_output_shape(0),
-                                 concat->get_concatenation_axis());
+            kernel::concat<T>(in_args,
+                              static_cast<T*>(out[0]),
+                              in_shapes,
+                              node.get_output_shape(0),
+                              concat->get_concatenation_axis());
             break;
         }
         case OP_TYPEID::Constant:
@@ -551,6 +590,7 @@ private:
             case element::Type_t::undefined:
             case element::Type_t::dynamic:
             case element::Type_t::bf16:
+            case element::Type_t::f16:
                 ss << "unsupported element type " << type << " op Convert";
                 throw std::runtime_error(ss.str());
             }
@@ -559,48 +599,34 @@ private:
         case OP_TYPEID::Convolution:
         {
             const op::Convolution* c = static_cast<const op::Convolution*>(&node);
-            reference::convolution<T>(static_cast<const T*>(args[0]),
-                                      static_cast<const T*>(args[1]),
-                                      static_cast<T*>(out[0]),
-                                      node.get_input_shape(0),
-                                      node.get_input_shape(1),
-                                      node.get_output_shape(0),
-                                      c->get_window_movement_strides(),
-                                      c->get_window_dilation_strides(),
-                                      c->get_padding_below(),
-                                      c->get_padding_above(),
-                                      c->get_data_dilation_strides(),
-                                      0,
-                                      1,
-                                      1,
-                                      0,
-                                      0,
-                                      1,
-                                      false);
+            kernel::convolution<T>(static_cast<const T*>(args[0]),
+                                   static_cast<const T*>(args[1]),
+                                   static_cast<T*>(out[0]),
+                                   node.get_input_shape(0),
+                                   node.get_input_shape(1),
+                                   node.get_output_shape(0),
+                                   c->get_window_movement_strides(),
+                                   c->get_window_dilation_strides(),
+                                   c->get_padding_below(),
+                                   c->get_padding_above(),
+                                   c->get_data_dilation_strides());
             break;
         }
         case OP_TYPEID::ConvolutionBackpropFilters:
         {
             const op::ConvolutionBackpropFilters* c =
                 static_cast<const op::ConvolutionBackpropFilters*>(&node);
-            reference::convolution<T>(static_cast<const T*>(args[0]),
-                                      static_cast<const T*>(args[1]),
-                                      static_cast<T*>(out[0]),
-                                      node.get_input_shape(0),
-                                      node.get_input_shape(1),
-                                      node.get_output_shape(0),
-                                      c->get_window_movement_strides_backward(),
-                                      c->get_window_dilation_strides_backward(),
-                                      c->get_padding_below_backward(),
-                                      c->get_padding_above_backward(),
-                                      c->get_data_dilation_strides_backward(),
-                                      1,
-                                      0,
-                                      0,
-                                      1,
-                                      1,
-                                      0,
-                                      false);
+            reference::convolution_backprop_filter<T>(static_cast<const T*>(args[0]),
+                                                      static_cast<const T*>(args[1]),
+                                                      static_cast<T*>(out[0]),
+                                                      c->get_input_shape(0),
+                                                      c->get_input_shape(1),
+                                                      c->get_filters_shape(),
+                                                      c->get_window_dilation_strides_forward(),
+                                                      c->get_window_movement_strides_forward(),
+                                                      c->get_padding_below_forward(),
+                                                      c->compute_backward_in_pad_above(),
+                                                      c->get_data_dilation_strides_forward());
             break;
         }
         case OP_TYPEID::ConvolutionBackpropData:
@@ -608,24 +634,17 @@ private:
             // Note that args[1] and args[0] are switched here from the usual order.
             const op::ConvolutionBackpropData* c =
                 static_cast<const op::ConvolutionBackpropData*>(&node);
-            reference::convolution<T>(static_cast<const T*>(args[1]),
-                                      static_cast<const T*>(args[0]),
-                                      static_cast<T*>(out[0]),
-                                      node.get_input_shape(1),
-                                      node.get_input_shape(0),
-                                      node.get_output_shape(0),
-                                      c->get_window_movement_strides_backward(),
-                                      c->get_window_dilation_strides_backward(),
-                                      c->get_padding_below_backward(),
-                                      c->get_padding_above_backward(),
-                                      c->get_data_dilation_strides_backward(),
-                                      0,
-                                      1,
-                                      0,
-                                      1,
-                                      0,
-                                      1,
-                                      true);
+            reference::convolution_backprop_in<T>(static_cast<const T*>(args[1]),
+                                                  static_cast<const T*>(args[0]),
+                                                  static_cast<T*>(out[0]),
+                                                  c->get_input_shape(1),
+                                                  c->get_input_shape(0),
+                                                  c->get_data_batch_shape(),
+                                                  c->get_data_dilation_strides_forward(),
+                                                  c->get_window_dilation_strides_forward(),
+                                                  c->compute_backward_delta_out_pad_below(),
+                                                  c->compute_backward_delta_out_pad_above(),
+                                                  c->get_window_movement_strides_forward());
             break;
         }
         case OP_TYPEID::Cos:
@@ -679,12 +698,13 @@ private:
         case OP_TYPEID::Divide:
         {
             const op::Divide* divop = static_cast<const op::Divide*>(&node);
-            size_t element_count = shape_size(node.get_output_shape(0));
-            reference::divide<T>(static_cast<const T*>(args[0]),
-                                 static_cast<const T*>(args[1]),
-                                 static_cast<T*>(out[0]),
-                                 element_count,
-                                 divop->is_pythondiv());
+            kernel::divide<T>(static_cast<const T*>(args[0]),
+                              static_cast<const T*>(args[1]),
+                              static_cast<T*>(out[0]),
+                              node.get_input_shape(0),
+                              node.get_input_shape(1),
+                              node.get_output_shape(0),
+                              divop->is_pythondiv());
             break;
         }
         case OP_TYPEID::Dot:
@@ -700,6 +720,47 @@ private:
                               dot->get_reduction_axes_count());
             break;
         }
+        case OP_TYPEID::EmbeddingBag:
+        {
+            const op::EmbeddingBag* bag = static_cast<const op::EmbeddingBag*>(&node);
+            auto type = node.get_input_element_type(0);
+            size_t indices_count = shape_size(node.get_input_shape(0));
+            size_t bag_count = shape_size(node.get_input_shape(2));
+            size_t vec_len = node.get_output_shape(0).at(1);
+            const T* per_sample_weights =
+                bag->has_per_sample_weights() ? static_cast<const T*>(args[3]) : nullptr;
+
+            if (type == element::i32)
+            {
+                reference::embedding_bag<T, int32_t>(static_cast<const int32_t*>(args[0]),
+                                                     static_cast<const T*>(args[1]),
+                                                     static_cast<const int32_t*>(args[2]),
+                                                     per_sample_weights,
+                                                     static_cast<T*>(out[0]),
+                                                     indices_count,
+                                                     bag_count,
+                                                     vec_len,
+                                                     bag->get_mode());
+            }
+            else if (type == element::i64)
+            {
+                reference::embedding_bag<T, int64_t>(static_cast<const int64_t*>(args[0]),
+                                                     static_cast<const T*>(args[1]),
+                                                     static_cast<const int64_t*>(args[2]),
+                                                     per_sample_weights,
+                                                     static_cast<T*>(out[0]),
+                                                     indices_count,
+                                                     bag_count,
+                                                     vec_len,
+                                                     bag->get_mode());
+            }
+            else
+            {
+                throw ngraph_error(std::string("Unsupported index type ") + type.c_type_string() +
+                                   std::string(" in EmbeddingBag"));
+            }
+            break;
+        }
         case OP_TYPEID::EmbeddingLookup:
         {
             const op::EmbeddingLookup* embed = static_cast<const op::EmbeddingLookup*>(&node);
@@ -745,6 +806,13 @@ private:
             }
             break;
         }
+        case OP_TYPEID::Erf:
+        {
+            size_t element_count = shape_size(node.get_output_shape(0));
+            reference::erf<T>(
+                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            break;
+        }
         case OP_TYPEID::Equal:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -757,8 +825,10 @@ private:
         case OP_TYPEID::Exp:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::exp<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            kernel::unary(static_cast<const T*>(args[0]),
+                          static_cast<T*>(out[0]),
+                          element_count,
+                          [](T x) -> T { return std::exp(x); });
             break;
         }
         case OP_TYPEID::Floor:
@@ -773,9 +843,9 @@ private:
             const op::Gather* gather = static_cast<const op::Gather*>(&node);
             if (node.get_input_element_type(1) == element::i64)
             {
-                reference::gather<T, int64_t>(args[0]->get_data_ptr<T>(),
-                                              args[1]->get_data_ptr<int64_t>(),
-                                              out[0]->get_data_ptr<T>(),
+                reference::gather<T, int64_t>(static_cast<T*>(const_cast<void*>(args[0])),
+                                              static_cast<int64_t*>(const_cast<void*>(args[1])),
+                                              static_cast<T*>(out[0]),
                                               node.get_input_shape(0),
                                               node.get_input_shape(1),
                                               node.get_output_shape(0),
@@ -783,9 +853,9 @@ private:
             }
             else if (node.get_input_element_type(1) == element::i32)
             {
-                reference::gather<T, int32_t>(args[0]->get_data_ptr<T>(),
-                                              args[1]->get_data_ptr<int32_t>(),
-                                              out[0]->get_data_ptr<T>(),
+                reference::gather<T, int32_t>(static_cast<T*>(const_cast<void*>(args[0])),
+                                              static_cast<int32_t*>(const_cast<void*>(args[1])),
+                                              static_cast<T*>(out[0]),
                                               node.get_input_shape(0),
                                               node.get_input_shape(1),
                                               node.get_output_shape(0),
@@ -801,18 +871,18 @@ private:
         {
             if (node.get_input_element_type(1) == element::i64)
             {
-                reference::gather_nd<T, int64_t>(args[0]->get_data_ptr<T>(),
-                                                 args[1]->get_data_ptr<int64_t>(),
-                                                 out[0]->get_data_ptr<T>(),
+                reference::gather_nd<T, int64_t>(static_cast<T*>(const_cast<void*>(args[0])),
+                                                 static_cast<int64_t*>(const_cast<void*>(args[1])),
+                                                 static_cast<T*>(out[0]),
                                                  node.get_input_shape(0),
                                                  node.get_input_shape(1),
                                                  node.get_output_shape(0));
             }
             else if (node.get_input_element_type(1) == element::i32)
             {
-                reference::gather_nd<T, int32_t>(args[0]->get_data_ptr<T>(),
-                                                 args[1]->get_data_ptr<int32_t>(),
-                                                 out[0]->get_data_ptr<T>(),
+                reference::gather_nd<T, int32_t>(static_cast<T*>(const_cast<void*>(args[0])),
+                                                 static_cast<int32_t*>(const_cast<void*>(args[1])),
+                                                 static_cast<T*>(out[0]),
                                                  node.get_input_shape(0),
                                                  node.get_input_shape(1),
                                                  node.get_output_shape(0));
@@ -862,8 +932,10 @@ private:
         case OP_TYPEID::Log:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::log<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            kernel::unary(static_cast<const T*>(args[0]),
+                          static_cast<T*>(out[0]),
+                          element_count,
+                          [](T x) -> T { return std::log(x); });
             break;
         }
         case OP_TYPEID::LRN:
@@ -881,34 +953,36 @@ private:
         case OP_TYPEID::Max:
         {
             const op::Max* max = static_cast<const op::Max*>(&node);
-            reference::max<T>(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              max->get_reduction_axes());
+            kernel::max<T>(static_cast<const T*>(args[0]),
+                           static_cast<T*>(out[0]),
+                           node.get_input_shape(0),
+                           node.get_output_shape(0),
+                           max->get_reduction_axes());
             break;
         }
         case OP_TYPEID::Maximum:
         {
-            size_t element_count = shape_size(node.get_output_shape(0));
-            reference::maximum<T>(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<T*>(out[0]),
-                                  element_count);
+            kernel::binary(static_cast<const T*>(args[0]),
+                           static_cast<const T*>(args[1]),
+                           static_cast<T*>(out[0]),
+                           node.get_input_shape(0),
+                           node.get_input_shape(1),
+                           node.get_output_shape(0),
+                           [](T x, T y) -> T { return x > y ? x : y; });
             break;
         }
         case OP_TYPEID::MaxPool:
         {
             const op::MaxPool* max_pool = static_cast<const op::MaxPool*>(&node);
 
-            reference::max_pool<T>(static_cast<const T*>(args[0]),
-                                   static_cast<T*>(out[0]),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   max_pool->get_window_shape(),
-                                   max_pool->get_window_movement_strides(),
-                                   max_pool->get_padding_below(),
-                                   max_pool->get_padding_above());
+            kernel::max_pool<T>(static_cast<const T*>(args[0]),
+                                static_cast<T*>(out[0]),
+                                node.get_input_shape(0),
+                                node.get_output_shape(0),
+                                max_pool->get_window_shape(),
+                                max_pool->get_window_movement_strides(),
+                                max_pool->get_padding_below(),
+                                max_pool->get_padding_above());
             break;
         }
         case OP_TYPEID::MaxPoolBackprop:
@@ -930,36 +1004,42 @@ private:
         case OP_TYPEID::Min:
         {
             const op::Min* min = static_cast<const op::Min*>(&node);
-            reference::min<T>(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              min->get_reduction_axes());
+            kernel::min<T>(static_cast<const T*>(args[0]),
+                           static_cast<T*>(out[0]),
+                           node.get_input_shape(0),
+                           node.get_output_shape(0),
+                           min->get_reduction_axes());
             break;
         }
         case OP_TYPEID::Minimum:
         {
-            size_t element_count = shape_size(node.get_output_shape(0));
-            reference::minimum<T>(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<T*>(out[0]),
-                                  element_count);
+            kernel::binary(static_cast<const T*>(args[0]),
+                           static_cast<const T*>(args[1]),
+                           static_cast<T*>(out[0]),
+                           node.get_input_shape(0),
+                           node.get_input_shape(1),
+                           node.get_output_shape(0),
+                           [](T x, T y) -> T { return x < y ? x : y; });
             break;
         }
         case OP_TYPEID::Multiply:
         {
-            size_t element_count = shape_size(node.get_output_shape(0));
-            reference::multiply<T>(static_cast<const T*>(args[0]),
-                                   static_cast<const T*>(args[1]),
-                                   static_cast<T*>(out[0]),
-                                   element_count);
+            kernel::binary(static_cast<const T*>(args[0]),
+                           static_cast<const T*>(args[1]),
+                           static_cast<T*>(out[0]),
+                           node.get_input_shape(0),
+                           node.get_input_shape(1),
+                           node.get_output_shape(0),
+                           [](T x, T y) -> T { return x * y; });
             break;
         }
         case OP_TYPEID::Negative:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::negate<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            kernel::unary(static_cast<const T*>(args[0]),
+                          static_cast<T*>(out[0]),
+                          element_count,
+                          [](T x) -> T { return -x; });
             break;
         }
         case OP_TYPEID::Not:
@@ -1005,11 +1085,11 @@ private:
             reference::pad(static_cast<const T*>(args[0]),
                            static_cast<const T*>(args[1]),
                            static_cast<T*>(out[0]),
-                           node.get_inputs().at(0).get_shape(),
-                           node.get_output_shape(0),
+                           node.input(0).get_shape(),
+                           node.output(0).get_shape(),
                            pad->get_padding_below(),
                            pad->get_padding_above(),
-                           pad->get_padding_interior());
+                           pad->get_pad_mode());
             break;
         }
         case OP_TYPEID::Passthrough:
@@ -1095,11 +1175,28 @@ private:
         {
             throw unsupported_op("Unsupported op '" + node.description() + "'.");
         }
+        case OP_TYPEID::Recv:
+        {
+            size_t element_count = shape_size(node.get_output_shape(0));
+            size_t memSize = element_count * sizeof(T);
+            const auto* op = static_cast<const ngraph::op::Recv*>(&node);
+            int src_id = op->get_src_id();
+
+            reference::recv<T>(static_cast<T*>(const_cast<void*>(args[0])),
+                               node.get_input_element_type(0).get_type_enum(),
+                               element_count,
+                               src_id);
+
+            memcpy(out[0], args[0], memSize);
+            break;
+        }
         case OP_TYPEID::Relu:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::relu<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            kernel::unary(static_cast<const T*>(args[0]),
+                          static_cast<T*>(out[0]),
+                          element_count,
+                          [](T x) -> T { return x > T(0) ? x : T(0); });
             break;
         }
         case OP_TYPEID::ReluBackprop:
@@ -1175,10 +1272,10 @@ private:
         {
             if (node.get_input_element_type(1) == element::i64)
             {
-                reference::scatter_add<T, int64_t>(args[0]->get_data_ptr<T>(),
-                                                   args[1]->get_data_ptr<int64_t>(),
-                                                   args[2]->get_data_ptr<T>(),
-                                                   out[0]->get_data_ptr<T>(),
+                reference::scatter_add<T, int64_t>(static_cast<T*>(const_cast<void*>(args[0])),
+                                                   static_cast<int64_t*>(const_cast<void*>(args[1])),
+                                                   static_cast<T*>(const_cast<void*>(args[2])),
+                                                   static_cast<T*>(out[0]),
                                                    node.get_input_shape(0),
                                                    node.get_input_shape(1),
                                                    node.get_input_shape(2),
@@ -1186,10 +1283,10 @@ private:
             }
             else if (node.get_input_element_type(1) == element::i32)
             {
-                reference::scatter_add<T, int32_t>(args[0]->get_data_ptr<T>(),
-                                                   args[1]->get_data_ptr<int32_t>(),
-                                                   args[2]->get_data_ptr<T>(),
-                                                   out[0]->get_data_ptr<T>(),
+                reference::scatter_add<T, int32_t>(static_cast<T*>(const_cast<void*>(args[0])),
+                                                   static_cast<int32_t*>(const_cast<void*>(args[1])),
+                                                   static_cast<T*>(const_cast<void*>(args[2])),
+                                                   static_cast<T*>(out[0]),
                                                    node.get_input_shape(0),
                                                    node.get_input_shape(1),
                                                    node.get_input_shape(2),
@@ -1205,10 +1302,10 @@ private:
         {
             if (node.get_input_element_type(1) == element::i64)
             {
-                reference::scatter_nd_add<T, int64_t>(args[0]->get_data_ptr<T>(),
-                                                      args[1]->get_data_ptr<int64_t>(),
-                                                      args[2]->get_data_ptr<T>(),
-                                                      out[0]->get_data_ptr<T>(),
+                reference::scatter_nd_add<T, int64_t>(static_cast<T*>(const_cast<void*>(args[0])),
+                                                      static_cast<int64_t*>(const_cast<void*>(args[1])),
+                                                      static_cast<T*>(const_cast<void*>(args[2])),
+                                                      static_cast<T*>(out[0]),
                                                       node.get_input_shape(0),
                                                       node.get_input_shape(1),
                                                       node.get_input_shape(2),
@@ -1216,10 +1313,10 @@ private:
             }
             else if (node.get_input_element_type(1) == element::i32)
             {
-                reference::scatter_nd_add<T, int32_t>(args[0]->get_data_ptr<T>(),
-                                                      args[1]->get_data_ptr<int32_t>(),
-                                                      args[2]->get_data_ptr<T>(),
-                                                      out[0]->get_data_ptr<T>(),
+                reference::scatter_nd_add<T, int32_t>(static_cast<T*>(const_cast<void*>(args[0])),
+                                                      static_cast<int32_t*>(const_cast<void*>(args[1])),
+                                                      static_cast<T*>(const_cast<void*>(args[2])),
+                                                      static_cast<T*>(out[0]),
                                                       node.get_input_shape(0),
                                                       node.get_input_shape(1),
                                                       node.get_input_shape(2),
@@ -1231,6 +1328,21 @@ private:
             }
             break;
         }
+        case OP_TYPEID::Send:
+        {
+            size_t element_count = shape_size(node.get_output_shape(0));
+            size_t memSize = element_count * sizeof(T);
+            const auto* op = static_cast<const ngraph::op::Send*>(&node);
+            int dest_id = op->get_dest_id();
+
+            reference::send<T>(static_cast<const T*>(args[0]),
+                               node.get_input_element_type(0).get_type_enum(),
+                               element_count,
+                               dest_id);
+
+            memcpy(out[0], args[0], memSize);
+            break;
+        }
         case OP_TYPEID::Select:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -1249,8 +1361,10 @@ private:
         case OP_TYPEID::Sigmoid:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sigmoid<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            kernel::unary(static_cast<const T*>(args[0]),
+                          static_cast<T*>(out[0]),
+                          element_count,
+                          [](T x) -> T { return 1 / (1 + std::exp(-x)); });
             break;
         }
         case OP_TYPEID::SigmoidBackprop:
@@ -1286,50 +1400,54 @@ private:
         case OP_TYPEID::Slice:
         {
             const op::Slice* slice = static_cast<const op::Slice*>(&node);
-            reference::slice<T>(static_cast<const T*>(args[0]),
-                                static_cast<T*>(out[0]),
-                                node.get_input_shape(0),
-                                slice->get_lower_bounds(),
-                                slice->get_upper_bounds(),
-                                slice->get_strides(),
-                                node.get_output_shape(0));
+            kernel::slice<T>(static_cast<const T*>(args[0]),
+                             static_cast<T*>(out[0]),
+                             node.get_input_shape(0),
+                             slice->get_lower_bounds(),
+                             slice->get_upper_bounds(),
+                             slice->get_strides(),
+                             node.get_output_shape(0));
             break;
         }
         case OP_TYPEID::Softmax:
         {
             const op::Softmax* softmax = static_cast<const op::Softmax*>(&node);
-            reference::softmax<T>(static_cast<const T*>(args[0]),
-                                  static_cast<T*>(out[0]),
-                                  node.get_output_shape(0),
-                                  softmax->get_axes());
+            kernel::softmax<T>(static_cast<const T*>(args[0]),
+                               static_cast<T*>(out[0]),
+                               node.get_output_shape(0),
+                               softmax->get_axes());
             break;
         }
         case OP_TYPEID::Sqrt:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sqrt<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            kernel::unary(static_cast<const T*>(args[0]),
+                          static_cast<T*>(out[0]),
+                          element_count,
+                          [](T x) -> T { return std::sqrt(x); });
             break;
         }
         case OP_TYPEID::StopGradient: { throw unsupported_op("Unsupported op 'StopGradient'");
         }
         case OP_TYPEID::Subtract:
         {
-            size_t element_count = shape_size(node.get_output_shape(0));
-            reference::subtract<T>(static_cast<const T*>(args[0]),
-                                   static_cast<const T*>(args[1]),
-                                   static_cast<T*>(out[0]),
-                                   element_count);
+            kernel::binary(static_cast<const T*>(args[0]),
+                           static_cast<const T*>(args[1]),
+                           static_cast<T*>(out[0]),
+                           node.get_input_shape(0),
+                           node.get_input_shape(1),
+                           node.get_output_shape(0),
+                           [](T x, T y) -> T { return x - y; });
             break;
         }
         case OP_TYPEID::Sum:
         {
             const op::Sum* sum = static_cast<const op::Sum*>(&node);
-            reference::sum<T>(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              sum->get_reduction_axes());
+            kernel::sum<T>(static_cast<const T*>(args[0]),
+                           static_cast<T*>(out[0]),
+                           node.get_input_shape(0),
+                           node.get_output_shape(0),
+                           sum->get_reduction_axes());
             break;
         }
         case OP_TYPEID::Tan:
@@ -1342,8 +1460,10 @@ private:
         case OP_TYPEID::Tanh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::tanh<T>(
-                static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
+            kernel::unary(static_cast<const T*>(args[0]),
+                          static_cast<T*>(out[0]),
+                          element_count,
+                          [](T x) -> T { return std::tanh(x); });
             break;
         }
         case OP_TYPEID::TopK:
@@ -1377,6 +1497,13 @@ private:
             }
             break;
         }
+        case OP_TYPEID::DynBroadcast:
+        case OP_TYPEID::DynPad:
+        case OP_TYPEID::DynReshape:
+        case OP_TYPEID::DynSlice:
+        case OP_TYPEID::Range:
+        case OP_TYPEID::Tile:
+        case OP_TYPEID::Transpose:
         default: throw unsupported_op("Unsupported op '" + node.description() + "'");
 #if !(defined(__GNUC__) && (__GNUC__ == 4 && __GNUC_MINOR__ == 8))
 #pragma GCC diagnostic pop
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                /// \brief Concatenation as one contiguous copy per input per outer index. The
+                ///     slab an input contributes to each outer index is the product of its
+                ///     dimensions from the concatenation axis inward.
+                template <typename T>
+                void concat(const std::vector<const T*>& args,
+                            T* out,
+                            const std::vector<Shape>& in_shapes,
+                            const Shape& out_shape,
+                            size_t concatenation_axis)
+                {
+                    size_t outer = 1;
+                    for (size_t i = 0; i < concatenation_axis; i++)
+                    {
+                        outer *= out_shape[i];
+                    }
+                    std::vector<size_t> slab(args.size());
+                    std::vector<size_t> offset(args.size());
+                    size_t out_slab = 0;
+                    for (size_t i = 0; i < args.size(); i++)
+                    {
+                        slab[i] = outer == 0 ? 0 : shape_size(in_shapes[i]) / outer;
+                        offset[i] = out_slab;
+                        out_slab += slab[i];
+                    }
+
+#pragma omp parallel for schedule(static) if (outer * out_slab >= s_parallel_threshold)
+                    for (size_t o = 0; o < outer; o++)
+                    {
+                        for (size_t i = 0; i < args.size(); i++)
+                        {
+                            std::memcpy(out + o * out_slab + offset[i],
+                                        args[i] + o * slab[i],
+                                        slab[i] * sizeof(T));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,226 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Unfolds channels [c_begin, c_end) of one NCHW image into their rows of the
+                // [C*KH*KW, OH*OW] column matrix, writing zeros for taps that fall into the
+                // padding.
+                template <typename T>
+                void im2col(const T* image,
+                            T* columns,
+                            const Shape& in_shape,
+                            const Shape& filter_shape,
+                            const Shape& out_shape,
+                            const Strides& stride,
+                            const Strides& dilation,
+                            const CoordinateDiff& pad_below,
+                            size_t c_begin,
+                            size_t c_end)
+                {
+                    const std::ptrdiff_t in_h = in_shape[2];
+                    const std::ptrdiff_t in_w = in_shape[3];
+                    const size_t k_h = filter_shape[2];
+                    const size_t k_w = filter_shape[3];
+                    const size_t out_h = out_shape[2];
+                    const size_t out_w = out_shape[3];
+
+                    for (size_t c = c_begin; c < c_end; c++)
+                    {
+                        const T* plane = image + c * in_h * in_w;
+                        for (size_t kh = 0; kh < k_h; kh++)
+                        {
+                            for (size_t kw = 0; kw < k_w; kw++)
+                            {
+                                T* dst = columns + ((c * k_h + kh) * k_w + kw) * out_h * out_w;
+                                for (size_t oh = 0; oh < out_h; oh++)
+                                {
+                                    std::ptrdiff_t ih = static_cast<std::ptrdiff_t>(
+                                                            oh * stride[0] + kh * dilation[0]) -
+                                                        pad_below[0];
+                                    T* dst_row = dst + oh * out_w;
+                                    if (ih < 0 || ih >= in_h)
+                                    {
+                                        std::fill(dst_row, dst_row + out_w, T(0));
+                                        continue;
+                                    }
+                                    const T* src_row = plane + ih * in_w;
+                                    for (size_t ow = 0; ow < out_w; ow++)
+                                    {
+                                        std::ptrdiff_t iw = static_cast<std::ptrdiff_t>(
+                                                                ow * stride[1] + kw * dilation[1]) -
+                                                            pad_below[1];
+                                        dst_row[ow] = (iw < 0 || iw >= in_w) ? T(0) : src_row[iw];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+
+                /// \brief 2D convolution as im2col followed by an Eigen GEMM per image. Images are
+                ///     distributed across threads when there are enough of them; otherwise each
+                ///     image is unfolded across its input channels and its GEMM is split across
+                ///     blocks of output channels. Data-dilated and non-2D convolutions use the
+                ///     reference kernel.
+                template <typename T>
+                void convolution(const T* in,
+                                 const T* filter,
+                                 T* out,
+                                 const Shape& in_shape,
+                                 const Shape& filter_shape,
+                                 const Shape& out_shape,
+                                 const Strides& stride,
+                                 const Strides& filter_dilation,
+                                 const CoordinateDiff& in_pad_below,
+                                 const CoordinateDiff& in_pad_above,
+                                 const Strides& in_dilation)
+                {
+                    bool data_dilated = false;
+                    for (size_t d : in_dilation)
+                    {
+                        data_dilated |= (d != 1);
+                    }
+                    if (in_shape.size() != 4 || data_dilated)
+                    {
+                        reference::convolution<T>(in,
+                                                  filter,
+                                                  out,
+                                                  in_shape,
+                                                  filter_shape,
+                                                  out_shape,
+                                                  stride,
+                                                  filter_dilation,
+                                                  in_pad_below,
+                                                  in_pad_above,
+                                                  in_dilation);
+                        return;
+                    }
+
+                    // A zero-sized batch, channel or filter dimension is valid; there is
+                    // either nothing to write or every output sums over an empty window.
+                    const size_t out_size = shape_size(out_shape);
+                    if (out_size == 0)
+                    {
+                        return;
+                    }
+                    if (shape_size(in_shape) == 0 || shape_size(filter_shape) == 0)
+                    {
+                        std::fill(out, out + out_size, T(0));
+                        return;
+                    }
+
+                    using Matrix =
+                        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+                    const size_t batch = in_shape[0];
+                    const size_t channels = in_shape[1];
+                    const size_t out_channels = filter_shape[0];
+                    const size_t patch = filter_shape[1] * filter_shape[2] * filter_shape[3];
+                    const size_t pixels = out_shape[2] * out_shape[3];
+                    const size_t image_size = shape_size(in_shape) / batch;
+
+#ifdef _OPENMP
+                    const size_t threads = omp_get_max_threads();
+#else
+                    const size_t threads = 1;
+#endif
+                    if (batch >= threads)
+                    {
+                        Eigen::Map<const Matrix> weights(filter, out_channels, patch);
+#pragma omp parallel if (batch > 1)
+                        {
+                            std::vector<T> columns(patch * pixels);
+#pragma omp for schedule(static)
+                            for (size_t n = 0; n < batch; n++)
+                            {
+                                im2col(in + n * image_size,
+                                       columns.data(),
+                                       in_shape,
+                                       filter_shape,
+                                       out_shape,
+                                       stride,
+                                       filter_dilation,
+                                       in_pad_below,
+                                       0,
+                                       channels);
+                                Eigen::Map<const Matrix> cols(columns.data(), patch, pixels);
+                                Eigen::Map<Matrix> result(
+                                    out + n * out_channels * pixels, out_channels, pixels);
+                                result.noalias() = weights * cols;
+                            }
+                        }
+                        return;
+                    }
+
+                    const size_t splits = std::min(out_channels, threads);
+                    const size_t block_rows = (out_channels + splits - 1) / splits;
+                    const size_t blocks = (out_channels + block_rows - 1) / block_rows;
+                    std::vector<T> columns(patch * pixels);
+                    Eigen::Map<const Matrix> cols(columns.data(), patch, pixels);
+                    for (size_t n = 0; n < batch; n++)
+                    {
+                        const T* image = in + n * image_size;
+#pragma omp parallel for schedule(static)
+                        for (size_t c = 0; c < channels; c++)
+                        {
+                            im2col(image,
+                                   columns.data(),
+                                   in_shape,
+                                   filter_shape,
+                                   out_shape,
+                                   stride,
+                                   filter_dilation,
+                                   in_pad_below,
+                                   c,
+                                   c + 1);
+                        }
+#pragma omp parallel for schedule(static)
+                        for (size_t b = 0; b < blocks; b++)
+                        {
+                            const size_t row = b * block_rows;
+                            const size_t rows = std::min(block_rows, out_channels - row);
+                            Eigen::Map<const Matrix> weights(filter + row * patch, rows, patch);
+                            Eigen::Map<Matrix> result(
+                                out + (n * out_channels + row) * pixels, rows, pixels);
+                            result.noalias() = weights * cols;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
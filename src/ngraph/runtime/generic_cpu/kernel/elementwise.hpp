@@ -0,0 +1,190 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Below this many elements the cost of waking the OpenMP team outweighs the work
+                static const size_t s_parallel_threshold = 32768;
+
+                template <typename T, typename U, typename F>
+                void unary(const T* arg, U* out, size_t count, F f)
+                {
+#pragma omp parallel for simd schedule(static) if (count >= s_parallel_threshold)
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = f(arg[i]);
+                    }
+                }
+
+                // Returns the row-major strides of arg_shape padded to the rank of out_shape,
+                // with a zero stride on every axis that is broadcast.
+                inline std::vector<size_t> broadcast_strides(const Shape& arg_shape,
+                                                             const Shape& out_shape,
+                                                             size_t axis_offset)
+                {
+                    size_t rank = out_shape.size();
+                    std::vector<size_t> strides(rank, 0);
+                    size_t stride = 1;
+                    for (size_t i = arg_shape.size(); i-- > 0;)
+                    {
+                        size_t axis = i + axis_offset;
+                        strides[axis] = (arg_shape[i] == 1 && out_shape[axis] != 1) ? 0 : stride;
+                        stride *= arg_shape[i];
+                    }
+                    return strides;
+                }
+
+                /// \brief Elementwise binary kernel. Equal shapes take a flat vectorized loop;
+                ///     otherwise NUMPY implicit broadcasting is applied by iterating over the
+                ///     rows of the output and vectorizing along the innermost axis.
+                template <typename T, typename U, typename F>
+                void binary(const T* arg0,
+                            const T* arg1,
+                            U* out,
+                            const Shape& arg0_shape,
+                            const Shape& arg1_shape,
+                            const Shape& out_shape,
+                            F f)
+                {
+                    size_t count = shape_size(out_shape);
+                    if (arg0_shape == out_shape && arg1_shape == out_shape)
+                    {
+#pragma omp parallel for simd schedule(static) if (count >= s_parallel_threshold)
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            out[i] = f(arg0[i], arg1[i]);
+                        }
+                        return;
+                    }
+
+                    size_t rank = out_shape.size();
+                    std::vector<size_t> strides0 =
+                        broadcast_strides(arg0_shape, out_shape, rank - arg0_shape.size());
+                    std::vector<size_t> strides1 =
+                        broadcast_strides(arg1_shape, out_shape, rank - arg1_shape.size());
+
+                    size_t inner = out_shape[rank - 1];
+                    size_t outer = inner == 0 ? 0 : count / inner;
+                    size_t inner0 = strides0[rank - 1];
+                    size_t inner1 = strides1[rank - 1];
+#pragma omp parallel for schedule(static) if (count >= s_parallel_threshold)
+                    for (size_t row = 0; row < outer; row++)
+                    {
+                        size_t offset0 = 0;
+                        size_t offset1 = 0;
+                        size_t remainder = row;
+                        for (size_t axis = rank - 1; axis-- > 0;)
+                        {
+                            size_t index = remainder % out_shape[axis];
+                            remainder /= out_shape[axis];
+                            offset0 += index * strides0[axis];
+                            offset1 += index * strides1[axis];
+                        }
+                        const T* in0 = arg0 + offset0;
+                        const T* in1 = arg1 + offset1;
+                        U* dst = out + row * inner;
+#pragma omp simd
+                        for (size_t i = 0; i < inner; i++)
+                        {
+                            dst[i] = f(in0[i * inner0], in1[i * inner1]);
+                        }
+                    }
+                }
+
+                template <typename T>
+                typename std::enable_if<std::is_floating_point<T>::value>::type
+                    divide(const T* arg0,
+                           const T* arg1,
+                           T* out,
+                           const Shape& arg0_shape,
+                           const Shape& arg1_shape,
+                           const Shape& out_shape,
+                           bool /* pythondiv */)
+                {
+                    binary(arg0,
+                           arg1,
+                           out,
+                           arg0_shape,
+                           arg1_shape,
+                           out_shape,
+                           [](T x, T y) { return x / y; });
+                }
+
+                /// \brief Integer division; divisors are checked up front because the
+                ///     error cannot be raised from inside the parallel loop.
+                template <typename T>
+                typename std::enable_if<std::is_integral<T>::value>::type
+                    divide(const T* arg0,
+                           const T* arg1,
+                           T* out,
+                           const Shape& arg0_shape,
+                           const Shape& arg1_shape,
+                           const Shape& out_shape,
+                           bool pythondiv)
+                {
+                    size_t divisor_count = shape_size(arg1_shape);
+                    for (size_t i = 0; i < divisor_count; i++)
+                    {
+                        if (arg1[i] == 0)
+                        {
+                            throw std::domain_error("integer division by zero");
+                        }
+                    }
+                    if (pythondiv)
+                    {
+                        binary(arg0,
+                               arg1,
+                               out,
+                               arg0_shape,
+                               arg1_shape,
+                               out_shape,
+                               [](T x, T y) {
+                                   T quot = x / y;
+                                   T rem = x % y;
+                                   return ((rem != 0) && ((x < 0) != (y < 0))) ? T(quot - 1)
+                                                                               : quot;
+                               });
+                    }
+                    else
+                    {
+                        binary(arg0,
+                               arg1,
+                               out,
+                               arg0_shape,
+                               arg1_shape,
+                               out_shape,
+                               [](T x, T y) { return T(x / y); });
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,200 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Visits every output pixel of a 2D NCHW pooling, one (n, c) plane per thread
+                // chunk. f(plane, h_begin, h_end, w_begin, w_end, window_size) receives the
+                // window clipped to the input; window_size counts the padded taps as well.
+                template <typename T, typename F>
+                void pool_2d(const T* arg,
+                             T* out,
+                             const Shape& arg_shape,
+                             const Shape& out_shape,
+                             const Shape& window_shape,
+                             const Strides& window_movement_strides,
+                             const Shape& padding_below,
+                             F f)
+                {
+                    const std::ptrdiff_t in_h = arg_shape[2];
+                    const std::ptrdiff_t in_w = arg_shape[3];
+                    const size_t out_h = out_shape[2];
+                    const size_t out_w = out_shape[3];
+                    const size_t planes = arg_shape[0] * arg_shape[1];
+                    const size_t window_size = window_shape[0] * window_shape[1];
+
+#pragma omp parallel for schedule(static) if (shape_size(out_shape) * window_size >=               \
+                                               s_parallel_threshold)
+                    for (size_t p = 0; p < planes; p++)
+                    {
+                        const T* plane = arg + p * in_h * in_w;
+                        T* dst = out + p * out_h * out_w;
+                        for (size_t oh = 0; oh < out_h; oh++)
+                        {
+                            std::ptrdiff_t h0 = static_cast<std::ptrdiff_t>(
+                                                    oh * window_movement_strides[0]) -
+                                                padding_below[0];
+                            std::ptrdiff_t h1 = h0 + window_shape[0];
+                            h0 = std::max<std::ptrdiff_t>(h0, 0);
+                            h1 = std::min(h1, in_h);
+                            for (size_t ow = 0; ow < out_w; ow++)
+                            {
+                                std::ptrdiff_t w0 = static_cast<std::ptrdiff_t>(
+                                                        ow * window_movement_strides[1]) -
+                                                    padding_below[1];
+                                std::ptrdiff_t w1 = w0 + window_shape[1];
+                                w0 = std::max<std::ptrdiff_t>(w0, 0);
+                                w1 = std::min(w1, in_w);
+                                dst[oh * out_w + ow] = f(plane, h0, h1, w0, w1, window_size);
+                            }
+                        }
+                    }
+                }
+
+                template <typename T>
+                void max_pool(const T* arg,
+                              T* out,
+                              const Shape& arg_shape,
+                              const Shape& out_shape,
+                              const Shape& window_shape,
+                              const Strides& window_movement_strides,
+                              const Shape& padding_below,
+                              const Shape& padding_above)
+                {
+                    if (arg_shape.size() != 4)
+                    {
+                        reference::max_pool<T>(arg,
+                                               out,
+                                               arg_shape,
+                                               out_shape,
+                                               window_shape,
+                                               window_movement_strides,
+                                               padding_below,
+                                               padding_above);
+                        return;
+                    }
+                    const std::ptrdiff_t in_w = arg_shape[3];
+                    pool_2d(arg,
+                            out,
+                            arg_shape,
+                            out_shape,
+                            window_shape,
+                            window_movement_strides,
+                            padding_below,
+                            [in_w](const T* plane,
+                                   std::ptrdiff_t h0,
+                                   std::ptrdiff_t h1,
+                                   std::ptrdiff_t w0,
+                                   std::ptrdiff_t w1,
+                                   size_t) {
+                                // Padding never wins, matching the reference kernel
+                                T result = std::numeric_limits<T>::lowest();
+                                for (std::ptrdiff_t h = h0; h < h1; h++)
+                                {
+                                    const T* row = plane + h * in_w;
+                                    for (std::ptrdiff_t w = w0; w < w1; w++)
+                                    {
+                                        result = row[w] > result ? row[w] : result;
+                                    }
+                                }
+                                return result;
+                            });
+                }
+
+                template <typename T>
+                void avg_pool(const T* arg,
+                              T* out,
+                              const Shape& arg_shape,
+                              const Shape& out_shape,
+                              const Shape& window_shape,
+                              const Strides& window_movement_strides,
+                              const Shape& padding_below,
+                              const Shape& padding_above,
+                              bool include_padding_in_avg_computation)
+                {
+                    // A window lying entirely in the padding is an error that only the
+                    // reference kernel reports; it cannot be raised from a parallel region.
+                    bool empty_windows_possible = false;
+                    for (size_t i = 0; i < window_shape.size(); i++)
+                    {
+                        empty_windows_possible |= padding_below[i] >= window_shape[i] ||
+                                                  padding_above[i] >= window_shape[i];
+                    }
+                    if (arg_shape.size() != 4 ||
+                        (empty_windows_possible && !include_padding_in_avg_computation))
+                    {
+                        reference::avg_pool<T>(arg,
+                                               out,
+                                               arg_shape,
+                                               out_shape,
+                                               window_shape,
+                                               window_movement_strides,
+                                               padding_below,
+                                               padding_above,
+                                               include_padding_in_avg_computation);
+                        return;
+                    }
+                    const std::ptrdiff_t in_w = arg_shape[3];
+                    pool_2d(arg,
+                            out,
+                            arg_shape,
+                            out_shape,
+                            window_shape,
+                            window_movement_strides,
+                            padding_below,
+                            [in_w, include_padding_in_avg_computation](const T* plane,
+                                                                       std::ptrdiff_t h0,
+                                                                       std::ptrdiff_t h1,
+                                                                       std::ptrdiff_t w0,
+                                                                       std::ptrdiff_t w1,
+                                                                       size_t window_size) {
+                                T result = 0;
+                                for (std::ptrdiff_t h = h0; h < h1; h++)
+                                {
+                                    const T* row = plane + h * in_w;
+                                    for (std::ptrdiff_t w = w0; w < w1; w++)
+                                    {
+                                        result += row[w];
+                                    }
+                                }
+                                size_t n = include_padding_in_avg_computation
+                                               ? window_size
+                                               : static_cast<size_t>((h1 - h0) * (w1 - w0));
+                                return static_cast<T>(result / n);
+                            });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,237 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/min.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                /// \brief A tensor viewed as [outer, reduced, inner] around a contiguous block
+                ///     of reduction axes.
+                struct ReductionExtents
+                {
+                    size_t outer;
+                    size_t reduced;
+                    size_t inner;
+                };
+
+                /// \returns false if the reduction axes are not one contiguous block, in which
+                ///     case callers fall back to the reference kernel.
+                inline bool get_reduction_extents(const Shape& in_shape,
+                                                  const AxisSet& reduction_axes,
+                                                  ReductionExtents& extents)
+                {
+                    extents = ReductionExtents{1, 1, 1};
+                    if (reduction_axes.empty())
+                    {
+                        extents.inner = shape_size(in_shape);
+                        return true;
+                    }
+                    size_t first = *reduction_axes.begin();
+                    size_t last = *reduction_axes.rbegin();
+                    if (last - first + 1 != reduction_axes.size())
+                    {
+                        return false;
+                    }
+                    for (size_t i = 0; i < in_shape.size(); i++)
+                    {
+                        if (i < first)
+                        {
+                            extents.outer *= in_shape[i];
+                        }
+                        else if (i <= last)
+                        {
+                            extents.reduced *= in_shape[i];
+                        }
+                        else
+                        {
+                            extents.inner *= in_shape[i];
+                        }
+                    }
+                    return true;
+                }
+
+                // Accumulate f32 sums in f64 to stay close to the compensated reference sum
+                template <typename T>
+                using sum_accumulator_t =
+                    typename std::conditional<std::is_same<T, float>::value, double, T>::type;
+
+                template <typename T>
+                void sum(const T* arg,
+                         T* out,
+                         const Shape& in_shape,
+                         const Shape& out_shape,
+                         const AxisSet& reduction_axes)
+                {
+                    ReductionExtents e;
+                    if (!get_reduction_extents(in_shape, reduction_axes, e))
+                    {
+                        reference::sum<T>(arg, out, in_shape, out_shape, reduction_axes);
+                        return;
+                    }
+                    size_t work = e.outer * e.reduced * e.inner;
+                    if (e.inner == 1)
+                    {
+#pragma omp parallel for schedule(static) if (work >= s_parallel_threshold)
+                        for (size_t o = 0; o < e.outer; o++)
+                        {
+                            const T* row = arg + o * e.reduced;
+                            sum_accumulator_t<T> acc = 0;
+#pragma omp simd reduction(+ : acc)
+                            for (size_t r = 0; r < e.reduced; r++)
+                            {
+                                acc += row[r];
+                            }
+                            out[o] = static_cast<T>(acc);
+                        }
+                        return;
+                    }
+#pragma omp parallel for schedule(static) if (work >= s_parallel_threshold)
+                    for (size_t o = 0; o < e.outer; o++)
+                    {
+                        T* dst = out + o * e.inner;
+                        std::fill(dst, dst + e.inner, T(0));
+                        for (size_t r = 0; r < e.reduced; r++)
+                        {
+                            const T* src = arg + (o * e.reduced + r) * e.inner;
+#pragma omp simd
+                            for (size_t i = 0; i < e.inner; i++)
+                            {
+                                dst[i] += src[i];
+                            }
+                        }
+                    }
+                }
+
+                template <typename T>
+                void max(const T* arg,
+                         T* out,
+                         const Shape& in_shape,
+                         const Shape& out_shape,
+                         const AxisSet& reduction_axes)
+                {
+                    ReductionExtents e;
+                    if (!get_reduction_extents(in_shape, reduction_axes, e))
+                    {
+                        reference::max<T>(arg, out, in_shape, out_shape, reduction_axes);
+                        return;
+                    }
+                    const T init = std::numeric_limits<T>::has_infinity
+                                       ? -std::numeric_limits<T>::infinity()
+                                       : std::numeric_limits<T>::lowest();
+                    size_t work = e.outer * e.reduced * e.inner;
+                    if (e.inner == 1)
+                    {
+#pragma omp parallel for schedule(static) if (work >= s_parallel_threshold)
+                        for (size_t o = 0; o < e.outer; o++)
+                        {
+                            const T* row = arg + o * e.reduced;
+                            T acc = init;
+#pragma omp simd reduction(max : acc)
+                            for (size_t r = 0; r < e.reduced; r++)
+                            {
+                                acc = row[r] > acc ? row[r] : acc;
+                            }
+                            out[o] = acc;
+                        }
+                        return;
+                    }
+#pragma omp parallel for schedule(static) if (work >= s_parallel_threshold)
+                    for (size_t o = 0; o < e.outer; o++)
+                    {
+                        T* dst = out + o * e.inner;
+                        std::fill(dst, dst + e.inner, init);
+                        for (size_t r = 0; r < e.reduced; r++)
+                        {
+                            const T* src = arg + (o * e.reduced + r) * e.inner;
+#pragma omp simd
+                            for (size_t i = 0; i < e.inner; i++)
+                            {
+                                dst[i] = src[i] > dst[i] ? src[i] : dst[i];
+                            }
+                        }
+                    }
+                }
+
+                template <typename T>
+                void min(const T* arg,
+                         T* out,
+                         const Shape& in_shape,
+                         const Shape& out_shape,
+                         const AxisSet& reduction_axes)
+                {
+                    ReductionExtents e;
+                    if (!get_reduction_extents(in_shape, reduction_axes, e))
+                    {
+                        reference::min<T>(arg, out, in_shape, out_shape, reduction_axes);
+                        return;
+                    }
+                    const T init = std::numeric_limits<T>::has_infinity
+                                       ? std::numeric_limits<T>::infinity()
+                                       : std::numeric_limits<T>::max();
+                    size_t work = e.outer * e.reduced * e.inner;
+                    if (e.inner == 1)
+                    {
+#pragma omp parallel for schedule(static) if (work >= s_parallel_threshold)
+                        for (size_t o = 0; o < e.outer; o++)
+                        {
+                            const T* row = arg + o * e.reduced;
+                            T acc = init;
+#pragma omp simd reduction(min : acc)
+                            for (size_t r = 0; r < e.reduced; r++)
+                            {
+                                acc = row[r] < acc ? row[r] : acc;
+                            }
+                            out[o] = acc;
+                        }
+                        return;
+                    }
+#pragma omp parallel for schedule(static) if (work >= s_parallel_threshold)
+                    for (size_t o = 0; o < e.outer; o++)
+                    {
+                        T* dst = out + o * e.inner;
+                        std::fill(dst, dst + e.inner, init);
+                        for (size_t r = 0; r < e.reduced; r++)
+                        {
+                            const T* src = arg + (o * e.reduced + r) * e.inner;
+#pragma omp simd
+                            for (size_t i = 0; i < e.inner; i++)
+                            {
+                                dst[i] = src[i] < dst[i] ? src[i] : dst[i];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
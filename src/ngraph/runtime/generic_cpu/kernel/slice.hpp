@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+#include "ngraph/coordinate.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                /// \brief Slice with unit strides as one contiguous copy per output row. Strided
+                ///     slices use the reference kernel.
+                template <typename T>
+                void slice(const T* arg,
+                           T* out,
+                           const Shape& arg_shape,
+                           const Coordinate& lower_bounds,
+                           const Coordinate& upper_bounds,
+                           const Strides& strides,
+                           const Shape& out_shape)
+                {
+                    bool unit_strides = true;
+                    for (size_t s : strides)
+                    {
+                        unit_strides &= (s == 1);
+                    }
+                    size_t rank = arg_shape.size();
+                    if (!unit_strides || rank == 0)
+                    {
+                        reference::slice<T>(
+                            arg, out, arg_shape, lower_bounds, upper_bounds, strides, out_shape);
+                        return;
+                    }
+
+                    std::vector<size_t> arg_strides(rank, 1);
+                    for (size_t i = rank - 1; i-- > 0;)
+                    {
+                        arg_strides[i] = arg_strides[i + 1] * arg_shape[i + 1];
+                    }
+                    size_t inner = out_shape[rank - 1];
+                    size_t count = shape_size(out_shape);
+                    size_t rows = inner == 0 ? 0 : count / inner;
+
+#pragma omp parallel for schedule(static) if (count >= s_parallel_threshold)
+                    for (size_t row = 0; row < rows; row++)
+                    {
+                        size_t src = lower_bounds[rank - 1];
+                        size_t remainder = row;
+                        for (size_t axis = rank - 1; axis-- > 0;)
+                        {
+                            src += (remainder % out_shape[axis] + lower_bounds[axis]) *
+                                   arg_strides[axis];
+                            remainder /= out_shape[axis];
+                        }
+                        std::memcpy(out + row * inner, arg + src, inner * sizeof(T));
+                    }
+                }
+            }
+        }
+    }
+}
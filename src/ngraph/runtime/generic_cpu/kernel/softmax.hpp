@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#include "ngraph/runtime/generic_cpu/kernel/reduce.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                /// \brief Softmax over a contiguous block of trailing axes, one row per thread
+                ///     chunk. Other axis sets use the reference kernel.
+                template <typename T>
+                void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+                {
+                    ReductionExtents e;
+                    if (!get_reduction_extents(shape, axes, e) || e.inner != 1 || axes.empty())
+                    {
+                        reference::softmax<T>(arg, out, shape, axes);
+                        return;
+                    }
+                    size_t work = e.outer * e.reduced;
+#pragma omp parallel for schedule(static) if (work >= s_parallel_threshold)
+                    for (size_t o = 0; o < e.outer; o++)
+                    {
+                        const T* src = arg + o * e.reduced;
+                        T* dst = out + o * e.reduced;
+
+                        T max_value = std::numeric_limits<T>::has_infinity
+                                          ? -std::numeric_limits<T>::infinity()
+                                          : std::numeric_limits<T>::lowest();
+#pragma omp simd reduction(max : max_value)
+                        for (size_t r = 0; r < e.reduced; r++)
+                        {
+                            max_value = src[r] > max_value ? src[r] : max_value;
+                        }
+
+                        T sum = 0;
+#pragma omp simd reduction(+ : sum)
+                        for (size_t r = 0; r < e.reduced; r++)
+                        {
+                            dst[r] = std::exp(src[r] - max_value);
+                            sum += dst[r];
+                        }
+
+                        T scale = T(1) / sum;
+#pragma omp simd
+                        for (size_t r = 0; r < e.reduced; r++)
+                        {
+                            dst[r] *= scale;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -228,6 +228,7 @@ bool runtime::gpu::GPU_Backend::is_supported(const Node& op) const
                                    "DynPad"
                                    "SelectAndScatter",
                                    "StopGradient",
+                                   "EmbeddingBag",
                                    "EmbeddingLookup",
                                    "GenerateMask",
                                    "DynBroadcast",
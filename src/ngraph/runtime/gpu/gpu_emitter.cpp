@@ -55,6 +55,7 @@
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_bag.hpp"
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/erf.hpp"
@@ -622,6 +623,11 @@ std::string runtime::gpu::GPU_Emitter::emit_DynSlice(EMIT_ARGS)
     throw unsupported_op("Unsupported op '" + node->description() + "'");
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_EmbeddingBag(EMIT_ARGS)
+{
+    throw ngraph_error("EmbeddingBag is not yet implemented for NVIDIA GPU");
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_EmbeddingLookup(EMIT_ARGS)
 {
     throw ngraph_error("EmbeddingLookup is not yet implemented for NVIDIA GPU");
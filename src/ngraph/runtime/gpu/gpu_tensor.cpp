@@ -71,6 +71,7 @@ runtime::gpu::GPUTensor::~GPUTensor()
 void runtime::gpu::GPUTensor::write(const void* source, size_t n_bytes)
 {
     runtime::gpu::cuda_memcpyHtD(m_allocated_buffer_pool, source, n_bytes);
+    update_version();
 }
 
 void runtime::gpu::GPUTensor::read(void* target, size_t n_bytes) const
@@ -94,6 +95,7 @@ void runtime::gpu::GPUTensor::copy_from(const runtime::Tensor& source)
         }
         runtime::gpu::cuda_memcpyDtD(
             m_allocated_buffer_pool, src.m_allocated_buffer_pool, source.get_size_in_bytes());
+        update_version();
     }
     catch (const std::bad_cast& e)
     {
@@ -102,6 +102,7 @@ void runtime::HostTensor::write(const void* source, size_t n)
     }
     char* target = get_data_ptr();
     memcpy(target, source, n);
+    update_version();
 }
 
 void runtime::HostTensor::read(void* target, size_t n) const
@@ -57,6 +57,7 @@ void runtime::intelgpu::IntelGPUTensorView::write(const void* source, size_t n)
     auto ptr = ocl_memory->pointer<char>();
     char* target = ptr.data();
     memcpy(target, source, n);
+    update_version();
 }
 
 void runtime::intelgpu::IntelGPUTensorView::read(void* target, size_t n) const
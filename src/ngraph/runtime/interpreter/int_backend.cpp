@@ -75,6 +75,11 @@ bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
     return m_unsupported_op_name_list.find(node.description()) == m_unsupported_op_name_list.end();
 }
 
+bool runtime::interpreter::INTBackend::is_supported_property(const Property prop) const
+{
+    return prop == Property::memory_attach;
+}
+
 std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istream& in)
 {
     shared_ptr<Executable> exec;
@@ -57,6 +57,7 @@ public:
     std::shared_ptr<Executable> load(std::istream& input_stream) override;
 
     bool is_supported(const Node& node) const override;
+    bool is_supported_property(const Property prop) const override;
 
     bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
 
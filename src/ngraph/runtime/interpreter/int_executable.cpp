@@ -77,6 +77,8 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
 bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
+    lock_guard<mutex> lock(m_call_mutex);
+
     // convert inputs to HostTensor
     vector<shared_ptr<HostTensor>> func_inputs;
     for (auto tensor : inputs)
@@ -234,6 +236,15 @@ void runtime::interpreter::INTExecutable::generate_calls(const element::Type& ty
     }
 }
 
+future<bool>
+    runtime::interpreter::INTExecutable::call_async(const vector<shared_ptr<Tensor>>& outputs,
+                                                    const vector<shared_ptr<Tensor>>& inputs)
+{
+    // call() runs one execution at a time, so one worker is enough
+    call_once(m_call_pool_init, [this]() { m_call_pool.reset(new ThreadPool(1)); });
+    return m_call_pool->submit([this, outputs, inputs]() { return call(outputs, inputs); });
+}
+
 void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
 {
     m_nan_check_enabled = enable;
@@ -19,6 +19,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -38,6 +39,7 @@
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_bag.hpp"
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/experimental/batch_mat_mul.hpp"
 #include "ngraph/op/experimental/dyn_broadcast.hpp"
@@ -100,6 +102,7 @@
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/embedding_bag.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/equal.hpp"
 #include "ngraph/runtime/reference/erf.hpp"
@@ -154,6 +157,7 @@
 #include "ngraph/runtime/reference/tanh.hpp"
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/state/rng_state.hpp"
 
 namespace ngraph
@@ -179,6 +183,11 @@ public:
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& intputs) override;
 
+    /// \brief Queues call() on a single worker thread owned by this Executable, so
+    ///     asynchronous executions complete in submission order.
+    std::future<bool> call_async(const std::vector<std::shared_ptr<Tensor>>& outputs,
+                                 const std::vector<std::shared_ptr<Tensor>>& inputs) override;
+
     virtual void save(std::ostream& output_stream) override;
 
     void set_nan_check(bool enable);
@@ -196,7 +205,11 @@ private:
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<NodeWrapper> m_wrapped_nodes;
     std::unordered_map<const Node*, std::shared_ptr<RNGState>> m_states;
+    // Calls share m_timer_map and m_states, so they run one at a time
+    std::mutex m_call_mutex;
     std::set<std::string> m_unsupported_op_name_list;
+    std::once_flag m_call_pool_init;
+    std::unique_ptr<ThreadPool> m_call_pool;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
@@ -389,8 +402,8 @@ private:
             }
             else
             {
-                uint64_t seed = static_cast<uint64_t>(args[3]->get_data_ptr<const T>()[0]);
-                double prob = static_cast<double>(args[4]->get_data_ptr<const T>()[0]);
+                uint64_t seed = args[3]->get_data_ptr<const uint64_t>()[0];
+                double prob = args[4]->get_data_ptr<const double>()[0];
                 reference::generate_mask_no_state<T>(
                     out[0]->get_data_ptr<T>(), element_count, training, seed, prob);
             }
@@ -754,6 +767,47 @@ private:
             throw unsupported_op("Unsupported op '" + node.description() + "'");
             break;
         }
+        case OP_TYPEID::EmbeddingBag:
+        {
+            const op::EmbeddingBag* bag = static_cast<const op::EmbeddingBag*>(&node);
+            auto type = node.get_input_element_type(0);
+            size_t indices_count = shape_size(node.get_input_shape(0));
+            size_t bag_count = shape_size(node.get_input_shape(2));
+            size_t vec_len = node.get_output_shape(0).at(1);
+            const T* per_sample_weights =
+                bag->has_per_sample_weights() ? args[3]->get_data_ptr<const T>() : nullptr;
+
+            if (type == element::i32)
+            {
+                reference::embedding_bag<T, int32_t>(args[0]->get_data_ptr<const int32_t>(),
+                                                     args[1]->get_data_ptr<const T>(),
+                                                     args[2]->get_data_ptr<const int32_t>(),
+                                                     per_sample_weights,
+                                                     out[0]->get_data_ptr<T>(),
+                                                     indices_count,
+                                                     bag_count,
+                                                     vec_len,
+                                                     bag->get_mode());
+            }
+            else if (type == element::i64)
+            {
+                reference::embedding_bag<T, int64_t>(args[0]->get_data_ptr<const int64_t>(),
+                                                     args[1]->get_data_ptr<const T>(),
+                                                     args[2]->get_data_ptr<const int64_t>(),
+                                                     per_sample_weights,
+                                                     out[0]->get_data_ptr<T>(),
+                                                     indices_count,
+                                                     bag_count,
+                                                     vec_len,
+                                                     bag->get_mode());
+            }
+            else
+            {
+                throw ngraph_error(std::string("Unsupported index type ") + type.c_type_string() +
+                                   std::string(" in EmbeddingBag"));
+            }
+            break;
+        }
         case OP_TYPEID::EmbeddingLookup:
         {
             const op::EmbeddingLookup* embed = static_cast<const op::EmbeddingLookup*>(&node);
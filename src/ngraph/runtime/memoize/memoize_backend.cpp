@@ -0,0 +1,406 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/broadcast_distributed.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/send.hpp"
+#include "ngraph/runtime/memoize/memoize_backend.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Calls in a row in which some inputs of the split weren't invariant before splitting again
+static const size_t s_split_misses = 2;
+// Splits after which the executable keeps its split, so that compiling can't dominate
+static const size_t s_max_splits = 4;
+
+runtime::memoize::MemoizeBackend::MemoizeBackend(shared_ptr<runtime::Backend> wrapped_backend,
+                                                 bool hash_inputs)
+    : m_wrapped_backend(std::move(wrapped_backend))
+    , m_hash_inputs(hash_inputs)
+{
+}
+
+shared_ptr<runtime::Tensor>
+    runtime::memoize::MemoizeBackend::create_tensor(const element::Type& type, const Shape& shape)
+{
+    return m_wrapped_backend->create_tensor(type, shape);
+}
+
+shared_ptr<runtime::Tensor> runtime::memoize::MemoizeBackend::create_tensor(
+    const element::Type& type, const Shape& shape, void* memory_pointer)
+{
+    return m_wrapped_backend->create_tensor(type, shape, memory_pointer);
+}
+
+shared_ptr<runtime::Tensor>
+    runtime::memoize::MemoizeBackend::create_dynamic_tensor(const element::Type& type,
+                                                            const PartialShape& shape)
+{
+    return m_wrapped_backend->create_dynamic_tensor(type, shape);
+}
+
+bool runtime::memoize::MemoizeBackend::supports_dynamic_tensors()
+{
+    return m_wrapped_backend->supports_dynamic_tensors();
+}
+
+shared_ptr<runtime::Executable>
+    runtime::memoize::MemoizeBackend::compile(shared_ptr<Function> function,
+                                              bool enable_performance_collection)
+{
+    return make_shared<MemoizeExecutable>(
+        function, m_wrapped_backend, enable_performance_collection, m_hash_inputs);
+}
+
+bool runtime::memoize::MemoizeBackend::is_supported(const Node& node) const
+{
+    return m_wrapped_backend->is_supported(node);
+}
+
+bool runtime::memoize::MemoizeBackend::is_supported_property(const Property prop) const
+{
+    return m_wrapped_backend->is_supported_property(prop);
+}
+
+bool runtime::memoize::MemoizeBackend::set_config(const map<string, string>& config,
+                                                  string& error)
+{
+    return m_wrapped_backend->set_config(config, error);
+}
+
+runtime::memoize::MemoizeExecutable::MemoizeExecutable(shared_ptr<Function> function,
+                                                       shared_ptr<runtime::Backend> wrapped_backend,
+                                                       bool enable_performance_collection,
+                                                       bool hash_inputs)
+    : m_wrapped_backend(wrapped_backend)
+    , m_enable_performance_collection(enable_performance_collection)
+    , m_hash_inputs(hash_inputs)
+{
+    // Backends may rewrite the function they compile, so splits are made from a copy
+    m_function = clone_function(*function);
+    m_memoizable = !function->is_dynamic();
+    for (auto& node : m_function->get_ops())
+    {
+        if (!node->get_control_dependencies().empty())
+        {
+            m_memoizable = false;
+        }
+    }
+    m_executable = m_wrapped_backend->compile(function, m_enable_performance_collection);
+    set_parameters_and_results(*function);
+}
+
+bool runtime::memoize::MemoizeExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_stats.calls++;
+    bool rc = true;
+    if (!m_memoizable)
+    {
+        rc = m_executable->call(outputs, inputs);
+    }
+    else
+    {
+        // An input is invariant if it holds the same data as in the previous call
+        const ParameterVector& parameters = m_function->get_parameters();
+        NGRAPH_CHECK(inputs.size() == parameters.size());
+        bool first_call = m_versions.empty();
+        m_versions.resize(inputs.size());
+        m_hashes.resize(inputs.size());
+        vector<bool> invariant_inputs(inputs.size());
+        bool any_invariant = false;
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            size_t version = inputs[i]->get_version();
+            size_t hash = m_hash_inputs ? hash_contents(*inputs[i]) : 0;
+            invariant_inputs[i] = parameters[i]->get_cacheable() ||
+                                  (!first_call && version == m_versions[i] && hash == m_hashes[i]);
+            any_invariant = any_invariant || invariant_inputs[i];
+            m_versions[i] = version;
+            m_hashes[i] = hash;
+        }
+
+        if (m_split_done)
+        {
+            bool hit = true;
+            for (size_t i = 0; i < inputs.size(); i++)
+            {
+                hit = hit && (invariant_inputs[i] || !m_split_inputs[i]);
+            }
+            m_split_misses = hit ? 0 : m_split_misses + 1;
+        }
+        if (m_split_count < s_max_splits &&
+            ((!m_split_done && any_invariant) || m_split_misses >= s_split_misses))
+        {
+            split(invariant_inputs);
+        }
+
+        rc = m_split ? run_split(*m_split, outputs, inputs) : m_executable->call(outputs, inputs);
+    }
+
+    // Outputs are written without Tensor::write, and may be passed as inputs of the next call
+    for (auto& output : outputs)
+    {
+        output->update_version();
+    }
+    return rc;
+}
+
+bool runtime::memoize::MemoizeExecutable::run_split(
+    Split& split,
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    bool reuse = split.computed;
+    for (size_t j = 0; j < split.invariant_inputs.size() && reuse; j++)
+    {
+        size_t i = split.invariant_inputs[j];
+        reuse =
+            m_versions[i] == split.computed_versions[j] && m_hashes[i] == split.computed_hashes[j];
+    }
+
+    if (reuse)
+    {
+        m_stats.reuses++;
+        m_stats.skipped_ops += split.invariant_ops;
+        m_stats.skipped_microseconds += split.compute_microseconds;
+    }
+    else
+    {
+        vector<shared_ptr<runtime::Tensor>> invariant_inputs;
+        for (size_t i : split.invariant_inputs)
+        {
+            invariant_inputs.push_back(inputs[i]);
+        }
+        stopwatch timer;
+        timer.start();
+        if (!split.invariant_executable->call(split.invariant_values, invariant_inputs))
+        {
+            return false;
+        }
+        timer.stop();
+        split.compute_microseconds = timer.get_microseconds();
+        split.computed = true;
+        for (size_t j = 0; j < split.invariant_inputs.size(); j++)
+        {
+            split.computed_versions[j] = m_versions[split.invariant_inputs[j]];
+            split.computed_hashes[j] = m_hashes[split.invariant_inputs[j]];
+        }
+        m_stats.recomputes++;
+    }
+
+    vector<shared_ptr<runtime::Tensor>> main_inputs(inputs);
+    main_inputs.insert(
+        main_inputs.end(), split.invariant_values.begin(), split.invariant_values.end());
+    return split.main_executable->call(outputs, main_inputs);
+}
+
+void runtime::memoize::MemoizeExecutable::split(const vector<bool>& invariant_inputs)
+{
+    m_split_done = true;
+    m_split_inputs = invariant_inputs;
+    m_split_count++;
+    m_split_misses = 0;
+    m_split.reset();
+
+    // Ops are invariant if they only depend on invariant inputs and constants, and compute the
+    // same values each time they run
+    const ParameterVector& parameters = m_function->get_parameters();
+    unordered_set<Node*> invariant;
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        if (invariant_inputs[i])
+        {
+            invariant.insert(parameters[i].get());
+        }
+    }
+    NodeVector invariant_ops;
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_output() || node->has_state() ||
+            dynamic_pointer_cast<op::AllReduce>(node) ||
+            dynamic_pointer_cast<op::BroadcastDistributed>(node) ||
+            dynamic_pointer_cast<op::Send>(node) || dynamic_pointer_cast<op::Recv>(node))
+        {
+            continue;
+        }
+        bool is_invariant = true;
+        for (auto& arg : node->get_arguments())
+        {
+            is_invariant = is_invariant && invariant.count(arg.get()) != 0;
+        }
+        if (is_invariant)
+        {
+            invariant.insert(node.get());
+            if (!node->is_constant())
+            {
+                invariant_ops.push_back(node);
+            }
+        }
+    }
+
+    // The values of invariant ops that the rest of the function uses
+    NodeVector invariant_values;
+    for (auto& node : invariant_ops)
+    {
+        for (auto& user : node->get_users())
+        {
+            if (invariant.count(user.get()) == 0)
+            {
+                if (node->get_output_size() != 1)
+                {
+                    return;
+                }
+                invariant_values.push_back(node);
+                break;
+            }
+        }
+    }
+    if (invariant_values.empty())
+    {
+        return;
+    }
+
+    auto clone = [](const shared_ptr<Node>& node, NodeMap& node_map) {
+        NodeVector args;
+        for (auto& arg : node->get_arguments())
+        {
+            args.push_back(node_map.at(arg.get()));
+        }
+        node_map[node.get()] = node->copy_with_new_args(args);
+    };
+
+    // The invariant function takes the invariant inputs and returns the invariant values
+    unique_ptr<Split> split(new Split());
+    NodeMap invariant_map;
+    ParameterVector invariant_parameters;
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        if (invariant_inputs[i])
+        {
+            auto parameter = make_shared<op::Parameter>(parameters[i]->get_element_type(),
+                                                        parameters[i]->get_shape());
+            invariant_map[parameters[i].get()] = parameter;
+            invariant_parameters.push_back(parameter);
+            split->invariant_inputs.push_back(i);
+        }
+    }
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        if (invariant.count(node.get()) != 0 && !node->is_parameter())
+        {
+            clone(node, invariant_map);
+        }
+    }
+    ResultVector invariant_results;
+    for (auto& node : invariant_values)
+    {
+        invariant_results.push_back(make_shared<op::Result>(invariant_map.at(node.get())));
+    }
+    auto invariant_function = make_shared<Function>(invariant_results, invariant_parameters);
+
+    // The main function takes the inputs of the original function followed by the invariant
+    // values, and computes the remaining ops
+    NodeMap main_map;
+    ParameterVector main_parameters;
+    for (auto& node : invariant_values)
+    {
+        auto parameter = make_shared<op::Parameter>(node->get_element_type(), node->get_shape());
+        main_map[node.get()] = parameter;
+        main_parameters.push_back(parameter);
+    }
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        if (main_map.count(node.get()) == 0 &&
+            (invariant.count(node.get()) == 0 || node->is_parameter() || node->is_constant()))
+        {
+            clone(node, main_map);
+        }
+    }
+    ParameterVector original_parameters;
+    for (auto& parameter : parameters)
+    {
+        original_parameters.push_back(
+            static_pointer_cast<op::Parameter>(main_map.at(parameter.get())));
+    }
+    main_parameters.insert(
+        main_parameters.begin(), original_parameters.begin(), original_parameters.end());
+    ResultVector main_results;
+    for (auto& result : m_function->get_results())
+    {
+        main_results.push_back(static_pointer_cast<op::Result>(main_map.at(result.get())));
+    }
+    auto main_function = make_shared<Function>(main_results, main_parameters);
+
+    split->invariant_executable =
+        m_wrapped_backend->compile(invariant_function, m_enable_performance_collection);
+    split->main_executable =
+        m_wrapped_backend->compile(main_function, m_enable_performance_collection);
+    for (auto& node : invariant_values)
+    {
+        split->invariant_values.push_back(
+            m_wrapped_backend->create_tensor(node->get_element_type(), node->get_shape()));
+    }
+    split->invariant_ops = invariant_ops.size();
+    split->computed_versions.resize(split->invariant_inputs.size());
+    split->computed_hashes.resize(split->invariant_inputs.size());
+    NGRAPH_DEBUG << "memoize: " << split->invariant_ops << " of the ops of "
+                 << m_function->get_name() << " are invariant, with "
+                 << invariant_values.size() << " values used by the other ops";
+    m_split = move(split);
+}
+
+// FNV-1a over 64-bit words of the tensor's contents
+size_t runtime::memoize::MemoizeExecutable::hash_contents(const runtime::Tensor& tensor)
+{
+    size_t size = tensor.get_size_in_bytes();
+    if (m_hash_buffer.size() < size)
+    {
+        m_hash_buffer.resize(size);
+    }
+    tensor.read(m_hash_buffer.data(), size);
+    const char* data = m_hash_buffer.data();
+
+    uint64_t hash = 14695981039346656037ULL;
+    const uint64_t prime = 1099511628211ULL;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < size; i++)
+    {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * prime;
+    }
+    return static_cast<size_t>(hash);
+}
+
+runtime::memoize::MemoizeStats runtime::memoize::MemoizeExecutable::get_stats() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_stats;
+}
@@ -0,0 +1,176 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace memoize
+        {
+            class MemoizeBackend;
+            class MemoizeExecutable;
+            struct MemoizeStats;
+        }
+    }
+}
+
+///
+/// \brief Counts of the work a `MemoizeExecutable` skipped by reusing results.
+///
+struct ngraph::runtime::memoize::MemoizeStats
+{
+    /// Calls of the executable.
+    size_t calls = 0;
+    /// Calls that reused the cached results of the invariant sub-graph.
+    size_t reuses = 0;
+    /// Calls that computed the invariant sub-graph.
+    size_t recomputes = 0;
+    /// Ops that were not executed because their results were reused.
+    size_t skipped_ops = 0;
+    /// Estimate of the time not spent, from the last time the invariant sub-graph was computed.
+    size_t skipped_microseconds = 0;
+};
+
+///
+/// \brief Wrapper class that memoizes sub-graphs whose inputs don't change between calls, on
+///        top of any backend.
+///
+/// `compile` returns a `MemoizeExecutable`; tensors are created by the wrapped backend.
+///
+/// This class is instantiated by `ngraph::runtime::Backend::create` when the environment
+/// variable NGRAPH_MEMOIZE is set.
+///
+/// Changed inputs are detected from `Tensor::get_version`, which `Tensor::write` updates. Code
+/// that modifies the memory of a tensor directly, e.g. one created over a user pointer, must
+/// call `Tensor::update_version` afterwards, or the cached results are reused. With
+/// hash_inputs set (NGRAPH_MEMOIZE_HASH_INPUTS=1 for `Backend::create`), the contents of the
+/// inputs are hashed on every call as well, which catches such writes at the cost of reading
+/// every input.
+///
+class ngraph::runtime::memoize::MemoizeBackend : public Backend
+{
+public:
+    MemoizeBackend(std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
+                   bool hash_inputs = false);
+
+    std::shared_ptr<Tensor>
+        create_tensor(const element::Type& type, const Shape& shape, void* memory_pointer) override;
+
+    std::shared_ptr<Tensor> create_tensor(const element::Type& type, const Shape& shape) override;
+
+    std::shared_ptr<Tensor> create_dynamic_tensor(const element::Type& type,
+                                                  const PartialShape& shape) override;
+
+    bool supports_dynamic_tensors() override;
+
+    std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
+                                        bool enable_performance_data = false) override;
+
+    bool is_supported(const Node& node) const override;
+
+    bool is_supported_property(const Property prop) const override;
+
+    bool set_config(const std::map<std::string, std::string>& config,
+                    std::string& error) override;
+
+private:
+    std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
+    bool m_hash_inputs;
+};
+
+///
+/// \brief Executable that skips the part of a function whose inputs did not change since it
+///        was last computed.
+///
+/// Inputs are "invariant" when they are passed the same data as in the previous call, which
+/// is detected from `Tensor::get_version` and, if enabled, a hash of their contents, or when
+/// their parameter is marked cacheable. Once some inputs are invariant, the function is split
+/// into an invariant function, which computes every op that only depends on invariant inputs
+/// and constants (e.g. weight transforms or positional embeddings), and a main function that
+/// takes the values the invariant function produces as extra inputs. Both are compiled with
+/// the wrapped backend. A call runs the invariant function only when one of its inputs changed
+/// since its results were cached, and always runs the main function.
+///
+/// If the inputs that are invariant change, the function is split again. Functions with
+/// dynamic shapes or control dependencies are run as they are.
+///
+class ngraph::runtime::memoize::MemoizeExecutable : public ngraph::runtime::Executable
+{
+public:
+    MemoizeExecutable(std::shared_ptr<Function> function,
+                      std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
+                      bool enable_performance_collection = false,
+                      bool hash_inputs = false);
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    /// \brief Returns counts of the work skipped so far.
+    MemoizeStats get_stats() const;
+
+private:
+    struct Split
+    {
+        std::vector<size_t> invariant_inputs;
+        std::shared_ptr<Executable> invariant_executable;
+        std::shared_ptr<Executable> main_executable;
+        std::vector<std::shared_ptr<runtime::Tensor>> invariant_values;
+        size_t invariant_ops = 0;
+        bool computed = false;
+        std::vector<size_t> computed_versions;
+        std::vector<size_t> computed_hashes;
+        size_t compute_microseconds = 0;
+    };
+
+    void split(const std::vector<bool>& invariant_inputs);
+    bool run_split(Split& split,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+    size_t hash_contents(const runtime::Tensor& tensor);
+
+    std::shared_ptr<Function> m_function;
+    std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
+    bool m_enable_performance_collection;
+    bool m_hash_inputs;
+    bool m_memoizable;
+    std::shared_ptr<Executable> m_executable;
+
+    // Versions and hashes of the inputs of the previous call
+    std::vector<size_t> m_versions;
+    std::vector<size_t> m_hashes;
+    std::vector<char> m_hash_buffer;
+
+    bool m_split_done = false;
+    std::vector<bool> m_split_inputs;
+    std::unique_ptr<Split> m_split;
+    size_t m_split_count = 0;
+    size_t m_split_misses = 0;
+
+    MemoizeStats m_stats;
+    mutable std::mutex m_mutex;
+};
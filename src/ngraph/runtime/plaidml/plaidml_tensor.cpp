@@ -49,6 +49,7 @@ void ngraph::runtime::plaidml::PlaidML_Tensor::write(const void* p, size_t n)
     {
         NGRAPH_DEBUG << "Logically zeroing tensor " << this;
         m_is_logically_zero = true;
+        update_version();
         return;
     }
 
@@ -78,6 +79,7 @@ void ngraph::runtime::plaidml::PlaidML_Tensor::write(const void* p, size_t n)
     const char* src = static_cast<const char*>(p);
     char* dest = mp.raw();
     std::copy(src, src + n, dest);
+    update_version();
 }
 
 void ngraph::runtime::plaidml::PlaidML_Tensor::read(void* p, size_t n) const
@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "ngraph/op/embedding_bag.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \param per_sample_weights May be null, in which case every index has weight 1
+            template <typename T, typename U>
+            void embedding_bag(const U* indices,
+                               const T* weights,
+                               const U* offsets,
+                               const T* per_sample_weights,
+                               T* out,
+                               size_t indices_count,
+                               size_t bag_count,
+                               size_t vec_len,
+                               op::EmbeddingBag::Mode mode)
+            {
+                for (size_t b = 0; b < bag_count; b++)
+                {
+                    size_t begin = static_cast<size_t>(offsets[b]);
+                    size_t end =
+                        b + 1 < bag_count ? static_cast<size_t>(offsets[b + 1]) : indices_count;
+                    T* out_row = out + b * vec_len;
+                    std::fill(out_row, out_row + vec_len, T(0));
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        const T* row = &weights[vec_len * static_cast<size_t>(indices[i])];
+                        T scale = per_sample_weights ? per_sample_weights[i] : T(1);
+                        for (size_t j = 0; j < vec_len; j++)
+                        {
+                            if (mode == op::EmbeddingBag::Mode::MAX)
+                            {
+                                out_row[j] =
+                                    (i == begin || row[j] > out_row[j]) ? row[j] : out_row[j];
+                            }
+                            else
+                            {
+                                out_row[j] += scale * row[j];
+                            }
+                        }
+                    }
+                    if (mode == op::EmbeddingBag::Mode::MEAN && end > begin)
+                    {
+                        for (size_t j = 0; j < vec_len; j++)
+                        {
+                            out_row[j] /= static_cast<T>(end - begin);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -16,8 +16,9 @@
 
 #pragma once
 
-#include <random>
+#include <cstdint>
 
+#include "ngraph/state/philox.hpp"
 #include "ngraph/state/rng_state.hpp"
 
 namespace ngraph
@@ -26,29 +27,48 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Writes `count` mask elements, element `i` being bit `i % 8` of packed-mask
+            ///     byte `offset + i / 8` of the Philox stream `seed`.
             template <typename T>
-            void generate_mask(T* out, size_t count, ngraph::RNGState* rng_state, bool training)
+            void generate_mask_from_offset(
+                T* out, size_t count, bool training, uint64_t seed, double prob, uint64_t offset)
             {
-                auto& gen = rng_state->get_generator();
-                auto& bd = rng_state->get_distribution();
-
-                for (size_t i = 0; i < count; i++)
+                if (!training)
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = static_cast<T>(1);
+                    }
+                    return;
+                }
+                uint64_t threshold = philox::bernoulli_threshold(prob);
+                for (size_t i = 0; i < count; i += 8)
                 {
-                    out[i] = training ? static_cast<T>(bd(gen)) : static_cast<T>(1);
+                    uint8_t bits = philox::bernoulli_byte(seed, offset + i / 8, threshold);
+                    for (size_t j = i; j < count && j < i + 8; j++)
+                    {
+                        out[j] = static_cast<T>((bits >> (j - i)) & 1);
+                    }
                 }
             }
 
             template <typename T>
-            void generate_mask_no_state(
-                T* out, size_t count, bool training, uint32_t seed, double prob)
+            void generate_mask(T* out, size_t count, ngraph::RNGState* rng_state, bool training)
             {
-                std::mt19937 gen(seed);
-                std::bernoulli_distribution bd(prob);
+                uint64_t offset = rng_state->advance(count);
+                generate_mask_from_offset(out,
+                                          count,
+                                          training,
+                                          rng_state->get_seed(),
+                                          rng_state->get_probability(),
+                                          offset);
+            }
 
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = training ? static_cast<T>(bd(gen)) : static_cast<T>(1);
-                }
+            template <typename T>
+            void generate_mask_no_state(
+                T* out, size_t count, bool training, uint64_t seed, double prob)
+            {
+                generate_mask_from_offset(out, count, training, seed, prob, 0);
             }
         }
     }
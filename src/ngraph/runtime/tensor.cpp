@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/type/element_type.hpp"
 
 using namespace ngraph;
@@ -76,6 +79,26 @@ bool runtime::Tensor::get_stale() const
 void runtime::Tensor::set_stale(bool val)
 {
     m_stale = val;
+    if (val)
+    {
+        update_version();
+    }
+}
+
+size_t runtime::Tensor::next_version()
+{
+    static atomic<size_t> version{0};
+    return ++version;
+}
+
+future<void> runtime::Tensor::write_async(const void* p, size_t n)
+{
+    return ThreadPool::get_default().submit([this, p, n]() { write(p, n); });
+}
+
+future<void> runtime::Tensor::read_async(void* p, size_t n) const
+{
+    return ThreadPool::get_default().submit([this, p, n]() { read(p, n); });
 }
 
 void runtime::Tensor::copy_from(const ngraph::runtime::Tensor& source)
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -41,6 +42,7 @@ namespace ngraph
             Tensor(const std::shared_ptr<ngraph::descriptor::Tensor>& descriptor)
                 : m_descriptor(descriptor)
                 , m_stale(true)
+                , m_version(next_version())
             {
             }
 
@@ -90,9 +92,19 @@ namespace ngraph
             bool get_stale() const;
 
             /// \brief Set the stale value of the tensor. A tensor is stale if its data is
-            /// changed.
+            /// changed. Marking it stale also gives the tensor a new version.
             void set_stale(bool val);
 
+            /// \brief Get the version of the tensor's data. Versions are unique across tensors
+            /// and change whenever data is written through write(), the tensor is marked stale or
+            /// update_version() is called, but not when its memory is modified directly.
+            /// \return the version of the tensor's data
+            size_t get_version() const { return m_version; }
+
+            /// \brief Gives the tensor a new version. Implementations of write() call it, and
+            /// so should code that modifies the memory of the tensor directly.
+            void update_version() { m_version = next_version(); }
+
             /// \brief Write bytes directly into the tensor
             /// \param p Pointer to source of data
             /// \param n Number of bytes to write, must be integral number of elements.
@@ -103,6 +115,26 @@ namespace ngraph
             /// \param n Number of bytes to read, must be integral number of elements.
             virtual void read(void* p, size_t n) const = 0;
 
+            /// \brief Write bytes into the tensor without blocking the caller
+            ///
+            /// The default implementation performs write() on
+            /// runtime::ThreadPool::get_default(). The tensor and the source buffer must
+            /// remain valid until the returned future is ready.
+            /// \param p Pointer to source of data
+            /// \param n Number of bytes to write, must be integral number of elements.
+            /// \returns future that becomes ready once the data has been written
+            virtual std::future<void> write_async(const void* p, size_t n);
+
+            /// \brief Read bytes from the tensor without blocking the caller
+            ///
+            /// The default implementation performs read() on
+            /// runtime::ThreadPool::get_default(). The tensor and the destination buffer must
+            /// remain valid until the returned future is ready.
+            /// \param p Pointer to destination for data
+            /// \param n Number of bytes to read, must be integral number of elements.
+            /// \returns future that becomes ready once the data has been read
+            virtual std::future<void> read_async(void* p, size_t n) const;
+
             /// \brief copy bytes directly from source to this tensor
             /// \param source The source tensor
             virtual void copy_from(const ngraph::runtime::Tensor& source);
@@ -132,6 +164,10 @@ namespace ngraph
         protected:
             std::shared_ptr<ngraph::descriptor::Tensor> m_descriptor;
             bool m_stale;
+
+        private:
+            static size_t next_version();
+            size_t m_version;
         };
 
         using TensorViewPtrs = std::vector<std::shared_ptr<Tensor>>;
@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "ngraph/runtime/thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::ThreadPool::ThreadPool(size_t thread_count)
+    : m_stop(false)
+{
+    if (thread_count == 0)
+    {
+        throw invalid_argument("ThreadPool requires at least one thread");
+    }
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        m_threads.emplace_back(&ThreadPool::worker, this);
+    }
+}
+
+runtime::ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    for (thread& t : m_threads)
+    {
+        t.join();
+    }
+}
+
+// Positive value of an environment variable, or default_count
+static size_t get_env_thread_count(const char* name, size_t default_count)
+{
+    if (const char* env = getenv(name))
+    {
+        int value = atoi(env);
+        if (value > 0)
+        {
+            return static_cast<size_t>(value);
+        }
+    }
+    return default_count;
+}
+
+runtime::ThreadPool& runtime::ThreadPool::get_default()
+{
+    static ThreadPool s_pool(get_env_thread_count("NGRAPH_ASYNC_THREADS", 2));
+    return s_pool;
+}
+
+namespace
+{
+    struct CompilePool
+    {
+        CompilePool()
+            : thread_count(get_env_thread_count("NGRAPH_COMPILE_THREADS",
+                                                max(thread::hardware_concurrency(), 1u)))
+        {
+        }
+
+        mutex pool_mutex;
+        size_t thread_count;
+        // Created lazily so that processes that never compile in parallel start no threads
+        shared_ptr<runtime::ThreadPool> pool;
+    };
+
+    CompilePool& get_compile_pool_state()
+    {
+        static CompilePool s_state;
+        return s_state;
+    }
+}
+
+shared_ptr<runtime::ThreadPool> runtime::ThreadPool::get_compile_pool()
+{
+    CompilePool& state = get_compile_pool_state();
+    lock_guard<mutex> lock(state.pool_mutex);
+    if (state.thread_count > 1 && state.pool == nullptr)
+    {
+        state.pool = make_shared<ThreadPool>(state.thread_count);
+    }
+    return state.pool;
+}
+
+void runtime::ThreadPool::set_compile_thread_count(size_t thread_count)
+{
+    CompilePool& state = get_compile_pool_state();
+    shared_ptr<ThreadPool> old_pool;
+    {
+        lock_guard<mutex> lock(state.pool_mutex);
+        state.thread_count = thread_count;
+        old_pool = move(state.pool);
+    }
+    // Joins the old workers here, outside the lock, unless a caller still holds the pool
+}
+
+size_t runtime::ThreadPool::get_compile_thread_count()
+{
+    CompilePool& state = get_compile_pool_state();
+    lock_guard<mutex> lock(state.pool_mutex);
+    return state.thread_count;
+}
+
+void runtime::ThreadPool::enqueue(function<void()> task)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_stop)
+        {
+            throw runtime_error("ThreadPool::submit called on a stopped pool");
+        }
+        m_queue.push_back(move(task));
+    }
+    m_cv.notify_one();
+}
+
+void runtime::ThreadPool::worker()
+{
+    while (true)
+    {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            // Drain the queue before exiting so no future is left without a value
+            if (m_queue.empty())
+            {
+                return;
+            }
+            task = move(m_queue.front());
+            m_queue.pop_front();
+        }
+        task();
+    }
+}
@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ThreadPool;
+    }
+}
+
+/// \brief A fixed-size pool of worker threads servicing a FIFO task queue.
+///
+/// Tasks are started in submission order. With a single worker thread tasks also complete
+/// in submission order, which backends use to serialize executions of one Executable.
+class ngraph::runtime::ThreadPool
+{
+public:
+    /// \param thread_count Number of worker threads, must be at least one.
+    explicit ThreadPool(size_t thread_count);
+    ~ThreadPool();
+
+    /// \brief Queue a callable for execution on a worker thread.
+    /// \param f The callable to run. Exceptions thrown by f are stored in the future.
+    /// \returns A future holding the result of f.
+    template <typename F>
+    std::future<typename std::result_of<F()>::type> submit(F&& f)
+    {
+        using R = typename std::result_of<F()>::type;
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(f));
+        std::future<R> rc = task->get_future();
+        enqueue([task]() { (*task)(); });
+        return rc;
+    }
+
+    size_t get_thread_count() const { return m_threads.size(); }
+    /// \brief The process-wide pool used by the default asynchronous Tensor and Executable
+    ///     entry points. The thread count defaults to 2 and may be set with the
+    ///     NGRAPH_ASYNC_THREADS environment variable.
+    static ThreadPool& get_default();
+
+    /// \brief The process-wide pool for compile-time work that can be split into independent
+    ///     tasks, such as constant folding and ONNX initializer conversion. It is created on
+    ///     first use with NGRAPH_COMPILE_THREADS threads (default: hardware concurrency).
+    /// \returns nullptr if compile-time work is to run on the calling thread only.
+    static std::shared_ptr<ThreadPool> get_compile_pool();
+    /// \brief Replaces the compile pool with one of thread_count threads. 0 or 1 shuts it
+    ///     down. The old pool finishes its queued tasks and exits once its last user
+    ///     releases it.
+    static void set_compile_thread_count(size_t thread_count);
+    static size_t get_compile_thread_count();
+
+private:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void enqueue(std::function<void()> task);
+    void worker();
+
+    std::vector<std::thread> m_threads;
+    std::deque<std::function<void()>> m_queue;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop;
+};
@@ -14,9 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <queue>
+#include <sstream>
 #include <stack>
 
 #include "ngraph/cpio.hpp"
@@ -47,6 +49,7 @@
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_bag.hpp"
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/equal.hpp"
 #include "ngraph/op/erf.hpp"
@@ -227,6 +230,7 @@ public:
     json serialize_output_vector(const OutputVector& output_vector);
     json serialize_node_reference(const Node& node);
     json serialize_node(const Node& node);
+    void serialize_node_attributes(const Node& node, json& node_js);
     json serialize_axis_set(const AxisSet& axis_set);
 
 protected:
@@ -251,7 +255,7 @@ public:
     OutputVector deserialize_output_vector(json j);
     ParameterVector deserialize_parameter_vector(json j);
     shared_ptr<Node> deserialize_node_reference(json j);
-    shared_ptr<Node> deserialize_node(json j);
+    shared_ptr<Node> deserialize_node(json j, const OutputVector* inputs = nullptr);
     AxisSet deserialize_axis_set(json j);
 
 protected:
@@ -260,6 +264,89 @@ protected:
     function<const_data_callback_t> m_const_data_callback;
 };
 
+// The binary format holds one function as a stream of LEB128 varints:
+//   header:   s_binary_magic, format version
+//   function: name, node count, nodes, parameter count, parameters, result count, results
+//   node:     op, name, friendly name (empty if it is the name), input count, inputs,
+//             control dependency count, control dependencies, attributes and, for Constant,
+//             the size and bytes of its data
+//   input:    distance back to the node of the output, output index
+// Nodes are in topological order. Nodes are referenced by their distance back from the node
+// that uses them, and parameters and results by their position. Strings, including op names,
+// are interned: the first use of a string writes 0 followed by its size and bytes, later uses
+// write its position in the order of first use plus 1. Attributes are the op specific values
+// of the json format, written with a BinaryTag.
+static const char s_binary_magic[] = {'\x89', 'n', 'g', 'r', 'a', 'p', 'h', '\n'};
+static const uint64_t s_binary_version = 1;
+
+enum class BinaryTag : uint8_t
+{
+    null_value,
+    false_value,
+    true_value,
+    unsigned_value,
+    negative_value,
+    float_value,
+    string_value,
+    array_value,
+    object_value
+};
+
+class BinarySerializer : public JSONSerializer
+{
+public:
+    BinarySerializer(ostream& out);
+
+    void write_function(const Function& function);
+
+protected:
+    void write_node(const Node& node);
+    void write_varint(uint64_t value);
+    void write_string(const string& value);
+    void write_value(const json& value);
+
+    ostream& m_out;
+    unordered_map<string, size_t> m_string_ids;
+    unordered_map<const Node*, size_t> m_node_ids;
+};
+
+class BinaryDeserializer : public JSONDeserializer
+{
+public:
+    BinaryDeserializer(istream& in);
+
+    shared_ptr<Function> read_function();
+
+protected:
+    shared_ptr<Node> read_node();
+    shared_ptr<Node> read_node_reference();
+    uint64_t read_varint();
+    size_t read_count();
+    string read_string();
+    json read_value();
+    uint8_t read_byte();
+    void read_bytes(char* data, size_t size);
+
+    streambuf* m_in;
+    // Input that is not seekable is read into memory so that its size is known
+    stringbuf m_buffer;
+    size_t m_remaining;
+    vector<string> m_strings;
+    vector<shared_ptr<Node>> m_nodes;
+    vector<char> m_constant_data;
+};
+
+static bool is_binary(istream& in)
+{
+    char magic[sizeof(s_binary_magic)];
+    auto offset = in.tellg();
+    in.read(magic, sizeof(magic));
+    bool rc = in.gcount() == sizeof(magic) && memcmp(magic, s_binary_magic, sizeof(magic)) == 0;
+    in.clear();
+    in.seekg(offset, ios_base::beg);
+    return rc;
+}
+
 static string
     serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data);
 
@@ -455,10 +542,27 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+void ngraph::serialize_binary(const string& path, shared_ptr<ngraph::Function> func)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_binary(out, func);
+}
+
+void ngraph::serialize_binary(ostream& out, shared_ptr<ngraph::Function> func)
+{
+    BinarySerializer serializer(out);
+    serializer.write_function(*func);
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    if (is_binary(in))
+    {
+        BinaryDeserializer deserializer(in);
+        rc = deserializer.read_function();
+    }
+    else if (cpio::is_cpio(in))
     {
         cpio::Reader reader(in);
         vector<cpio::FileInfo> file_info = reader.get_file_info();
@@ -513,6 +617,12 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
         ifstream in(s, ios_base::binary | ios_base::in);
         rc = deserialize(in);
     }
+    else if (s.compare(0, sizeof(s_binary_magic), s_binary_magic, sizeof(s_binary_magic)) == 0)
+    {
+        istringstream in(s);
+        BinaryDeserializer deserializer(in);
+        rc = deserializer.read_function();
+    }
     else
     {
         json js = json::parse(s);
@@ -716,7 +826,7 @@ struct OutputVectorHelper
     OutputVector m_vector;
 };
 
-shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
+shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js, const OutputVector* inputs)
 {
     shared_ptr<Node> node;
     try
@@ -726,7 +836,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         string friendly_name = get_value<string>(node_js, "friendly_name");
         vector<json> control_deps_inputs = get_value<vector<json>>(node_js, "control_deps");
         vector<string> node_outputs = get_value<vector<string>>(node_js, "outputs");
-        OutputVectorHelper args(deserialize_output_vector(node_js["inputs"]));
+        OutputVectorHelper args(inputs ? *inputs : deserialize_output_vector(node_js["inputs"]));
 #if !(defined(__GNUC__) && __GNUC__ == 4 && __GNUC_MINOR__ == 8)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic error "-Wswitch"
@@ -907,8 +1017,16 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
             auto shape = type_node_js.at("shape");
-            auto value = node_js.at("value").get<vector<string>>();
-            node = make_shared<op::Constant>(element_type, shape, value);
+            if (has_key(node_js, "value"))
+            {
+                auto value = node_js.at("value").get<vector<string>>();
+                node = make_shared<op::Constant>(element_type, shape, value);
+            }
+            else
+            {
+                // Binary constant data
+                node = m_const_data_callback(node_name, element_type, shape);
+            }
             break;
         }
         case OP_TYPEID::Convert:
@@ -1145,6 +1263,19 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             node = make_shared<op::Elu>(args[0], args[1]);
             break;
         }
+        case OP_TYPEID::EmbeddingBag:
+        {
+            auto mode = node_js.at("mode").get<op::EmbeddingBag::Mode>();
+            if (args.size() == 4)
+            {
+                node = make_shared<op::EmbeddingBag>(args[0], args[1], args[2], args[3], mode);
+            }
+            else
+            {
+                node = make_shared<op::EmbeddingBag>(args[0], args[1], args[2], mode);
+            }
+            break;
+        }
         case OP_TYPEID::EmbeddingLookup:
         {
             node = make_shared<op::EmbeddingLookup>(args[0], args[1]);
@@ -1915,7 +2046,7 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         {
             node_name = "UNKNOWN";
         }
-        throw runtime_error("Error parsing json at node '" + node_name + "'");
+        throw ngraph_error("Error parsing json at node '" + node_name + "'");
     }
     return node;
 }
@@ -2032,6 +2163,12 @@ json JSONSerializer::serialize_node(const Node& n)
         node["provenance_tags"] = provenance_tags;
     }
 
+    serialize_node_attributes(n, node);
+    return node;
+}
+
+void JSONSerializer::serialize_node_attributes(const Node& n, json& node)
+{
     string node_op = n.description();
 #if !(defined(__GNUC__) && (__GNUC__ == 4 && __GNUC_MINOR__ == 8))
 #pragma GCC diagnostic push
@@ -2174,15 +2311,20 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant:
     {
         auto tmp = dynamic_cast<const op::Constant*>(&n);
-        if (tmp->are_all_data_elements_bitwise_identical() && shape_size(tmp->get_shape()) > 0)
+        // Binary constant data is written separately
+        if (!m_binary_constant_data)
         {
-            vector<string> vs;
-            vs.push_back(tmp->convert_value_to_string(0));
-            node["value"] = vs;
-        }
-        else
-        {
-            node["value"] = tmp->get_value_strings();
+            if (tmp->are_all_data_elements_bitwise_identical() &&
+                shape_size(tmp->get_shape()) > 0)
+            {
+                vector<string> vs;
+                vs.push_back(tmp->convert_value_to_string(0));
+                node["value"] = vs;
+            }
+            else
+            {
+                node["value"] = tmp->get_value_strings();
+            }
         }
         node["shape"] = tmp->get_shape();
         node["element_type"] = write_element_type(tmp->get_element_type());
@@ -2303,6 +2445,12 @@ json JSONSerializer::serialize_node(const Node& n)
     }
     case OP_TYPEID::Elu: { break;
     }
+    case OP_TYPEID::EmbeddingBag:
+    {
+        auto tmp = dynamic_cast<const op::EmbeddingBag*>(&n);
+        node["mode"] = tmp->get_mode();
+        break;
+    }
     case OP_TYPEID::EmbeddingLookup: { break;
     }
     case OP_TYPEID::Equal:
@@ -2843,5 +2991,393 @@ json JSONSerializer::serialize_node(const Node& n)
 #if !(defined(__GNUC__) && (__GNUC__ == 4 && __GNUC_MINOR__ == 8))
 #pragma GCC diagnostic pop
 #endif
+}
+
+BinarySerializer::BinarySerializer(ostream& out)
+    : m_out(out)
+{
+    set_binary_constant_data(true);
+}
+
+void BinarySerializer::write_function(const Function& f)
+{
+    m_out.write(s_binary_magic, sizeof(s_binary_magic));
+    write_varint(s_binary_version);
+    write_string(f.get_name());
+
+    auto ops = f.get_ordered_ops();
+    write_varint(ops.size());
+    for (auto& op : ops)
+    {
+        write_node(*op);
+    }
+
+    write_varint(f.get_parameters().size());
+    for (auto& parameter : f.get_parameters())
+    {
+        write_varint(m_node_ids.at(parameter.get()));
+    }
+    write_varint(f.get_results().size());
+    for (auto& result : f.get_results())
+    {
+        write_varint(m_node_ids.at(result.get()));
+    }
+}
+
+void BinarySerializer::write_node(const Node& n)
+{
+    size_t id = m_node_ids.size();
+    write_string(n.description());
+    write_string(n.get_name());
+    write_string(n.get_name() != n.get_friendly_name() ? n.get_friendly_name() : "");
+
+    write_varint(n.get_input_size());
+    for (auto& input : n.inputs())
+    {
+        Output<Node> output = input.get_source_output();
+        write_varint(id - m_node_ids.at(output.get_node()));
+        write_varint(output.get_index());
+    }
+    write_varint(n.get_control_dependencies().size());
+    for (auto& control_dep : n.get_control_dependencies())
+    {
+        write_varint(id - m_node_ids.at(control_dep.get()));
+    }
+
+    json attributes = json::object();
+    if (ngraph::get_provenance_enabled())
+    {
+        json provenance_tags = json::array();
+        for (auto prov_tag : n.get_provenance_tags())
+        {
+            provenance_tags.push_back(prov_tag);
+        }
+        attributes["provenance_tags"] = provenance_tags;
+    }
+    serialize_node_attributes(n, attributes);
+    write_value(attributes);
+
+    if (auto constant = dynamic_cast<const op::Constant*>(&n))
+    {
+        size_t size = shape_size(constant->get_shape()) * constant->get_element_type().size();
+        write_varint(size);
+        m_out.write(static_cast<const char*>(constant->get_data_ptr()), size);
+    }
+    m_node_ids[&n] = id;
+}
+
+void BinarySerializer::write_varint(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        m_out.put(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    m_out.put(static_cast<char>(value));
+}
+
+void BinarySerializer::write_string(const string& value)
+{
+    auto it = m_string_ids.find(value);
+    if (it != m_string_ids.end())
+    {
+        write_varint(it->second + 1);
+    }
+    else
+    {
+        m_string_ids.insert({value, m_string_ids.size()});
+        write_varint(0);
+        write_varint(value.size());
+        m_out.write(value.data(), value.size());
+    }
+}
+
+void BinarySerializer::write_value(const json& value)
+{
+    switch (value.type())
+    {
+    case json::value_t::boolean:
+        m_out.put(static_cast<char>(value.get<bool>() ? BinaryTag::true_value
+                                                      : BinaryTag::false_value));
+        break;
+    case json::value_t::number_unsigned:
+        m_out.put(static_cast<char>(BinaryTag::unsigned_value));
+        write_varint(value.get<uint64_t>());
+        break;
+    case json::value_t::number_integer:
+    {
+        int64_t integer = value.get<int64_t>();
+        if (integer >= 0)
+        {
+            m_out.put(static_cast<char>(BinaryTag::unsigned_value));
+            write_varint(static_cast<uint64_t>(integer));
+        }
+        else
+        {
+            m_out.put(static_cast<char>(BinaryTag::negative_value));
+            write_varint(static_cast<uint64_t>(-(integer + 1)));
+        }
+        break;
+    }
+    case json::value_t::number_float:
+    {
+        double number = value.get<double>();
+        uint64_t bits;
+        memcpy(&bits, &number, sizeof(bits));
+        m_out.put(static_cast<char>(BinaryTag::float_value));
+        for (size_t i = 0; i < sizeof(bits); i++)
+        {
+            m_out.put(static_cast<char>(bits >> (8 * i)));
+        }
+        break;
+    }
+    case json::value_t::string:
+        m_out.put(static_cast<char>(BinaryTag::string_value));
+        write_string(value.get_ref<const string&>());
+        break;
+    case json::value_t::array:
+        m_out.put(static_cast<char>(BinaryTag::array_value));
+        write_varint(value.size());
+        for (auto& element : value)
+        {
+            write_value(element);
+        }
+        break;
+    case json::value_t::object:
+        m_out.put(static_cast<char>(BinaryTag::object_value));
+        write_varint(value.size());
+        for (auto it = value.begin(); it != value.end(); ++it)
+        {
+            write_string(it.key());
+            write_value(it.value());
+        }
+        break;
+    default: m_out.put(static_cast<char>(BinaryTag::null_value)); break;
+    }
+}
+
+BinaryDeserializer::BinaryDeserializer(istream& in)
+    : m_in(in.rdbuf())
+{
+    auto begin = m_in->pubseekoff(0, ios_base::cur, ios_base::in);
+    auto end = m_in->pubseekoff(0, ios_base::end, ios_base::in);
+    if (begin != streampos(-1) && end != streampos(-1) &&
+        m_in->pubseekpos(begin, ios_base::in) == begin)
+    {
+        m_remaining = static_cast<size_t>(end - begin);
+    }
+    else
+    {
+        ostream buffer(&m_buffer);
+        buffer << m_in;
+        m_in = &m_buffer;
+        m_remaining = m_buffer.str().size();
+    }
+
+    set_const_data_callback([this](const string&, const element::Type& et, const Shape& shape) {
+        size_t size = read_count();
+        NGRAPH_CHECK(size == shape_size(shape) * et.size(),
+                     "Constant data size does not match its shape and element type");
+        m_constant_data.resize(size);
+        read_bytes(m_constant_data.data(), size);
+        return make_shared<op::Constant>(et, shape, m_constant_data.data());
+    });
+}
+
+shared_ptr<Function> BinaryDeserializer::read_function()
+{
+    char magic[sizeof(s_binary_magic)];
+    read_bytes(magic, sizeof(magic));
+    NGRAPH_CHECK(memcmp(magic, s_binary_magic, sizeof(magic)) == 0,
+                 "Not a binary serialized function");
+    uint64_t version = read_varint();
+    NGRAPH_CHECK(version == s_binary_version, "Unsupported binary serialization version ", version);
+    string func_name = read_string();
+
+    size_t node_count = read_count();
+    m_nodes.reserve(node_count);
+    for (size_t i = 0; i < node_count; i++)
+    {
+        m_nodes.push_back(read_node());
+    }
+
+    auto read_function_node = [this]() {
+        uint64_t index = read_varint();
+        NGRAPH_CHECK(index < m_nodes.size(), "Invalid node reference");
+        return m_nodes[index];
+    };
+    ParameterVector params(read_count());
+    for (auto& param : params)
+    {
+        param = dynamic_pointer_cast<op::Parameter>(read_function_node());
+        NGRAPH_CHECK(param, "Function parameter is not a Parameter");
+    }
+    ResultVector results(read_count());
+    for (auto& result : results)
+    {
+        result = dynamic_pointer_cast<op::Result>(read_function_node());
+        NGRAPH_CHECK(result, "Function result is not a Result");
+    }
+    m_nodes.clear();
+    return make_shared<Function>(results, params, func_name);
+}
+
+shared_ptr<Node> BinaryDeserializer::read_node()
+{
+    json node_js;
+    node_js["op"] = read_string();
+    node_js["name"] = read_string();
+    string friendly_name = read_string();
+    if (!friendly_name.empty())
+    {
+        node_js["friendly_name"] = friendly_name;
+    }
+
+    OutputVector inputs(read_count());
+    for (auto& input : inputs)
+    {
+        shared_ptr<Node> input_node = read_node_reference();
+        uint64_t output_index = read_varint();
+        NGRAPH_CHECK(output_index < input_node->get_output_size(), "Invalid output reference");
+        input = Output<Node>(input_node, output_index);
+    }
+    NodeVector control_deps(read_count());
+    for (auto& control_dep : control_deps)
+    {
+        control_dep = read_node_reference();
+    }
+
+    json attributes = read_value();
+    for (auto it = attributes.begin(); it != attributes.end(); ++it)
+    {
+        node_js[it.key()] = move(it.value());
+    }
+    shared_ptr<Node> node = deserialize_node(node_js, &inputs);
+    for (auto& control_dep : control_deps)
+    {
+        node->add_control_dependency(control_dep);
+    }
     return node;
 }
+
+shared_ptr<Node> BinaryDeserializer::read_node_reference()
+{
+    uint64_t distance = read_varint();
+    NGRAPH_CHECK(distance > 0 && distance <= m_nodes.size(), "Invalid node reference");
+    return m_nodes[m_nodes.size() - distance];
+}
+
+uint64_t BinaryDeserializer::read_varint()
+{
+    uint64_t value = 0;
+    for (size_t shift = 0;; shift += 7)
+    {
+        NGRAPH_CHECK(shift < 64, "Invalid varint");
+        uint8_t byte = read_byte();
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            break;
+        }
+    }
+    return value;
+}
+
+// Every counted element takes at least one byte, so a count or length larger than the input
+// left is corrupt and must not be allocated for
+size_t BinaryDeserializer::read_count()
+{
+    uint64_t count = read_varint();
+    NGRAPH_CHECK(count <= m_remaining,
+                 "Binary serialized function is corrupt: count ",
+                 count,
+                 " exceeds the ",
+                 m_remaining,
+                 " bytes left");
+    return static_cast<size_t>(count);
+}
+
+string BinaryDeserializer::read_string()
+{
+    uint64_t id = read_varint();
+    if (id == 0)
+    {
+        string value(read_count(), '\0');
+        read_bytes(&value[0], value.size());
+        m_strings.push_back(value);
+        return value;
+    }
+    NGRAPH_CHECK(id <= m_strings.size(), "Invalid string reference");
+    return m_strings[id - 1];
+}
+
+json BinaryDeserializer::read_value()
+{
+    json value;
+    switch (static_cast<BinaryTag>(read_byte()))
+    {
+    case BinaryTag::null_value: break;
+    case BinaryTag::false_value: value = false; break;
+    case BinaryTag::true_value: value = true; break;
+    case BinaryTag::unsigned_value: value = read_varint(); break;
+    case BinaryTag::negative_value:
+        value = -static_cast<int64_t>(read_varint()) - 1;
+        break;
+    case BinaryTag::float_value:
+    {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < sizeof(bits); i++)
+        {
+            bits |= static_cast<uint64_t>(read_byte()) << (8 * i);
+        }
+        double number;
+        memcpy(&number, &bits, sizeof(number));
+        value = number;
+        break;
+    }
+    case BinaryTag::string_value: value = read_string(); break;
+    case BinaryTag::array_value:
+    {
+        value = json::array();
+        size_t size = read_count();
+        for (size_t i = 0; i < size; i++)
+        {
+            value.push_back(read_value());
+        }
+        break;
+    }
+    case BinaryTag::object_value:
+    {
+        value = json::object();
+        size_t size = read_count();
+        for (size_t i = 0; i < size; i++)
+        {
+            string key = read_string();
+            value[key] = read_value();
+        }
+        break;
+    }
+    default: throw ngraph_error("Invalid attribute in binary serialized function");
+    }
+    return value;
+}
+
+uint8_t BinaryDeserializer::read_byte()
+{
+    auto c = m_in->sbumpc();
+    if (c == char_traits<char>::eof() || m_remaining == 0)
+    {
+        throw ngraph_error("Unexpected end of binary serialized function");
+    }
+    m_remaining--;
+    return static_cast<uint8_t>(c);
+}
+
+void BinaryDeserializer::read_bytes(char* data, size_t size)
+{
+    if (size > m_remaining || m_in->sgetn(data, size) != static_cast<streamsize>(size))
+    {
+        throw ngraph_error("Unexpected end of binary serialized function");
+    }
+    m_remaining -= size;
+}
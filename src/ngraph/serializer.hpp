@@ -48,12 +48,27 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
-    /// \brief Deserialize a Function
+    /// \brief Serialize a Function to a file in the compact binary format
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    void serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Serialize a Function to a stream in the compact binary format
+    ///
+    /// The binary format interns strings and encodes edges and attributes as varints, and
+    /// holds constant data as raw bytes. It is smaller and much faster to deserialize than
+    /// json, but is not meant for interchange with other tools. deserialize recognizes it.
+    /// \param out The output stream to which the data is serialized.
+    /// \param func The Function to serialize
+    void serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Deserialize a Function from json, cpio or binary serialized data
     /// \param in An isteam to the input data
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     /// \brief Deserialize a Function
-    /// \param str The json formatted string to deseriailze.
+    /// \param str The json formatted or binary serialized string to deseriailze, or the path
+    ///    of a file to deserialize.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 
     /// \brief If enabled adds output shapes to the serialized graph
@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ngraph
+{
+    /// \brief Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel
+    ///     Random Numbers: As Easy as 1, 2, 3"). Every output depends only on the key and the
+    ///     counter, so any range of a random stream can be generated independently. That makes
+    ///     it safe to split across threads and the results do not depend on the thread count.
+    namespace philox
+    {
+        using Block = std::array<uint32_t, 4>;
+
+        static const uint32_t s_multiplier0 = 0xD2511F53;
+        static const uint32_t s_multiplier1 = 0xCD9E8D57;
+        static const uint32_t s_weyl0 = 0x9E3779B9;
+        static const uint32_t s_weyl1 = 0xBB67AE85;
+
+        /// \brief Runs the ten Philox rounds over `counter` with the two-word `key`.
+        inline Block philox4x32_10(Block counter, uint32_t key0, uint32_t key1)
+        {
+            for (int round = 0; round < 10; round++)
+            {
+                uint64_t p0 = static_cast<uint64_t>(s_multiplier0) * counter[0];
+                uint64_t p1 = static_cast<uint64_t>(s_multiplier1) * counter[2];
+                counter = Block{{static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key0,
+                                 static_cast<uint32_t>(p1),
+                                 static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key1,
+                                 static_cast<uint32_t>(p0)}};
+                key0 += s_weyl0;
+                key1 += s_weyl1;
+            }
+            return counter;
+        }
+
+        /// \brief Returns the four random words at position `index` of the stream `seed`.
+        inline Block generate(uint64_t seed, uint64_t index)
+        {
+            return philox4x32_10(
+                Block{{static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32), 0, 0}},
+                static_cast<uint32_t>(seed),
+                static_cast<uint32_t>(seed >> 32));
+        }
+
+        /// \brief Returns the threshold below which a random word is a success of a Bernoulli
+        ///     trial with success probability `probability`.
+        inline uint64_t bernoulli_threshold(double probability)
+        {
+            if (probability <= 0)
+            {
+                return 0;
+            }
+            if (probability >= 1)
+            {
+                return uint64_t{1} << 32;
+            }
+            return static_cast<uint64_t>(probability * 4294967296.0);
+        }
+
+        /// \brief Returns eight Bernoulli trials packed into one byte, bit `i` holding trial
+        ///     `8 * byte_index + i` of the stream `seed`. This is the unit in which masks are
+        ///     generated, so a packed mask and an unpacked one with the same seed agree.
+        inline uint8_t bernoulli_byte(uint64_t seed, uint64_t byte_index, uint64_t threshold)
+        {
+            Block lo = generate(seed, 2 * byte_index);
+            Block hi = generate(seed, 2 * byte_index + 1);
+            uint32_t bits = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                bits |= static_cast<uint32_t>(lo[i] < threshold) << i;
+                bits |= static_cast<uint32_t>(hi[i] < threshold) << (i + 4);
+            }
+            return static_cast<uint8_t>(bits);
+        }
+
+        /// \brief Number of bytes in a bit-packed mask of `count` elements.
+        inline size_t packed_size(size_t count) { return (count + 7) / 8; }
+    }
+}
@@ -16,37 +16,50 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
-#include <random>
 
+#include "ngraph/state/philox.hpp"
 #include "state.hpp"
 
 namespace ngraph
 {
-    //can be based on TensorSate to cache values instead of just caching seed
+    /// \brief State of a counter-based (Philox) random stream. Each draw reserves a range of
+    ///     the stream, so successive executions produce fresh values while any single draw
+    ///     can be generated in parallel.
     class RNGState : public State
     {
     public:
-        static RNGState* create_rng_state(unsigned int seed, double probability)
+        static RNGState* create_rng_state(uint64_t seed, double probability)
         {
             auto rng = new RNGState(seed, probability);
             return rng;
         }
 
-        RNGState(unsigned int seed, double probability)
+        RNGState(uint64_t seed, double probability)
             : State()
-            , m_generator(seed)
-            , m_distribution(probability)
+            , m_seed(seed)
+            , m_probability(probability)
         {
         }
         virtual void activate() override;
         virtual void deactivate() override;
         virtual ~RNGState() override {}
-        std::mt19937& get_generator() { return m_generator; }
-        std::bernoulli_distribution& get_distribution() { return m_distribution; }
+        uint64_t get_seed() const { return m_seed; }
+        double get_probability() const { return m_probability; }
+        /// \brief Reserves the packed-mask bytes for `count` elements and returns the index of
+        ///     the first one.
+        uint64_t advance(size_t count)
+        {
+            uint64_t offset = m_offset;
+            m_offset += philox::packed_size(count);
+            return offset;
+        }
+
     protected:
-        std::mt19937 m_generator;
-        std::bernoulli_distribution m_distribution;
+        uint64_t m_seed;
+        double m_probability;
+        uint64_t m_offset{0};
     };
 }
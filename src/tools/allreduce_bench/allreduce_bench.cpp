@@ -0,0 +1,308 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// tool to measure AllReduce bus bandwidth of a DistributedInterface.
+// shared-memory ranks on one host:
+//     allreduce_bench --shm 8
+// the build's default interface (for example MPI):
+//     mpirun -np 8 allreduce_bench
+// training step time on the CPU backend with synchronous and overlapped AllReduce:
+//     allreduce_bench --shm 4 --overlap
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/distributed/shm.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void help()
+{
+    cout << R"###(
+DESCRIPTION
+    Benchmark AllReduce (f32 sum) over a range of message sizes and report the algorithm
+    bandwidth (bytes / time) and the bus bandwidth (algorithm bandwidth * 2(n-1)/n), which
+    is comparable across rank counts.
+
+SYNOPSIS
+        allreduce_bench [--shm <ranks>] [-b|--begin <bytes>] [-e|--end <bytes>]
+                        [-i|--iterations <count>] [-w|--warmup <count>]
+                        [--overlap [--layers <count>] [--width <size>]]
+
+OPTIONS
+        --shm              fork this many ranks using the shared-memory interface; without
+                           it the build's default interface is used, e.g. under mpirun
+        -b or --begin      smallest message in bytes (default 1024)
+        -e or --end        largest message in bytes (default 67108864)
+        -i or --iterations timed iterations per size (default 20)
+        -w or --warmup     untimed iterations per size (default 5)
+        --overlap          instead, time a synthetic data-parallel training step on the CPU
+                           backend, with AllReduce run inline and with it overlapped with
+                           the remaining compute (NGRAPH_CPU_ASYNC_COLLECTIVES)
+        --layers           layers of the training step (default 16)
+        --width            each layer is a width x width matmul (default 512)
+)###";
+}
+
+struct BenchOptions
+{
+    size_t begin = 1 << 10;
+    size_t end = 1 << 26;
+    size_t iterations = 20;
+    size_t warmup = 5;
+    bool overlap = false;
+    size_t layers = 16;
+    size_t width = 512;
+};
+
+static void barrier(DistributedInterface& dist)
+{
+    float token = 0;
+    dist.all_reduce(&token, &token, element::Type_t::f32, reduction::Type::SUM, 1);
+}
+
+static void run_benchmark(DistributedInterface& dist, const BenchOptions& options)
+{
+    int size = dist.get_size();
+    bool report = dist.get_rank() == 0;
+    if (report)
+    {
+        cout << dist.get_name() << " AllReduce, " << size << " ranks\n";
+        cout << setw(12) << "bytes" << setw(14) << "time (us)" << setw(16) << "algbw (GB/s)"
+             << setw(16) << "busbw (GB/s)" << "\n";
+    }
+    vector<float> in(options.end / sizeof(float), 1.0f);
+    vector<float> out(in.size());
+    for (size_t bytes = options.begin; bytes <= options.end; bytes *= 2)
+    {
+        size_t count = bytes / sizeof(float);
+        for (size_t i = 0; i < options.warmup; i++)
+        {
+            dist.all_reduce(
+                in.data(), out.data(), element::Type_t::f32, reduction::Type::SUM, count);
+        }
+        barrier(dist);
+        stopwatch timer;
+        timer.start();
+        for (size_t i = 0; i < options.iterations; i++)
+        {
+            dist.all_reduce(
+                in.data(), out.data(), element::Type_t::f32, reduction::Type::SUM, count);
+        }
+        barrier(dist);
+        timer.stop();
+        if (report)
+        {
+            double seconds = timer.get_microseconds() * 1e-6 / options.iterations;
+            double algbw = count * sizeof(float) / seconds * 1e-9;
+            double busbw = algbw * 2 * (size - 1) / size;
+            cout << setw(12) << count * sizeof(float) << setw(14) << fixed << setprecision(1)
+                 << seconds * 1e6 << setw(16) << setprecision(2) << algbw << setw(16) << busbw
+                 << "\n";
+        }
+    }
+}
+
+// A chain of matmul layers whose outputs stand in for gradients. Each gradient is reduced
+// across ranks and applied to its layer's weights, while the later layers are computed.
+static shared_ptr<Function> make_training_step(size_t layers, size_t width)
+{
+    Shape shape{width, width};
+    auto input = make_shared<op::Parameter>(element::f32, shape);
+    ParameterVector parameters{input};
+    NodeVector updated_weights;
+    shared_ptr<Node> activation = input;
+    for (size_t i = 0; i < layers; i++)
+    {
+        auto weights = make_shared<op::Parameter>(element::f32, shape);
+        parameters.push_back(weights);
+        auto gradient = make_shared<op::Dot>(activation, weights);
+        activation = make_shared<op::Tanh>(gradient);
+        auto learning_rate = op::Constant::create(element::f32, shape, {0.001f});
+        updated_weights.push_back(weights -
+                                  learning_rate * make_shared<op::AllReduce>(gradient));
+    }
+    return make_shared<Function>(updated_weights, parameters);
+}
+
+static double time_training_step(DistributedInterface& dist,
+                                 const BenchOptions& options,
+                                 bool overlap)
+{
+    if (overlap)
+    {
+        setenv("NGRAPH_CPU_ASYNC_COLLECTIVES", "1", 1);
+    }
+    else
+    {
+        unsetenv("NGRAPH_CPU_ASYNC_COLLECTIVES");
+    }
+    auto backend = runtime::Backend::create("CPU");
+    auto function = make_training_step(options.layers, options.width);
+    auto exec = backend->compile(function);
+
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    vector<float> values(options.width * options.width, 0.01f);
+    for (auto& parameter : function->get_parameters())
+    {
+        inputs.push_back(backend->create_tensor(element::f32, parameter->get_shape()));
+        inputs.back()->write(values.data(), 0, values.size() * sizeof(float));
+    }
+    for (size_t i = 0; i < function->get_output_size(); i++)
+    {
+        outputs.push_back(backend->create_tensor(element::f32, function->get_output_shape(i)));
+    }
+
+    for (size_t i = 0; i < options.warmup; i++)
+    {
+        exec->call(outputs, inputs);
+    }
+    barrier(dist);
+    stopwatch timer;
+    timer.start();
+    for (size_t i = 0; i < options.iterations; i++)
+    {
+        exec->call(outputs, inputs);
+    }
+    barrier(dist);
+    timer.stop();
+    return static_cast<double>(timer.get_microseconds()) / options.iterations;
+}
+
+static void run_overlap_benchmark(DistributedInterface& dist, const BenchOptions& options)
+{
+    // One bucket per gradient, so each AllReduce can overlap with the layers after it
+    setenv("NGRAPH_ALLREDUCE_BUCKET_BYTES",
+           to_string(options.width * options.width * sizeof(float)).c_str(),
+           1);
+    double inline_us = time_training_step(dist, options, false);
+    double overlap_us = time_training_step(dist, options, true);
+    if (dist.get_rank() == 0)
+    {
+        cout << dist.get_name() << ", " << dist.get_size() << " ranks, " << options.layers
+             << " layers of " << options.width << "x" << options.width << "\n";
+        cout << fixed << setprecision(1) << "inline AllReduce:     " << inline_us
+             << " us/step\n"
+             << "overlapped AllReduce: " << overlap_us << " us/step ("
+             << setprecision(2) << inline_us / overlap_us << "x)\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    int shm_ranks = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--shm" && i + 1 < argc)
+        {
+            shm_ranks = atoi(argv[++i]);
+        }
+        else if ((arg == "-b" || arg == "--begin") && i + 1 < argc)
+        {
+            options.begin = strtoull(argv[++i], nullptr, 10);
+        }
+        else if ((arg == "-e" || arg == "--end") && i + 1 < argc)
+        {
+            options.end = strtoull(argv[++i], nullptr, 10);
+        }
+        else if ((arg == "-i" || arg == "--iterations") && i + 1 < argc)
+        {
+            options.iterations = strtoull(argv[++i], nullptr, 10);
+        }
+        else if ((arg == "-w" || arg == "--warmup") && i + 1 < argc)
+        {
+            options.warmup = strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--overlap")
+        {
+            options.overlap = true;
+        }
+        else if (arg == "--layers" && i + 1 < argc)
+        {
+            options.layers = strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--width" && i + 1 < argc)
+        {
+            options.width = strtoull(argv[++i], nullptr, 10);
+        }
+        else
+        {
+            help();
+            return arg == "-h" || arg == "--help" ? 0 : 1;
+        }
+    }
+    if (options.begin < sizeof(float) || options.begin > options.end || options.iterations == 0)
+    {
+        cout << "invalid message size range or iteration count\n";
+        help();
+        return 1;
+    }
+
+    auto benchmark = options.overlap ? run_overlap_benchmark : run_benchmark;
+    if (shm_ranks == 0)
+    {
+        benchmark(*get_distributed_interface(), options);
+        return 0;
+    }
+
+    string name = "/ngraph_allreduce_bench_" + to_string(getpid());
+    vector<pid_t> children;
+    for (int rank = 0; rank < shm_ranks; rank++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            int status = 0;
+            try
+            {
+                distributed::SharedMemoryDistributedInterface dist(name, rank, shm_ranks);
+                benchmark(dist, options);
+            }
+            catch (const exception& e)
+            {
+                cerr << "rank " << rank << ": " << e.what() << "\n";
+                status = 1;
+            }
+            cout.flush();
+            _exit(status);
+        }
+        children.push_back(pid);
+    }
+    int result = 0;
+    for (pid_t pid : children)
+    {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            result = 1;
+        }
+    }
+    return result;
+}
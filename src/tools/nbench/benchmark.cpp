@@ -14,7 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
 #include <random>
+#include <thread>
 #if defined(__x86_64__) || defined(__amd64__)
 #include <xmmintrin.h>
 #endif
@@ -216,3 +222,247 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
     vector<runtime::PerformanceCounter> perf_data = compiled_func->get_performance_data();
     return perf_data;
 }
+
+namespace
+{
+    // Input and output tensors of one client stream
+    struct StreamTensors
+    {
+        vector<shared_ptr<runtime::HostTensor>> arg_data;
+        vector<shared_ptr<runtime::Tensor>> args;
+        vector<shared_ptr<runtime::HostTensor>> result_data;
+        vector<shared_ptr<runtime::Tensor>> results;
+    };
+}
+
+static StreamTensors make_stream_tensors(shared_ptr<Function> f,
+                                         shared_ptr<runtime::Backend> backend)
+{
+    StreamTensors tensors;
+    for (shared_ptr<op::Parameter> param : f->get_parameters())
+    {
+        auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+        auto tensor_data =
+            make_shared<runtime::HostTensor>(param->get_element_type(), param->get_shape());
+        random_init(tensor_data);
+        tensor->write(tensor_data->get_data_ptr(),
+                      tensor_data->get_element_count() * tensor_data->get_element_type().size());
+        if (param->get_cacheable())
+        {
+            tensor->set_stale(false);
+        }
+        tensors.args.push_back(tensor);
+        tensors.arg_data.push_back(tensor_data);
+    }
+    for (shared_ptr<Node> out : f->get_results())
+    {
+        tensors.results.push_back(
+            backend->create_tensor(out->get_element_type(), out->get_shape()));
+        tensors.result_data.push_back(
+            make_shared<runtime::HostTensor>(out->get_element_type(), out->get_shape()));
+    }
+    return tensors;
+}
+
+static void run_request(runtime::Executable& exec, StreamTensors& tensors, bool copy_data)
+{
+    if (copy_data)
+    {
+        for (size_t i = 0; i < tensors.args.size(); i++)
+        {
+            if (tensors.args[i]->get_stale())
+            {
+                const shared_ptr<runtime::HostTensor>& data = tensors.arg_data[i];
+                tensors.args[i]->write(data->get_data_ptr(),
+                                       data->get_element_count() *
+                                           data->get_element_type().size());
+            }
+        }
+    }
+    exec.call(tensors.results, tensors.args);
+    if (copy_data)
+    {
+        for (size_t i = 0; i < tensors.results.size(); i++)
+        {
+            const shared_ptr<runtime::HostTensor>& data = tensors.result_data[i];
+            tensors.results[i]->read(data->get_data_ptr(),
+                                     data->get_element_count() * data->get_element_type().size());
+        }
+    }
+}
+
+static bool is_cpu_backend(const string& backend_name)
+{
+    return backend_name.substr(0, backend_name.find(':')) == "CPU";
+}
+
+StreamBenchmarkResult run_stream_benchmark(shared_ptr<Function> f,
+                                           const string& backend_name,
+                                           size_t streams,
+                                           double duration_s,
+                                           double target_rate,
+                                           size_t iterations,
+                                           bool timing_detail,
+                                           int warmup_iterations,
+                                           bool copy_data)
+{
+    using clock = chrono::steady_clock;
+
+    StreamBenchmarkResult result;
+    result.backend = backend_name;
+    result.streams = max<size_t>(streams, 1);
+    result.target_rate = target_rate;
+
+    // The CPU backend runs up to NGRAPH_CPU_CONCURRENCY calls of one executable at a time.
+    // Unless the user asked for a specific value, give every stream its own context.
+    // Other backends are not guaranteed to be reentrant so their calls are serialized.
+    bool reentrant = is_cpu_backend(backend_name);
+    if (reentrant)
+    {
+        if (getenv("NGRAPH_CPU_CONCURRENCY") == nullptr)
+        {
+            size_t contexts =
+                min<size_t>(result.streams, max<unsigned>(thread::hardware_concurrency(), 1));
+#ifdef _WIN32
+            _putenv_s("NGRAPH_CPU_CONCURRENCY", to_string(contexts).c_str());
+#else
+            setenv("NGRAPH_CPU_CONCURRENCY", to_string(contexts).c_str(), 1);
+#endif
+        }
+        result.concurrency = static_cast<size_t>(atoi(getenv("NGRAPH_CPU_CONCURRENCY")));
+    }
+    else
+    {
+        result.concurrency = 1;
+    }
+
+    stopwatch timer;
+    timer.start();
+    auto backend = runtime::Backend::create(backend_name);
+    auto compiled_func = backend->compile(f, timing_detail);
+    timer.stop();
+    result.compile_ms = timer.get_microseconds() / 1000.0;
+
+    vector<StreamTensors> stream_tensors;
+    for (size_t s = 0; s < result.streams; s++)
+    {
+        stream_tensors.push_back(make_stream_tensors(f, backend));
+    }
+    set_denormals_flush_to_zero();
+
+    mutex call_mutex;
+    auto call = [&](StreamTensors& tensors) {
+        if (reentrant)
+        {
+            run_request(*compiled_func, tensors, copy_data);
+        }
+        else
+        {
+            lock_guard<mutex> lock(call_mutex);
+            run_request(*compiled_func, tensors, copy_data);
+        }
+    };
+
+    // Streams warm up, then wait for each other so the measurement starts together
+    mutex start_mutex;
+    condition_variable start_cv;
+    size_t ready = 0;
+    clock::time_point start_time;
+
+    // Each stream is scheduled at target_rate / streams, offset so the requests interleave
+    chrono::duration<double> interval(target_rate > 0 ? result.streams / target_rate : 0);
+    chrono::duration<double> duration(duration_s);
+
+    vector<vector<double>> latencies(result.streams);
+    vector<clock::time_point> finish_times(result.streams);
+    vector<string> errors(result.streams);
+    vector<thread> threads;
+    for (size_t s = 0; s < result.streams; s++)
+    {
+        threads.push_back(thread([&, s]() {
+            try
+            {
+                for (int i = 0; i < warmup_iterations; i++)
+                {
+                    call(stream_tensors[s]);
+                }
+            }
+            catch (const exception& e)
+            {
+                errors[s] = e.what();
+            }
+            {
+                unique_lock<mutex> lock(start_mutex);
+                if (++ready == result.streams)
+                {
+                    start_time = clock::now();
+                    start_cv.notify_all();
+                }
+                else
+                {
+                    start_cv.wait(lock, [&]() { return ready == result.streams; });
+                }
+            }
+            if (!errors[s].empty())
+            {
+                finish_times[s] = start_time;
+                return;
+            }
+            try
+            {
+                auto offset = chrono::duration_cast<clock::duration>(interval * s /
+                                                                     result.streams);
+                for (size_t request = 0;; request++)
+                {
+                    auto scheduled = clock::now();
+                    if (target_rate > 0)
+                    {
+                        scheduled = start_time + offset +
+                                    chrono::duration_cast<clock::duration>(interval * request);
+                    }
+                    if (duration_s > 0 ? scheduled - start_time >= duration
+                                       : request >= iterations)
+                    {
+                        break;
+                    }
+                    this_thread::sleep_until(scheduled);
+                    call(stream_tensors[s]);
+                    chrono::duration<double, milli> latency = clock::now() - scheduled;
+                    latencies[s].push_back(latency.count());
+                }
+            }
+            catch (const exception& e)
+            {
+                errors[s] = e.what();
+            }
+            finish_times[s] = clock::now();
+        }));
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    for (const string& error : errors)
+    {
+        if (!error.empty())
+        {
+            throw runtime_error(error);
+        }
+    }
+
+    vector<double> all_latencies;
+    for (const vector<double>& stream_latencies : latencies)
+    {
+        all_latencies.insert(
+            all_latencies.end(), stream_latencies.begin(), stream_latencies.end());
+    }
+    chrono::duration<double> elapsed =
+        *max_element(finish_times.begin(), finish_times.end()) - start_time;
+    result.elapsed_s = elapsed.count();
+    result.requests = all_latencies.size();
+    result.throughput = result.elapsed_s > 0 ? result.requests / result.elapsed_s : 0;
+    set_latency_statistics(result, all_latencies);
+    result.perf_data = compiled_func->get_performance_data();
+    set_op_timing(result);
+    return result;
+}
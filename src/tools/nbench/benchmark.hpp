@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "benchmark_results.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 
@@ -34,3 +35,20 @@ std::vector<ngraph::runtime::PerformanceCounter> run_benchmark(std::shared_ptr<n
                                                                bool timing_detail,
                                                                int warmup_iterations,
                                                                bool copy_data);
+
+/// \brief Benchmark one compiled executable served by several concurrent client streams.
+///
+/// Each stream owns its input and output tensors and issues requests back to back, or on a
+/// fixed schedule when target_rate (requests per second over all streams) is non-zero. Latency
+/// is measured from the time a request was scheduled, so queueing behind a saturated backend
+/// shows up in the tail percentiles. The run lasts duration_s seconds, or iterations requests
+/// per stream when duration_s is zero.
+StreamBenchmarkResult run_stream_benchmark(std::shared_ptr<ngraph::Function> f,
+                                           const std::string& backend_name,
+                                           size_t streams,
+                                           double duration_s,
+                                           double target_rate,
+                                           size_t iterations,
+                                           bool timing_detail,
+                                           int warmup_iterations,
+                                           bool copy_data);
@@ -0,0 +1,288 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <stdexcept>
+
+#include "benchmark_results.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace ngraph;
+using json = nlohmann::json;
+
+// Nearest-rank percentile of sorted values
+static double percentile(const vector<double>& sorted, double p)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    size_t rank = static_cast<size_t>(ceil(p * sorted.size()));
+    return sorted[max<size_t>(rank, 1) - 1];
+}
+
+void set_latency_statistics(StreamBenchmarkResult& result, vector<double> latencies)
+{
+    if (latencies.empty())
+    {
+        return;
+    }
+    sort(latencies.begin(), latencies.end());
+    result.latency_mean_ms =
+        accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+    result.latency_min_ms = latencies.front();
+    result.latency_p50_ms = percentile(latencies, 0.5);
+    result.latency_p99_ms = percentile(latencies, 0.99);
+    result.latency_p999_ms = percentile(latencies, 0.999);
+    result.latency_max_ms = latencies.back();
+}
+
+void set_op_timing(StreamBenchmarkResult& result)
+{
+    result.op_timing.clear();
+    for (const runtime::PerformanceCounter& p : result.perf_data)
+    {
+        OpTiming& timing = result.op_timing[p.get_node()->description()];
+        timing.total_microseconds += p.total_microseconds();
+        timing.call_count += p.call_count();
+    }
+}
+
+void print_stream_result(ostream& out, const StreamBenchmarkResult& result)
+{
+    out << "streams: " << result.streams << " (concurrency " << result.concurrency << ")\n";
+    if (result.target_rate > 0)
+    {
+        out << "target rate: " << result.target_rate << " requests/s\n";
+    }
+    out << "compile time: " << result.compile_ms << "ms\n";
+    out << result.requests << " requests in " << result.elapsed_s << "s\n";
+    out << "throughput: " << result.throughput << " requests/s\n";
+    out << "latency: mean " << result.latency_mean_ms << "ms, min " << result.latency_min_ms
+        << "ms, p50 " << result.latency_p50_ms << "ms, p99 " << result.latency_p99_ms
+        << "ms, p99.9 " << result.latency_p999_ms << "ms, max " << result.latency_max_ms
+        << "ms\n";
+}
+
+static json to_json(const StreamBenchmarkResult& result)
+{
+    json j;
+    j["model"] = result.model;
+    j["backend"] = result.backend;
+    j["streams"] = result.streams;
+    j["concurrency"] = result.concurrency;
+    j["target_rate"] = result.target_rate;
+    j["compile_ms"] = result.compile_ms;
+    j["elapsed_s"] = result.elapsed_s;
+    j["requests"] = result.requests;
+    j["throughput"] = result.throughput;
+    j["latency_ms"] = {{"mean", result.latency_mean_ms},
+                       {"min", result.latency_min_ms},
+                       {"p50", result.latency_p50_ms},
+                       {"p99", result.latency_p99_ms},
+                       {"p999", result.latency_p999_ms},
+                       {"max", result.latency_max_ms}};
+    json ops = json::object();
+    for (auto& op : result.op_timing)
+    {
+        ops[op.first] = {{"total_us", op.second.total_microseconds},
+                         {"calls", op.second.call_count}};
+    }
+    j["ops"] = ops;
+    return j;
+}
+
+static StreamBenchmarkResult from_json(const json& j)
+{
+    StreamBenchmarkResult result;
+    result.model = j.at("model").get<string>();
+    result.backend = j.at("backend").get<string>();
+    result.streams = j.at("streams").get<size_t>();
+    result.concurrency = j.at("concurrency").get<size_t>();
+    result.target_rate = j.at("target_rate").get<double>();
+    result.compile_ms = j.at("compile_ms").get<double>();
+    result.elapsed_s = j.at("elapsed_s").get<double>();
+    result.requests = j.at("requests").get<size_t>();
+    result.throughput = j.at("throughput").get<double>();
+    const json& latency = j.at("latency_ms");
+    result.latency_mean_ms = latency.at("mean").get<double>();
+    result.latency_min_ms = latency.at("min").get<double>();
+    result.latency_p50_ms = latency.at("p50").get<double>();
+    result.latency_p99_ms = latency.at("p99").get<double>();
+    result.latency_p999_ms = latency.at("p999").get<double>();
+    result.latency_max_ms = latency.at("max").get<double>();
+    if (j.count("ops") != 0)
+    {
+        for (auto it = j.at("ops").begin(); it != j.at("ops").end(); ++it)
+        {
+            OpTiming& timing = result.op_timing[it.key()];
+            timing.total_microseconds = it.value().at("total_us").get<size_t>();
+            timing.call_count = it.value().at("calls").get<size_t>();
+        }
+    }
+    return result;
+}
+
+void write_results(const string& path,
+                   const string& format,
+                   const vector<StreamBenchmarkResult>& results)
+{
+    ofstream out(path);
+    if (!out)
+    {
+        throw runtime_error("Unable to open '" + path + "' for writing");
+    }
+    if (format == "csv")
+    {
+        out << "model,backend,streams,concurrency,target_rate,compile_ms,elapsed_s,requests,"
+               "throughput,latency_mean_ms,latency_min_ms,latency_p50_ms,latency_p99_ms,"
+               "latency_p999_ms,latency_max_ms\n";
+        for (const StreamBenchmarkResult& r : results)
+        {
+            // Model paths are quoted since they may contain commas
+            out << "\"" << r.model << "\"," << r.backend << "," << r.streams << ","
+                << r.concurrency << "," << r.target_rate << "," << r.compile_ms << ","
+                << r.elapsed_s << "," << r.requests << "," << r.throughput << ","
+                << r.latency_mean_ms << "," << r.latency_min_ms << "," << r.latency_p50_ms << ","
+                << r.latency_p99_ms << "," << r.latency_p999_ms << "," << r.latency_max_ms
+                << "\n";
+        }
+    }
+    else
+    {
+        json j = json::array();
+        for (const StreamBenchmarkResult& r : results)
+        {
+            j.push_back(to_json(r));
+        }
+        out << setw(4) << j << endl;
+    }
+}
+
+vector<StreamBenchmarkResult> read_results(const string& path)
+{
+    ifstream in(path);
+    if (!in)
+    {
+        throw runtime_error("Unable to open '" + path + "'");
+    }
+    json j;
+    in >> j;
+    vector<StreamBenchmarkResult> results;
+    for (const json& r : j)
+    {
+        results.push_back(from_json(r));
+    }
+    return results;
+}
+
+// Percent change from base to current, positive when current is larger
+static double percent_change(double base, double current)
+{
+    return base == 0 ? 0 : (current - base) * 100 / base;
+}
+
+namespace
+{
+    class Comparison
+    {
+    public:
+        Comparison(ostream& out, double threshold)
+            : m_out(out)
+            , m_threshold(threshold)
+        {
+        }
+
+        // Report one metric; higher_is_better selects the direction of a regression
+        void metric(const string& name, double base, double current, bool higher_is_better)
+        {
+            double change = percent_change(base, current);
+            bool regression = (higher_is_better ? -change : change) > m_threshold;
+            m_out << "    " << left << setw(28) << name << right << setw(14) << base << " -> "
+                  << setw(14) << current << "  " << showpos << fixed << setprecision(1)
+                  << change << "%" << noshowpos << defaultfloat << setprecision(6)
+                  << (regression ? "  REGRESSION" : "") << "\n";
+            m_regressions += regression ? 1 : 0;
+        }
+
+        size_t regressions() const { return m_regressions; }
+    private:
+        ostream& m_out;
+        double m_threshold;
+        size_t m_regressions = 0;
+    };
+}
+
+size_t compare_results(ostream& out,
+                       const vector<StreamBenchmarkResult>& baseline,
+                       const vector<StreamBenchmarkResult>& current,
+                       double threshold)
+{
+    Comparison comparison(out, threshold);
+    for (const StreamBenchmarkResult& cur : current)
+    {
+        auto base_it = find_if(
+            baseline.begin(), baseline.end(), [&](const StreamBenchmarkResult& b) {
+                return b.model == cur.model && b.backend == cur.backend;
+            });
+        if (base_it == baseline.end())
+        {
+            out << cur.model << " (" << cur.backend << "): no baseline\n";
+            continue;
+        }
+        const StreamBenchmarkResult& base = *base_it;
+        out << cur.model << " (" << cur.backend << ")\n";
+        if (base.streams != cur.streams || base.target_rate != cur.target_rate)
+        {
+            out << "    warning: baseline ran " << base.streams << " streams at rate "
+                << base.target_rate << ", current ran " << cur.streams << " streams at rate "
+                << cur.target_rate << "\n";
+        }
+        comparison.metric("throughput (requests/s)", base.throughput, cur.throughput, true);
+        comparison.metric("latency p50 (ms)", base.latency_p50_ms, cur.latency_p50_ms, false);
+        comparison.metric("latency p99 (ms)", base.latency_p99_ms, cur.latency_p99_ms, false);
+        comparison.metric("latency p99.9 (ms)", base.latency_p999_ms, cur.latency_p999_ms, false);
+        comparison.metric("compile time (ms)", base.compile_ms, cur.compile_ms, false);
+
+        size_t base_total = 0;
+        for (auto& op : base.op_timing)
+        {
+            base_total += op.second.total_microseconds;
+        }
+        for (auto& op : base.op_timing)
+        {
+            auto cur_op = cur.op_timing.find(op.first);
+            if (cur_op == cur.op_timing.end() || op.second.call_count == 0 ||
+                cur_op->second.call_count == 0 ||
+                op.second.total_microseconds * 100 < base_total)
+            {
+                continue;
+            }
+            double base_us =
+                static_cast<double>(op.second.total_microseconds) / op.second.call_count;
+            double cur_us =
+                static_cast<double>(cur_op->second.total_microseconds) / cur_op->second.call_count;
+            comparison.metric(op.first + " (us/call)", base_us, cur_us, false);
+        }
+    }
+    out << comparison.regressions() << " regression(s) beyond " << threshold << "%\n";
+    return comparison.regressions();
+}
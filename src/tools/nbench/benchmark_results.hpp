@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ngraph/runtime/performance_counter.hpp"
+
+/// \brief Accumulated execution time of one op type
+struct OpTiming
+{
+    size_t total_microseconds = 0;
+    size_t call_count = 0;
+};
+
+/// \brief Throughput, latency and per-op timing of one model on one backend
+struct StreamBenchmarkResult
+{
+    std::string model;
+    std::string backend;
+    size_t streams = 0;
+    size_t concurrency = 0;
+    double target_rate = 0;
+    double compile_ms = 0;
+    double elapsed_s = 0;
+    size_t requests = 0;
+    double throughput = 0;
+    double latency_mean_ms = 0;
+    double latency_min_ms = 0;
+    double latency_p50_ms = 0;
+    double latency_p99_ms = 0;
+    double latency_p999_ms = 0;
+    double latency_max_ms = 0;
+    std::map<std::string, OpTiming> op_timing;
+    std::vector<ngraph::runtime::PerformanceCounter> perf_data;
+};
+
+/// \brief Fill the latency fields of result from per-request latencies in milliseconds
+void set_latency_statistics(StreamBenchmarkResult& result, std::vector<double> latencies);
+
+/// \brief Fill result.op_timing from result.perf_data, aggregated by op type
+void set_op_timing(StreamBenchmarkResult& result);
+
+void print_stream_result(std::ostream& out, const StreamBenchmarkResult& result);
+
+/// \brief Write results as JSON, or as CSV when format is "csv". Per-op timings are only
+///        written to JSON.
+void write_results(const std::string& path,
+                   const std::string& format,
+                   const std::vector<StreamBenchmarkResult>& results);
+
+/// \brief Read results written by write_results in JSON format
+std::vector<StreamBenchmarkResult> read_results(const std::string& path);
+
+/// \brief Compare current against baseline, matching results by model and backend.
+///
+/// A throughput drop, latency increase or compile time increase of more than threshold
+/// percent is reported as a regression, as is a per-op time increase for op types that take at
+/// least 1% of the baseline op time.
+/// \return number of regressions found
+size_t compare_results(std::ostream& out,
+                       const std::vector<StreamBenchmarkResult>& baseline,
+                       const std::vector<StreamBenchmarkResult>& current,
+                       double threshold);
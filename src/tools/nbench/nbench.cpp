@@ -28,11 +28,13 @@
 #include "ngraph/except.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
@@ -168,6 +170,110 @@ element::Type get_op_element_type(const Node& op)
     return type;
 }
 
+// Wall-clock time of ConstantFolding and, when a backend is given, of the whole compile for
+// each compile thread pool size. Every measurement starts from a freshly loaded model.
+static void run_compile_scaling(const string& model,
+                                const string& backend,
+                                const vector<size_t>& thread_counts)
+{
+    size_t saved_threads = runtime::ThreadPool::get_compile_thread_count();
+    cout << setw(8) << "threads" << setw(20) << "constant folding ms";
+    if (!backend.empty())
+    {
+        cout << setw(20) << "compile ms";
+    }
+    cout << "\n";
+    for (size_t threads : thread_counts)
+    {
+        runtime::ThreadPool::set_compile_thread_count(threads);
+
+        shared_ptr<Function> f = deserialize(model);
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>();
+        stopwatch timer;
+        timer.start();
+        pass_manager.run_passes(f);
+        timer.stop();
+        cout << setw(8) << threads << setw(20) << timer.get_milliseconds();
+
+        if (!backend.empty())
+        {
+            auto be = runtime::Backend::create(backend);
+            f = deserialize(model);
+            timer.start();
+            auto exec = be->compile(f);
+            timer.stop();
+            cout << setw(20) << timer.get_milliseconds();
+        }
+        cout << endl;
+    }
+    runtime::ThreadPool::set_compile_thread_count(saved_threads);
+}
+
+// Time spent keeping the topological order of a Function current while it is rewritten one op
+// at a time, as pattern matching passes do. Each rewrite replaces an op with a copy of itself.
+// Also times get_ordered_ops after rewrites of another Function, which must not invalidate it.
+static void run_ordered_ops_benchmark(const string& model, size_t rewrites)
+{
+    shared_ptr<Function> f = deserialize(model);
+    shared_ptr<Function> other = deserialize(model);
+    auto rewritable = [](const shared_ptr<Function>& func) {
+        vector<shared_ptr<Node>> ops;
+        for (const shared_ptr<Node>& op : func->get_ordered_ops())
+        {
+            if (!op->is_parameter() && !op->is_output() && op->get_output_size() == 1)
+            {
+                ops.push_back(op);
+            }
+        }
+        return ops;
+    };
+    vector<shared_ptr<Node>> ops = rewritable(f);
+    vector<shared_ptr<Node>> other_ops = rewritable(other);
+    if (ops.empty())
+    {
+        cout << "No ops to rewrite\n";
+        return;
+    }
+    auto rewrite = [](vector<shared_ptr<Node>>& candidates, size_t i) {
+        shared_ptr<Node>& op = candidates[i % candidates.size()];
+        shared_ptr<Node> copy = op->copy_with_new_args(op->get_arguments());
+        replace_node(op, copy);
+        op = copy;
+    };
+
+    stopwatch sort_timer;
+    stopwatch ordered_timer;
+    stopwatch other_timer;
+    for (size_t i = 0; i < rewrites; i++)
+    {
+        rewrite(ops, i);
+        sort_timer.start();
+        topological_sort(f->get_ops());
+        sort_timer.stop();
+
+        rewrite(ops, i + rewrites);
+        ordered_timer.start();
+        f->get_ordered_ops();
+        ordered_timer.stop();
+
+        rewrite(other_ops, i);
+        other_timer.start();
+        f->get_ordered_ops();
+        other_timer.stop();
+    }
+    double count = static_cast<double>(rewrites);
+    cout << "ops: " << f->get_ops().size() << ", rewrites: " << rewrites << "\n";
+    cout << setw(30) << "" << setw(16) << "us per rewrite"
+         << "\n";
+    cout << setw(30) << "full topological sort" << setw(16)
+         << sort_timer.get_total_microseconds() / count << "\n";
+    cout << setw(30) << "get_ordered_ops" << setw(16)
+         << ordered_timer.get_total_microseconds() / count << "\n";
+    cout << setw(30) << "get_ordered_ops, other function" << setw(16)
+         << other_timer.get_total_microseconds() / count << endl;
+}
+
 int main(int argc, char** argv)
 {
     string model_arg;
@@ -181,6 +287,15 @@ int main(int argc, char** argv)
     int warmup_iterations = 1;
     bool copy_data = true;
     bool dot_file = false;
+    size_t streams = 0;
+    double duration = 0;
+    double rate = 0;
+    string output;
+    string output_format;
+    vector<string> compare_files;
+    double threshold = 5;
+    vector<size_t> compile_threads;
+    size_t ordered_ops_rewrites = 0;
 
     for (size_t i = 1; i < argc; i++)
     {
@@ -241,13 +356,102 @@ int main(int argc, char** argv)
                 failed = true;
             }
         }
+        else if (arg == "--streams" || arg == "--duration" || arg == "--rate" ||
+                 arg == "--threshold")
+        {
+            try
+            {
+                double value = stod(argv[++i]);
+                if (value < 0)
+                {
+                    throw invalid_argument(arg);
+                }
+                if (arg == "--streams")
+                {
+                    streams = static_cast<size_t>(value);
+                }
+                else if (arg == "--duration")
+                {
+                    duration = value;
+                }
+                else if (arg == "--rate")
+                {
+                    rate = value;
+                }
+                else
+                {
+                    threshold = value;
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "-o" || arg == "--output")
+        {
+            output = argv[++i];
+        }
+        else if (arg == "--format")
+        {
+            output_format = argv[++i];
+            if (output_format != "json" && output_format != "csv")
+            {
+                cout << "Unknown output format: " << output_format << endl;
+                failed = true;
+            }
+        }
+        else if (arg == "--compile_threads")
+        {
+            try
+            {
+                for (const string& count : split(argv[++i], ','))
+                {
+                    compile_threads.push_back(stoul(count));
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--ordered_ops")
+        {
+            try
+            {
+                ordered_ops_rewrites = stoul(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--compare")
+        {
+            compare_files.push_back(argv[++i]);
+            compare_files.push_back(argv[++i]);
+        }
         else
         {
             cout << "Unknown option: " << arg << endl;
             failed = true;
         }
     }
-    if (!model_arg.empty() && !file_util::exists(model_arg))
+    if (!compare_files.empty())
+    {
+        for (const string& file : compare_files)
+        {
+            if (!file_util::exists(file))
+            {
+                cout << "File " << file << " not found\n";
+                failed = true;
+            }
+        }
+    }
+    else if (!model_arg.empty() && !file_util::exists(model_arg))
     {
         cout << "File " << model_arg << " not found\n";
         failed = true;
@@ -271,6 +475,10 @@ DESCRIPTION
 
 SYNOPSIS
         nbench [-f <filename>] [-b <backend>] [-i <iterations>]
+        nbench -f <filename> -b <backend> --streams <n> [--duration <s>] [--rate <r>] [-o <file>]
+        nbench --compare <baseline.json> <current.json> [--threshold <percent>]
+        nbench -f <filename> [-b <backend>] --compile_threads <list>
+        nbench -f <filename> --ordered_ops <rewrites>
 
 OPTIONS
         -f|--file                 Serialized model file
@@ -283,10 +491,49 @@ OPTIONS
         -w|--warmup_iterations    Number of warm-up iterations
         --no_copy_data            Disable copy of input/result data every iteration
         --dot                     Generate Graphviz dot file
+        --streams                 Number of client threads calling the compiled model concurrently.
+                                  On CPU, NGRAPH_CPU_CONCURRENCY defaults to the stream count.
+        --duration                Run each model for this many seconds instead of -i requests
+                                  per stream
+        --rate                    Target request rate over all streams, in requests per second.
+                                  Latency is measured from the scheduled request time.
+        -o|--output               Write throughput, latency and per-op results to a file
+        --format                  Output format, json or csv (default: from the file extension)
+        --compare                 Compare two JSON result files and report regressions
+        --threshold               Regression threshold in percent for --compare (default: 5)
+        --compile_threads         Comma separated compile thread pool sizes, e.g. 1,2,4,8.
+                                  Reports the time ConstantFolding and, with -b, the whole
+                                  compile take with each.
+        --ordered_ops             Rewrites this many ops one at a time and reports the time
+                                  get_ordered_ops takes to follow, against a full topological
+                                  sort.
 )###";
         return 1;
     }
 
+    if (!compare_files.empty())
+    {
+        try
+        {
+            auto baseline = read_results(compare_files[0]);
+            auto current = read_results(compare_files[1]);
+            return compare_results(cout, baseline, current, threshold) == 0 ? 0 : 1;
+        }
+        catch (exception& e)
+        {
+            cout << "Unable to compare results\n" << e.what() << endl;
+            return 1;
+        }
+    }
+
+    // Throughput and latency are measured when any of the multi-stream options is used
+    bool stream_mode = streams > 0 || duration > 0 || rate > 0 || !output.empty();
+    if (output_format.empty())
+    {
+        string ext = file_util::get_file_ext(output);
+        output_format = (ext == ".csv" ? "csv" : "json");
+    }
+
     vector<string> models;
     if (!directory.empty())
     {
@@ -307,6 +554,7 @@ OPTIONS
     }
 
     vector<PerfShape> aggregate_perf_data;
+    vector<StreamBenchmarkResult> stream_results;
     int rc = 0;
     for (const string& model : models)
     {
@@ -416,12 +664,42 @@ OPTIONS
                 }
             }
 
-            if (!backend.empty())
+            if (ordered_ops_rewrites > 0)
+            {
+                cout << "\n---- Ordered Ops Repair ----\n";
+                run_ordered_ops_benchmark(model, ordered_ops_rewrites);
+            }
+            else if (!compile_threads.empty())
+            {
+                cout << "\n---- Compile Time Scaling ----\n";
+                run_compile_scaling(model, backend, compile_threads);
+            }
+            else if (!backend.empty())
             {
                 cout << "\n---- Benchmark ----\n";
                 shared_ptr<Function> f = deserialize(model);
-                auto perf_data = run_benchmark(
-                    f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                vector<runtime::PerformanceCounter> perf_data;
+                if (stream_mode)
+                {
+                    StreamBenchmarkResult result = run_stream_benchmark(f,
+                                                                        backend,
+                                                                        streams,
+                                                                        duration,
+                                                                        rate,
+                                                                        iterations,
+                                                                        timing_detail,
+                                                                        warmup_iterations,
+                                                                        copy_data);
+                    result.model = model;
+                    print_stream_result(cout, result);
+                    perf_data = result.perf_data;
+                    stream_results.push_back(result);
+                }
+                else
+                {
+                    perf_data = run_benchmark(
+                        f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                }
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
                     aggregate_perf_data.end(), perf_shape.begin(), perf_shape.end());
@@ -449,5 +727,18 @@ OPTIONS
         print_results(aggregate_perf_data, timing_detail);
     }
 
+    if (!output.empty())
+    {
+        try
+        {
+            write_results(output, output_format, stream_results);
+        }
+        catch (exception& e)
+        {
+            cout << e.what() << endl;
+            rc += 1;
+        }
+    }
+
     return rc;
 }
@@ -0,0 +1,855 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// tool to measure single-op kernel performance over shapes, element types and backends.
+//     op_bench -b CPU,GCPU,INTERPRETER -t f32,f64
+//     op_bench --filter "Dot|Convolution" --format json -o ops.json
+// regression check of two JSON result files, e.g. from nightly runs:
+//     op_bench --compare baseline.json ops.json --threshold 10
+// thread count sweeps run one process per count since the CPU backend reads it once:
+//     for t in 1 2 4 8; do op_bench -b CPU --threads $t -o ops_$t.json; done
+// the Dot->Add->Relu->Dot chain compares MLIR's fused loop nests to direct execution:
+//     op_bench -b CPU --filter DotAddReluDot; NGRAPH_MLIR=1 op_bench -b CPU --filter DotAddReluDot
+
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/util.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace ngraph;
+using json = nlohmann::json;
+
+void help()
+{
+    cout << R"###(
+DESCRIPTION
+    Benchmark single-op Functions for a sweep of shapes and element types on each backend.
+    Each Function is compiled once and called until --min_time has elapsed. Reports time
+    per call, GFLOP/s and GB/s (minimum bytes read and written), and the fraction of the
+    machine peak reached by the closer of the two (roofline).
+
+SYNOPSIS
+        op_bench [-b|--backends <list>] [-t|--types <list>] [--filter <regex>]
+                 [--threads <count>] [--min_time <seconds>] [--format console|json|csv]
+                 [-o|--output <file>] [--peak_gflops <value>] [--peak_gbps <value>]
+        op_bench --compare <baseline.json> <current.json> [--threshold <percent>]
+
+OPTIONS
+        -b or --backends   comma separated backends (default CPU,GCPU,INTERPRETER; backends
+                           that are not available are skipped)
+        -t or --types      comma separated element types (default f32)
+        --filter           only run benchmarks whose name matches this regular expression
+        --threads          sets OMP_NUM_THREADS and NGRAPH_INTRA_OP_PARALLELISM for the CPU
+                           backend (default: the environment, else all hardware threads)
+        --min_time         minimum timed seconds per benchmark (default 0.5)
+        --format           report format (default console)
+        -o or --output     write the report to a file instead of stdout
+        --peak_gflops      machine peak GFLOP/s for the thread count; measured with a
+                           multiply-add loop if not given
+        --peak_gbps        machine peak memory GB/s for the thread count; measured with a
+                           large copy if not given
+        --compare          compare the real_time of two JSON reports
+        --threshold        slowdown in percent reported as a regression (default 5)
+)###";
+}
+
+struct BenchOptions
+{
+    vector<string> backends{"CPU", "GCPU", "INTERPRETER"};
+    vector<string> types{"f32"};
+    string filter;
+    size_t threads = 0;
+    double min_time = 0.5;
+    string format = "console";
+    string output;
+    double peak_gflops = 0;
+    double peak_gbps = 0;
+    vector<string> compare_files;
+    double threshold = 5;
+};
+
+/// \brief One benchmark: a single-op Function and its nominal work per call
+struct OpCase
+{
+    string op;
+    string shape;
+    double flops;
+    // elements read and written per call, scaled by the element size for GB/s
+    double elements;
+    bool float_only;
+    function<shared_ptr<Function>(const element::Type&)> build;
+};
+
+struct BenchResult
+{
+    string name;
+    string op;
+    string shape;
+    string element_type;
+    string backend;
+    size_t iterations = 0;
+    double time_us = 0;
+    double compile_ms = 0;
+    double gflops = 0;
+    double gbps = 0;
+    double peak_pct = 0;
+    string error;
+};
+
+struct Peak
+{
+    double gflops;
+    double gbps;
+};
+
+static string shape_name(const vector<size_t>& dims)
+{
+    return join(dims, "x");
+}
+
+static shared_ptr<op::Parameter> parameter(const element::Type& et, const Shape& shape)
+{
+    return make_shared<op::Parameter>(et, shape);
+}
+
+static OpCase make_case(const string& op,
+                        const string& shape,
+                        double flops,
+                        double elements,
+                        bool float_only,
+                        function<shared_ptr<Node>(const ParameterVector&)> make_op,
+                        const vector<Shape>& arg_shapes)
+{
+    OpCase c;
+    c.op = op;
+    c.shape = shape;
+    c.flops = flops;
+    c.elements = elements;
+    c.float_only = float_only;
+    c.build = [make_op, arg_shapes](const element::Type& et) {
+        ParameterVector params;
+        for (const Shape& shape : arg_shapes)
+        {
+            params.push_back(parameter(et, shape));
+        }
+        return make_shared<Function>(make_op(params), params);
+    };
+    return c;
+}
+
+static vector<OpCase> make_cases()
+{
+    vector<OpCase> cases;
+
+    for (size_t n : {1 << 12, 1 << 16, 1 << 20, 1 << 22})
+    {
+        cases.push_back(make_case("Add",
+                                  to_string(n),
+                                  n,
+                                  3.0 * n,
+                                  false,
+                                  [](const ParameterVector& p) {
+                                      return make_shared<op::Add>(p[0], p[1]);
+                                  },
+                                  {Shape{n}, Shape{n}}));
+    }
+    for (size_t n : {1 << 12, 1 << 16, 1 << 20, 1 << 22})
+    {
+        cases.push_back(make_case("Relu",
+                                  to_string(n),
+                                  n,
+                                  2.0 * n,
+                                  false,
+                                  [](const ParameterVector& p) {
+                                      return make_shared<op::Relu>(p[0]);
+                                  },
+                                  {Shape{n}}));
+    }
+
+    // {m, k, n}
+    for (vector<size_t> mkn : vector<vector<size_t>>{
+             {64, 64, 64}, {256, 256, 256}, {512, 512, 512}, {1, 1024, 1024}, {1024, 64, 1024}})
+    {
+        size_t m = mkn[0];
+        size_t k = mkn[1];
+        size_t n = mkn[2];
+        cases.push_back(make_case("Dot",
+                                  shape_name(mkn),
+                                  2.0 * m * k * n,
+                                  double(m * k + k * n + m * n),
+                                  false,
+                                  [](const ParameterVector& p) {
+                                      return make_shared<op::Dot>(p[0], p[1]);
+                                  },
+                                  {Shape{m, k}, Shape{k, n}}));
+    }
+
+    for (size_t n : {256, 512})
+    {
+        cases.push_back(make_case("DotAddReluDot",
+                                  shape_name({n, n}),
+                                  4.0 * n * n * n + 2.0 * n * n,
+                                  5.0 * n * n,
+                                  false,
+                                  [](const ParameterVector& p) {
+                                      auto hidden =
+                                          make_shared<op::Relu>(make_shared<op::Dot>(p[0], p[1]) +
+                                                                p[2]);
+                                      return make_shared<op::Dot>(hidden, p[3]);
+                                  },
+                                  {Shape{n, n}, Shape{n, n}, Shape{n, n}, Shape{n, n}}));
+    }
+
+    // {batch, channels, height, width, filters, kernel, stride, padding}
+    for (vector<size_t> conv : vector<vector<size_t>>{{1, 64, 56, 56, 64, 3, 1, 1},
+                                                      {1, 256, 56, 56, 64, 1, 1, 0},
+                                                      {1, 256, 14, 14, 256, 3, 1, 1},
+                                                      {1, 3, 224, 224, 64, 7, 2, 3}})
+    {
+        size_t batch = conv[0];
+        size_t channels = conv[1];
+        size_t height = conv[2];
+        size_t width = conv[3];
+        size_t filters = conv[4];
+        size_t kernel = conv[5];
+        size_t stride = conv[6];
+        ptrdiff_t padding = static_cast<ptrdiff_t>(conv[7]);
+        size_t out_height = (height + 2 * padding - kernel) / stride + 1;
+        size_t out_width = (width + 2 * padding - kernel) / stride + 1;
+        double inputs = double(batch) * channels * height * width;
+        double weights = double(filters) * channels * kernel * kernel;
+        double outputs = double(batch) * filters * out_height * out_width;
+        cases.push_back(make_case(
+            "Convolution",
+            shape_name(conv),
+            2.0 * outputs * channels * kernel * kernel,
+            inputs + weights + outputs,
+            true,
+            [stride, padding](const ParameterVector& p) {
+                return make_shared<op::Convolution>(p[0],
+                                                    p[1],
+                                                    Strides{stride, stride},
+                                                    Strides{1, 1},
+                                                    CoordinateDiff{padding, padding},
+                                                    CoordinateDiff{padding, padding});
+            },
+            {Shape{batch, channels, height, width}, Shape{filters, channels, kernel, kernel}}));
+    }
+
+    for (vector<size_t> dims : vector<vector<size_t>>{{64, 1000}, {256, 4096}})
+    {
+        size_t n = dims[0] * dims[1];
+        // max, subtract and exp, sum, divide
+        cases.push_back(make_case("Softmax",
+                                  shape_name(dims),
+                                  4.0 * n,
+                                  2.0 * n,
+                                  true,
+                                  [](const ParameterVector& p) {
+                                      return make_shared<op::Softmax>(p[0], AxisSet{1});
+                                  },
+                                  {Shape(dims)}));
+    }
+
+    // {rows, columns, reduction axis}
+    for (vector<size_t> sum :
+         vector<vector<size_t>>{{1024, 1024, 0}, {1024, 1024, 1}, {1, 1 << 22, 1}})
+    {
+        size_t axis = sum[2];
+        double n = double(sum[0]) * sum[1];
+        cases.push_back(make_case("Sum",
+                                  shape_name(sum),
+                                  n,
+                                  n + sum[1 - axis],
+                                  false,
+                                  [axis](const ParameterVector& p) {
+                                      return make_shared<op::Sum>(p[0], AxisSet{axis});
+                                  },
+                                  {Shape{sum[0], sum[1]}}));
+    }
+
+    // {batch, channels, height, width, window, stride}
+    for (vector<size_t> pool :
+         vector<vector<size_t>>{{1, 64, 112, 112, 3, 2}, {8, 256, 28, 28, 2, 2}})
+    {
+        size_t window = pool[4];
+        size_t stride = pool[5];
+        Shape shape{pool[0], pool[1], pool[2], pool[3]};
+        double outputs = double(pool[0]) * pool[1] * ((pool[2] - window) / stride + 1) *
+                         ((pool[3] - window) / stride + 1);
+        cases.push_back(make_case("MaxPool",
+                                  shape_name(pool),
+                                  outputs * window * window,
+                                  shape_size(shape) + outputs,
+                                  false,
+                                  [window, stride](const ParameterVector& p) {
+                                      return make_shared<op::MaxPool>(
+                                          p[0], Shape{window, window}, Strides{stride, stride});
+                                  },
+                                  {shape}));
+    }
+    return cases;
+}
+
+// Multiply-add chains that are independent of each other so the compiler can keep every
+// floating point pipeline busy. This relies on the release build vectorizing the inner loop
+// for the target architecture; use --peak_gflops for the datasheet value.
+static float multiply_add_loop(size_t repeats)
+{
+    const size_t chains = 32;
+    float acc[chains];
+    for (size_t i = 0; i < chains; i++)
+    {
+        acc[i] = static_cast<float>(i);
+    }
+    for (size_t r = 0; r < repeats; r++)
+    {
+        for (size_t i = 0; i < chains; i++)
+        {
+            acc[i] = acc[i] * 0.999999f + 0.000001f;
+        }
+    }
+    float sum = 0;
+    for (size_t i = 0; i < chains; i++)
+    {
+        sum += acc[i];
+    }
+    return sum;
+}
+
+// Runs body(thread index) on threads concurrently and returns the elapsed seconds
+static double time_threads(size_t threads, const function<void(size_t)>& body)
+{
+    stopwatch timer;
+    timer.start();
+    vector<thread> workers;
+    for (size_t t = 0; t < threads; t++)
+    {
+        workers.push_back(thread(body, t));
+    }
+    for (thread& worker : workers)
+    {
+        worker.join();
+    }
+    timer.stop();
+    return timer.get_microseconds() * 1e-6;
+}
+
+static Peak measure_peak(size_t threads)
+{
+    Peak peak;
+
+    const size_t repeats = 1 << 22;
+    vector<float> sink(threads);
+    double seconds = time_threads(
+        threads, [&](size_t t) { sink[t] = multiply_add_loop(repeats); });
+    peak.gflops = threads * repeats * 32 * 2 / seconds * 1e-9;
+
+    // 64 MB per thread is well beyond the last-level cache
+    const size_t count = (size_t(64) << 20) / sizeof(float);
+    vector<vector<float>> src(threads, vector<float>(count, 1.0f));
+    vector<vector<float>> dst(threads, vector<float>(count, 0.0f));
+    double best = 0;
+    for (size_t i = 0; i < 3; i++)
+    {
+        seconds = time_threads(
+            threads, [&](size_t t) { copy(src[t].begin(), src[t].end(), dst[t].begin()); });
+        best = max(best, threads * 2.0 * count * sizeof(float) / seconds * 1e-9);
+    }
+    peak.gbps = best;
+    return peak;
+}
+
+static vector<string> split_list(const string& list)
+{
+    vector<string> items;
+    for (const string& item : split(list, ',', true))
+    {
+        if (!item.empty())
+        {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+static element::Type to_element_type(const string& name)
+{
+    for (const element::Type& et : {element::f32,
+                                    element::f64,
+                                    element::bf16,
+                                    element::i8,
+                                    element::i16,
+                                    element::i32,
+                                    element::i64,
+                                    element::u8})
+    {
+        if (et.get_type_name() == name)
+        {
+            return et;
+        }
+    }
+    throw runtime_error("Unsupported element type '" + name + "'");
+}
+
+static string benchmark_name(const OpCase& c,
+                             const element::Type& et,
+                             const string& backend_name)
+{
+    return c.op + "/" + c.shape + "/" + et.get_type_name() + "/" + backend_name;
+}
+
+static BenchResult run_case(runtime::Backend& backend,
+                            const string& backend_name,
+                            const OpCase& c,
+                            const element::Type& et,
+                            const Peak& peak,
+                            double min_time)
+{
+    BenchResult result;
+    result.op = c.op;
+    result.shape = c.shape;
+    result.element_type = et.get_type_name();
+    result.backend = backend_name;
+    result.name = benchmark_name(c, et, backend_name);
+    try
+    {
+        shared_ptr<Function> f = c.build(et);
+        stopwatch compile_timer;
+        compile_timer.start();
+        auto exec = backend.compile(f);
+        compile_timer.stop();
+        result.compile_ms = compile_timer.get_microseconds() / 1000.0;
+
+        // Every byte 0x3c gives small positive values for float and integer types alike
+        vector<shared_ptr<runtime::Tensor>> args;
+        for (const shared_ptr<op::Parameter>& param : f->get_parameters())
+        {
+            auto tensor = backend.create_tensor(param->get_element_type(), param->get_shape());
+            size_t bytes = shape_size(param->get_shape()) * param->get_element_type().size();
+            vector<char> data(bytes, 0x3c);
+            tensor->write(data.data(), bytes);
+            args.push_back(tensor);
+        }
+        vector<shared_ptr<runtime::Tensor>> results;
+        for (const shared_ptr<op::Result>& r : f->get_results())
+        {
+            results.push_back(backend.create_tensor(r->get_element_type(), r->get_shape()));
+        }
+
+        // Grow the iteration count until one batch takes min_time, as Google Benchmark does
+        exec->call(results, args);
+        size_t iterations = 1;
+        double seconds = 0;
+        while (true)
+        {
+            stopwatch timer;
+            timer.start();
+            for (size_t i = 0; i < iterations; i++)
+            {
+                exec->call(results, args);
+            }
+            timer.stop();
+            seconds = timer.get_microseconds() * 1e-6;
+            if (seconds >= min_time)
+            {
+                break;
+            }
+            double multiplier = seconds > 0 ? min_time * 1.4 / seconds : 10;
+            iterations = static_cast<size_t>(iterations * min(max(multiplier, 2.0), 10.0));
+        }
+        result.iterations = iterations;
+        result.time_us = seconds * 1e6 / iterations;
+        result.gflops = c.flops / result.time_us * 1e-3;
+        result.gbps = c.elements * et.size() / result.time_us * 1e-3;
+        result.peak_pct =
+            100 * max(peak.gflops > 0 ? result.gflops / peak.gflops : 0,
+                      peak.gbps > 0 ? result.gbps / peak.gbps : 0);
+    }
+    catch (const exception& e)
+    {
+        result.error = e.what();
+    }
+    return result;
+}
+
+static void write_console(ostream& out, const vector<BenchResult>& results)
+{
+    size_t name_width = 10;
+    for (const BenchResult& r : results)
+    {
+        name_width = max(name_width, r.name.size());
+    }
+    string line(name_width + 58, '-');
+    out << line << "\n"
+        << left << setw(name_width) << "Benchmark" << right << setw(14) << "Time"
+        << setw(12) << "Iterations" << setw(10) << "GFLOP/s" << setw(10) << "GB/s" << setw(10)
+        << "%peak"
+        << "\n"
+        << line << "\n";
+    for (const BenchResult& r : results)
+    {
+        out << left << setw(name_width) << r.name << right;
+        if (!r.error.empty())
+        {
+            out << "  ERROR OCCURRED: '" << r.error << "'\n";
+            continue;
+        }
+        ostringstream time;
+        time << fixed << setprecision(r.time_us < 10 ? 2 : 0) << r.time_us << " us";
+        out << setw(14) << time.str() << setw(12) << r.iterations << fixed << setprecision(2)
+            << setw(10) << r.gflops << setw(10) << r.gbps << setprecision(1) << setw(10)
+            << r.peak_pct << defaultfloat << setprecision(6) << "\n";
+    }
+}
+
+static void write_csv(ostream& out, const vector<BenchResult>& results)
+{
+    out << "name,op,shape,element_type,backend,iterations,real_time_us,compile_ms,GFLOPS,GBPS,"
+           "peak_pct,error\n";
+    for (const BenchResult& r : results)
+    {
+        out << r.name << "," << r.op << "," << r.shape << "," << r.element_type << ","
+            << r.backend << "," << r.iterations << "," << r.time_us << "," << r.compile_ms << ","
+            << r.gflops << "," << r.gbps << "," << r.peak_pct << ",\"" << r.error << "\"\n";
+    }
+}
+
+static void write_json(ostream& out,
+                       const vector<BenchResult>& results,
+                       size_t threads,
+                       const Peak& peak,
+                       const Peak& thread_peak)
+{
+    json j;
+    time_t now = time(nullptr);
+    char date[64];
+    strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", localtime(&now));
+    j["context"] = {{"date", date},
+                    {"num_cpus", thread::hardware_concurrency()},
+                    {"threads", threads},
+                    {"peak_gflops", peak.gflops},
+                    {"peak_gbps", peak.gbps},
+                    {"single_thread_peak_gflops", thread_peak.gflops},
+                    {"single_thread_peak_gbps", thread_peak.gbps}};
+    json benchmarks = json::array();
+    for (const BenchResult& r : results)
+    {
+        json b = {{"name", r.name},
+                  {"op", r.op},
+                  {"shape", r.shape},
+                  {"element_type", r.element_type},
+                  {"backend", r.backend}};
+        if (!r.error.empty())
+        {
+            b["error_occurred"] = true;
+            b["error_message"] = r.error;
+        }
+        else
+        {
+            b["iterations"] = r.iterations;
+            b["real_time"] = r.time_us;
+            b["time_unit"] = "us";
+            b["compile_ms"] = r.compile_ms;
+            b["GFLOPS"] = r.gflops;
+            b["GBPS"] = r.gbps;
+            b["peak_pct"] = r.peak_pct;
+        }
+        benchmarks.push_back(b);
+    }
+    j["benchmarks"] = benchmarks;
+    out << setw(4) << j << endl;
+}
+
+static json read_json(const string& path)
+{
+    ifstream in(path);
+    if (!in)
+    {
+        throw runtime_error("Unable to open '" + path + "'");
+    }
+    json j;
+    in >> j;
+    return j;
+}
+
+// Returns the number of benchmarks whose time grew by more than threshold percent
+static size_t compare(const string& baseline_file, const string& current_file, double threshold)
+{
+    json baseline = read_json(baseline_file);
+    json current = read_json(current_file);
+    map<string, double> baseline_times;
+    for (const json& b : baseline.at("benchmarks"))
+    {
+        if (b.count("real_time") != 0)
+        {
+            baseline_times[b.at("name").get<string>()] = b.at("real_time").get<double>();
+        }
+    }
+    size_t regressions = 0;
+    cout << left << setw(48) << "Benchmark" << right << setw(14) << "Baseline" << setw(14)
+         << "Current" << setw(10) << "Change"
+         << "\n";
+    for (const json& b : current.at("benchmarks"))
+    {
+        string name = b.at("name").get<string>();
+        auto base = baseline_times.find(name);
+        if (b.count("real_time") == 0 || base == baseline_times.end())
+        {
+            continue;
+        }
+        double time = b.at("real_time").get<double>();
+        double change = base->second > 0 ? (time - base->second) * 100 / base->second : 0;
+        bool regression = change > threshold;
+        regressions += regression ? 1 : 0;
+        cout << left << setw(48) << name << right << fixed << setprecision(2) << setw(14)
+             << base->second << setw(14) << time << setprecision(1) << showpos << setw(9)
+             << change << "%" << noshowpos << defaultfloat << setprecision(6)
+             << (regression ? "  REGRESSION" : "") << "\n";
+    }
+    cout << regressions << " regression(s) beyond " << threshold << "%\n";
+    return regressions;
+}
+
+static void set_env(const string& name, const string& value)
+{
+#ifdef _WIN32
+    _putenv_s(name.c_str(), value.c_str());
+#else
+    setenv(name.c_str(), value.c_str(), 1);
+#endif
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    bool failed = false;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        try
+        {
+            if ((arg == "-b" || arg == "--backends") && has_value)
+            {
+                options.backends = split_list(argv[++i]);
+            }
+            else if ((arg == "-t" || arg == "--types") && has_value)
+            {
+                options.types = split_list(argv[++i]);
+            }
+            else if (arg == "--filter" && has_value)
+            {
+                options.filter = argv[++i];
+            }
+            else if (arg == "--threads" && has_value)
+            {
+                options.threads = stoul(argv[++i]);
+            }
+            else if (arg == "--min_time" && has_value)
+            {
+                options.min_time = stod(argv[++i]);
+            }
+            else if (arg == "--format" && has_value)
+            {
+                options.format = argv[++i];
+                failed = failed || (options.format != "console" && options.format != "json" &&
+                                    options.format != "csv");
+            }
+            else if ((arg == "-o" || arg == "--output") && has_value)
+            {
+                options.output = argv[++i];
+            }
+            else if (arg == "--peak_gflops" && has_value)
+            {
+                options.peak_gflops = stod(argv[++i]);
+            }
+            else if (arg == "--peak_gbps" && has_value)
+            {
+                options.peak_gbps = stod(argv[++i]);
+            }
+            else if (arg == "--compare" && i + 2 < argc)
+            {
+                options.compare_files.push_back(argv[++i]);
+                options.compare_files.push_back(argv[++i]);
+            }
+            else if (arg == "--threshold" && has_value)
+            {
+                options.threshold = stod(argv[++i]);
+            }
+            else
+            {
+                cout << "Unknown option: " << arg << endl;
+                failed = true;
+            }
+        }
+        catch (...)
+        {
+            cout << "Invalid value for " << arg << endl;
+            failed = true;
+        }
+    }
+    if (failed)
+    {
+        help();
+        return 1;
+    }
+
+    if (!options.compare_files.empty())
+    {
+        try
+        {
+            return compare(options.compare_files[0], options.compare_files[1], options.threshold)
+                       ? 1
+                       : 0;
+        }
+        catch (const exception& e)
+        {
+            cout << "Unable to compare results\n" << e.what() << endl;
+            return 1;
+        }
+    }
+
+    // The CPU backend reads its thread counts when its first executable is created
+    if (options.threads > 0)
+    {
+        set_env("OMP_NUM_THREADS", to_string(options.threads));
+        set_env("NGRAPH_INTRA_OP_PARALLELISM", to_string(options.threads));
+    }
+    size_t threads = options.threads;
+    if (threads == 0)
+    {
+        const char* omp_num_threads = getenv("OMP_NUM_THREADS");
+        threads = omp_num_threads != nullptr ? max(atoi(omp_num_threads), 1)
+                                             : max<unsigned>(thread::hardware_concurrency(), 1);
+    }
+
+    // The CPU and GCPU backends run kernels on several threads, the others are compared
+    // against the single thread peak
+    Peak peak = measure_peak(threads);
+    Peak thread_peak = threads == 1 ? peak : measure_peak(1);
+    if (options.peak_gflops > 0 || options.peak_gbps > 0)
+    {
+        double gflops_scale = options.peak_gflops > 0 ? options.peak_gflops / peak.gflops : 1;
+        double gbps_scale = options.peak_gbps > 0 ? options.peak_gbps / peak.gbps : 1;
+        peak.gflops *= gflops_scale;
+        peak.gbps *= gbps_scale;
+        thread_peak.gflops *= gflops_scale;
+        thread_peak.gbps *= gbps_scale;
+    }
+    if (options.format == "console")
+    {
+        cout << "Run on " << thread::hardware_concurrency() << " hardware threads, " << threads
+             << " kernel threads\n"
+             << "Peak " << peak.gflops << " GFLOP/s, " << peak.gbps << " GB/s ("
+             << thread_peak.gflops << " GFLOP/s, " << thread_peak.gbps
+             << " GB/s single thread)\n";
+    }
+
+    vector<element::Type> types;
+    for (const string& type : options.types)
+    {
+        try
+        {
+            types.push_back(to_element_type(type));
+        }
+        catch (const exception& e)
+        {
+            cout << e.what() << endl;
+            return 1;
+        }
+    }
+
+    regex filter(options.filter.empty() ? ".*" : options.filter);
+    vector<OpCase> cases = make_cases();
+    vector<BenchResult> results;
+    for (const string& backend_name : options.backends)
+    {
+        shared_ptr<runtime::Backend> backend;
+        try
+        {
+            backend = runtime::Backend::create(backend_name);
+        }
+        catch (const exception& e)
+        {
+            cerr << "Skipping backend " << backend_name << ": " << e.what() << endl;
+            continue;
+        }
+        const Peak& backend_peak =
+            backend_name == "CPU" || backend_name == "GCPU" ? peak : thread_peak;
+        for (const OpCase& c : cases)
+        {
+            for (const element::Type& et : types)
+            {
+                if ((c.float_only && !et.is_real()) ||
+                    !regex_search(benchmark_name(c, et, backend_name), filter))
+                {
+                    continue;
+                }
+                results.push_back(
+                    run_case(*backend, backend_name, c, et, backend_peak, options.min_time));
+                if (options.format == "console" && options.output.empty())
+                {
+                    cerr << "." << flush;
+                }
+            }
+        }
+    }
+    if (options.format == "console" && options.output.empty())
+    {
+        cerr << endl;
+    }
+
+    ofstream file;
+    if (!options.output.empty())
+    {
+        file.open(options.output);
+        if (!file)
+        {
+            cout << "Unable to open '" << options.output << "' for writing\n";
+            return 1;
+        }
+    }
+    ostream& out = options.output.empty() ? cout : file;
+    if (options.format == "json")
+    {
+        write_json(out, results, threads, peak, thread_peak);
+    }
+    else if (options.format == "csv")
+    {
+        write_csv(out, results);
+    }
+    else
+    {
+        write_console(out, results);
+    }
+    return 0;
+}
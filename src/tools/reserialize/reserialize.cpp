@@ -21,8 +21,13 @@
 // sample models are under ../../test/models
 
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "ngraph/pass/constant_to_broadcast.hpp"
 #include "ngraph/pass/manager.hpp"
@@ -41,17 +46,64 @@ SYNOPSIS
         reserialize [-i|--input <input file>] [-o|--output <output file>]
 
 OPTIONS
-        -i or --input  input serialized model
+        -i or --input  input serialized model, json or binary
         -o or --output output serialized model
+        -b or --binary Write the output model in the binary format
         -c or --constant_to_broacast Convert large constant constants to broadcast
+        --benchmark    Compare the load time and peak memory of the json and binary formats
 )###";
 }
 
+// Peak resident memory, in KB, of a child process that runs f
+static long peak_memory_kb(const function<void()>& f)
+{
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        f();
+        _exit(0);
+    }
+    int status;
+    struct rusage usage;
+    wait4(pid, &status, 0, &usage);
+    return usage.ru_maxrss;
+}
+
+static void benchmark(shared_ptr<ngraph::Function> function)
+{
+    stringstream json_data;
+    ngraph::serialize(json_data, function);
+    stringstream binary_data;
+    ngraph::serialize_binary(binary_data, function);
+    vector<pair<string, string>> formats{{"json", json_data.str()}, {"binary", binary_data.str()}};
+
+    // Memory is measured before anything is deserialized in this process, from a child process
+    // that does nothing
+    long baseline_kb = peak_memory_kb([]() {});
+    vector<long> peak_kb;
+    for (auto& format : formats)
+    {
+        peak_kb.push_back(peak_memory_kb([&]() { ngraph::deserialize(format.second); }));
+    }
+    for (size_t i = 0; i < formats.size(); i++)
+    {
+        ngraph::stopwatch timer;
+        timer.start();
+        ngraph::deserialize(formats[i].second);
+        timer.stop();
+        cout << formats[i].first << ": " << formats[i].second.size() << " bytes, deserialize took "
+             << timer.get_milliseconds() << "ms, peak memory " << peak_kb[i] - baseline_kb
+             << "KB\n";
+    }
+}
+
 int main(int argc, char** argv)
 {
     string input;
     string output;
     bool c2b = false;
+    bool binary = false;
+    bool run_benchmark = false;
     for (size_t i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -67,6 +119,14 @@ int main(int argc, char** argv)
         {
             c2b = true;
         }
+        else if (arg == "-b" || arg == "--binary")
+        {
+            binary = true;
+        }
+        else if (arg == "--benchmark")
+        {
+            run_benchmark = true;
+        }
         else if (arg == "-h" || arg == "--help")
         {
             help();
@@ -81,14 +141,14 @@ int main(int argc, char** argv)
         return 1;
     }
 
-    if (output.empty())
+    if (output.empty() && !run_benchmark)
     {
         cout << "output file missing\n";
         help();
         return 1;
     }
 
-    ifstream f(input);
+    ifstream f(input, ios_base::binary | ios_base::in);
     if (f)
     {
         ngraph::stopwatch timer;
@@ -104,10 +164,25 @@ int main(int argc, char** argv)
             pass_manager.run_passes(function);
         }
 
-        timer.start();
-        ngraph::serialize(output, function, 2);
-        timer.stop();
-        cout << "serialize took   " << timer.get_milliseconds() << "ms\n";
+        if (run_benchmark)
+        {
+            benchmark(function);
+        }
+
+        if (!output.empty())
+        {
+            timer.start();
+            if (binary)
+            {
+                ngraph::serialize_binary(output, function);
+            }
+            else
+            {
+                ngraph::serialize(output, function, 2);
+            }
+            timer.stop();
+            cout << "serialize took   " << timer.get_milliseconds() << "ms\n";
+        }
     }
     else
     {
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static size_t bucket(shared_ptr<Function> f, size_t bucket_bytes)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(bucket_bytes);
+    pass_manager.run_passes(f);
+    return count_ops_of_type<op::AllReduce>(f);
+}
+
+TEST(allreduce_bucketing, packs_gradients_of_any_rank)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{});
+    auto D = make_shared<op::Parameter>(element::f32, Shape{5, 1});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::AllReduce>(A),
+                                              make_shared<op::AllReduce>(B),
+                                              make_shared<op::AllReduce>(C),
+                                              make_shared<op::AllReduce>(D)},
+                                   ParameterVector{A, B, C, D});
+
+    EXPECT_EQ(bucket(f, 1 << 20), 1);
+    EXPECT_EQ(count_ops_of_type<op::Concat>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Slice>(f), 4);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{2, 3}));
+    EXPECT_EQ(f->get_output_shape(1), (Shape{4}));
+    EXPECT_EQ(f->get_output_shape(2), (Shape{}));
+    EXPECT_EQ(f->get_output_shape(3), (Shape{5, 1}));
+}
+
+TEST(allreduce_bucketing, respects_bucket_size_and_reduction)
+{
+    Shape shape{100};
+    ParameterVector params;
+    NodeVector results;
+    for (size_t i = 0; i < 5; i++)
+    {
+        params.push_back(make_shared<op::Parameter>(element::f32, shape));
+        results.push_back(make_shared<op::AllReduce>(params.back()));
+    }
+    // Different reductions and element types are never packed together
+    params.push_back(make_shared<op::Parameter>(element::f32, shape));
+    results.push_back(make_shared<op::AllReduce>(params.back(), reduction::Type::MAX));
+    params.push_back(make_shared<op::Parameter>(element::f64, shape));
+    results.push_back(make_shared<op::AllReduce>(params.back()));
+    auto f = make_shared<Function>(results, params);
+
+    // Two 400-byte gradients fit in each 1000-byte bucket
+    EXPECT_EQ(bucket(f, 1000), 5);
+    EXPECT_EQ(count_ops_of_type<op::Concat>(f), 2);
+}
+
+TEST(allreduce_bucketing, dependent_allreduce_starts_new_bucket)
+{
+    Shape shape{8};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto first = make_shared<op::AllReduce>(A);
+    auto second = make_shared<op::AllReduce>(first + B);
+    auto third = make_shared<op::AllReduce>(B * B);
+    auto f = make_shared<Function>(NodeVector{first, second, third}, ParameterVector{A, B});
+
+    // second consumes first's result, so they cannot share one AllReduce
+    EXPECT_EQ(bucket(f, 1 << 20), 2);
+    EXPECT_EQ(count_ops_of_type<op::Concat>(f), 1);
+}
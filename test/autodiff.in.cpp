@@ -1788,6 +1788,89 @@ NGRAPH_TEST(${BACKEND_NAME}, backwards_reverse_sequence_n4d2c3h2w2)
     ASSERT_EQ(read_vector<int>(da), expected);
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, backwards_embedding_lookup_sparse)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    Shape weights_shape{5, 2};
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{2, 2});
+    auto weights = make_shared<op::Parameter>(element::f32, weights_shape);
+    auto lookup = make_shared<op::EmbeddingLookup>(indices, weights);
+    auto C = make_shared<op::Parameter>(element::f32, Shape{2, 2, 2});
+    autodiff::Adjoints adjoints(NodeVector{lookup}, NodeVector{C});
+
+    // Applying the sparse gradient only touches the rows that were looked up, so no
+    // table-sized zero tensor is materialized
+    auto sparse = adjoints.backprop_sparse_node(weights);
+    auto update = make_shared<op::ScatterAdd>(
+        weights, sparse.first, make_shared<op::Negative>(sparse.second));
+    auto update_f = make_shared<Function>(update, ParameterVector{indices, weights, C});
+    EXPECT_EQ(count_ops_of_type<op::BroadcastLike>(update_f), 0);
+
+    auto dense_f = make_shared<Function>(adjoints.backprop_node(weights),
+                                         ParameterVector{indices, weights, C});
+
+    auto i = backend->create_tensor(element::i32, Shape{2, 2});
+    copy_data(i, vector<int32_t>{3, 1, 3, 0});
+    auto w = backend->create_tensor(element::f32, weights_shape);
+    copy_data(w, vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    auto c = backend->create_tensor(element::f32, Shape{2, 2, 2});
+    copy_data(c, vector<float>{1, 2, 3, 4, 5, 6, 7, 8});
+    auto result = backend->create_tensor(element::f32, weights_shape);
+
+    auto dense_handle = backend->compile(dense_f);
+    dense_handle->call_with_validate({result}, {i, w, c});
+    EXPECT_EQ((vector<float>{7, 8, 3, 4, 0, 0, 6, 8, 0, 0}), read_vector<float>(result));
+
+    auto update_handle = backend->compile(update_f);
+    update_handle->call_with_validate({result}, {i, w, c});
+    EXPECT_EQ((vector<float>{-7, -7, -1, -1, 4, 5, 0, -1, 8, 9}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, backwards_gather_sparse_mixed_indices)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    Shape params_shape{4, 3};
+    auto params = make_shared<op::Parameter>(element::f32, params_shape);
+    auto indices_a = make_shared<op::Parameter>(element::i32, Shape{2});
+    auto indices_b = make_shared<op::Parameter>(element::i64, Shape{2});
+    auto y =
+        make_shared<op::Gather>(params, indices_a) + make_shared<op::Gather>(params, indices_b);
+    auto C = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    autodiff::Adjoints adjoints(NodeVector{y}, NodeVector{C});
+
+    // Both contributions are concatenated into one slice list with i64 indices
+    auto sparse = adjoints.backprop_sparse_node(params);
+    EXPECT_EQ(sparse.first->get_element_type(), element::i64);
+    EXPECT_EQ(sparse.first->get_shape(), (Shape{4}));
+    EXPECT_EQ(sparse.second->get_shape(), (Shape{4, 3}));
+
+    auto update = make_shared<op::ScatterAdd>(params, sparse.first, sparse.second);
+    auto update_f =
+        make_shared<Function>(update, ParameterVector{params, indices_a, indices_b, C});
+    auto dense_f = make_shared<Function>(adjoints.backprop_node(params),
+                                         ParameterVector{params, indices_a, indices_b, C});
+
+    auto p = backend->create_tensor(element::f32, params_shape);
+    copy_data(p, vector<float>(shape_size(params_shape), 1));
+    auto a = backend->create_tensor(element::i32, Shape{2});
+    copy_data(a, vector<int32_t>{2, 0});
+    auto b = backend->create_tensor(element::i64, Shape{2});
+    copy_data(b, vector<int64_t>{2, 3});
+    auto c = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(c, vector<float>{1, 2, 3, 4, 5, 6});
+    auto result = backend->create_tensor(element::f32, params_shape);
+
+    auto dense_handle = backend->compile(dense_f);
+    dense_handle->call_with_validate({result}, {p, a, b, c});
+    EXPECT_EQ((vector<float>{4, 5, 6, 0, 0, 0, 2, 4, 6, 4, 5, 6}), read_vector<float>(result));
+
+    auto update_handle = backend->compile(update_f);
+    update_handle->call_with_validate({result}, {p, a, b, c});
+    EXPECT_EQ((vector<float>{5, 6, 7, 1, 1, 1, 3, 5, 7, 5, 6, 7}), read_vector<float>(result));
+}
+
 // clang-format off
 #ifdef AUTODIFF_BACKEND_${BACKEND_NAME}
 #undef AUTODIFF_BACKEND_${BACKEND_NAME}
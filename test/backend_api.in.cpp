@@ -162,3 +162,57 @@ NGRAPH_TEST(${BACKEND_NAME}, get_parameters_and_results)
     //     EXPECT_NE(results[i], func_results[i]);
     // }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async_pipelined)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    // Two sets of tensors so that staging request i+1 overlaps with executing request i
+    const size_t request_count = 4;
+    const size_t size_in_bytes = shape_size(shape) * sizeof(float);
+    vector<shared_ptr<runtime::Tensor>> a(2), b(2), result(2);
+    for (size_t i = 0; i < 2; i++)
+    {
+        a[i] = backend->create_tensor(element::f32, shape);
+        b[i] = backend->create_tensor(element::f32, shape);
+        result[i] = backend->create_tensor(element::f32, shape);
+    }
+
+    vector<vector<float>> av(request_count), bv(request_count), actual(request_count);
+    vector<future<bool>> calls(2);
+    auto finish = [&](size_t request) {
+        size_t slot = request % 2;
+        ASSERT_TRUE(calls[slot].get());
+        actual[request].resize(shape_size(shape));
+        result[slot]->read_async(actual[request].data(), size_in_bytes).get();
+    };
+    for (size_t i = 0; i < request_count; i++)
+    {
+        size_t slot = i % 2;
+        if (i >= 2)
+        {
+            finish(i - 2);
+        }
+        av[i] = {1.f * i, 2, 3, 4};
+        bv[i] = {5, 6, 7, 8.f * i};
+        auto write_a = a[slot]->write_async(av[i].data(), size_in_bytes);
+        auto write_b = b[slot]->write_async(bv[i].data(), size_in_bytes);
+        write_a.get();
+        write_b.get();
+        calls[slot] = handle->call_async({result[slot]}, {a[slot], b[slot]});
+    }
+    finish(request_count - 2);
+    finish(request_count - 1);
+
+    for (size_t i = 0; i < request_count; i++)
+    {
+        vector<float> expected = {1.f * i + 5, 8, 10, 4 + 8.f * i};
+        EXPECT_TRUE(test::all_close_f(actual[i], expected, MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
@@ -0,0 +1,132 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cinttypes>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/embedding_bag.hpp"
+#include "util/all_close_f.hpp"
+#include "util/ndarray.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_sum)
+{
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{5});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{5, 2});
+    auto offsets = make_shared<op::Parameter>(element::i32, Shape{2});
+    auto bag = make_shared<op::EmbeddingBag>(indices, weights, offsets);
+    auto f = make_shared<Function>(bag, ParameterVector{indices, weights, offsets});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i32, Shape{5});
+    copy_data(a, vector<int32_t>{0, 2, 4, 1, 3});
+    auto b = backend->create_tensor(element::f32, Shape{5, 2});
+    copy_data(b, vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    auto c = backend->create_tensor(element::i32, Shape{2});
+    copy_data(c, vector<int32_t>{0, 3});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{12, 15, 8, 10}), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_mean_empty_bag)
+{
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{3});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{5, 2});
+    auto offsets = make_shared<op::Parameter>(element::i32, Shape{3});
+    auto bag =
+        make_shared<op::EmbeddingBag>(indices, weights, offsets, op::EmbeddingBag::Mode::MEAN);
+    auto f = make_shared<Function>(bag, ParameterVector{indices, weights, offsets});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i32, Shape{3});
+    copy_data(a, vector<int32_t>{1, 3, 4});
+    auto b = backend->create_tensor(element::f32, Shape{5, 2});
+    copy_data(b, vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    auto c = backend->create_tensor(element::i32, Shape{3});
+    copy_data(c, vector<int32_t>{0, 0, 2});
+    auto result = backend->create_tensor(element::f32, Shape{3, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{0, 0, 4, 5, 8, 9}), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_max)
+{
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{5});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{5, 2});
+    auto offsets = make_shared<op::Parameter>(element::i32, Shape{2});
+    auto bag =
+        make_shared<op::EmbeddingBag>(indices, weights, offsets, op::EmbeddingBag::Mode::MAX);
+    auto f = make_shared<Function>(bag, ParameterVector{indices, weights, offsets});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i32, Shape{5});
+    copy_data(a, vector<int32_t>{0, 1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, Shape{5, 2});
+    copy_data(b, vector<float>{1, -1, -2, 4, 3, 0, 0, -5, 2, 2});
+    auto c = backend->create_tensor(element::i32, Shape{2});
+    copy_data(c, vector<int32_t>{0, 2});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1, 4, 3, 2}), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_per_sample_weights_i64)
+{
+    auto indices = make_shared<op::Parameter>(element::i64, Shape{5});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{5, 2});
+    auto offsets = make_shared<op::Parameter>(element::i64, Shape{2});
+    auto scales = make_shared<op::Parameter>(element::f32, Shape{5});
+    auto bag = make_shared<op::EmbeddingBag>(indices, weights, offsets, scales);
+    auto f = make_shared<Function>(bag, ParameterVector{indices, weights, offsets, scales});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i64, Shape{5});
+    copy_data(a, vector<int64_t>{0, 2, 4, 1, 3});
+    auto b = backend->create_tensor(element::f32, Shape{5, 2});
+    copy_data(b, vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    auto c = backend->create_tensor(element::i64, Shape{2});
+    copy_data(c, vector<int64_t>{0, 3});
+    auto d = backend->create_tensor(element::f32, Shape{5});
+    copy_data(d, vector<float>{1, 0.5f, 2, -1, 1});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b, c, d});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{18, 21.5f, 4, 4}), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -6378,6 +6378,31 @@ NGRAPH_TEST(${BACKEND_NAME}, generate_mask2)
     ASSERT_FALSE(std::any_of(result2_2.begin(), result2_2.end(), is_not_zero_or_one));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, generate_mask_counter_based)
+{
+    // Each mask element depends only on the seed and its position, so a shorter mask with
+    // the same seed is a prefix of a longer one
+    const uint64_t seed = 777;
+    auto training = op::Constant::create(element::f32, Shape{}, {1});
+    auto gen_mask =
+        make_shared<op::GenerateMask>(training, Shape{1, 13}, element::f32, seed, 0.5, true);
+    auto gen_mask2 =
+        make_shared<op::GenerateMask>(training, Shape{4, 32}, element::f32, seed, 0.5, true);
+    auto f = make_shared<Function>(NodeVector{gen_mask, gen_mask2}, ParameterVector{});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto result_tv1 = backend->create_tensor<float>(Shape{1, 13});
+    auto result_tv2 = backend->create_tensor<float>(Shape{4, 32});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_tv1, result_tv2}, {});
+    auto result1 = read_vector<float>(result_tv1);
+    auto result2 = read_vector<float>(result_tv2);
+    EXPECT_EQ(result1, vector<float>(result2.begin(), result2.begin() + result1.size()));
+    EXPECT_TRUE(std::any_of(result2.begin(), result2.end(), [](float x) { return x == 0.f; }));
+    EXPECT_TRUE(std::any_of(result2.begin(), result2.end(), [](float x) { return x == 1.f; }));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, quantize)
 {
     Shape input_shape{4, 3};
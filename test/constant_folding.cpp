@@ -16,8 +16,10 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 #include "gtest/gtest.h"
+#include "misc.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -364,3 +366,57 @@ TEST(constant_folding, pass_property)
     ASSERT_EQ(false, pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_EQ(false, pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+// Many independent chains of large constants, each folding over several waves
+static shared_ptr<Function> make_constant_chains(size_t chains, size_t elements)
+{
+    NodeVector results;
+    for (size_t i = 0; i < chains; i++)
+    {
+        vector<float> values(elements);
+        for (size_t j = 0; j < elements; j++)
+        {
+            values[j] = static_cast<float>((i * 31 + j * 7) % 101) - 50.0f;
+        }
+        auto a = make_shared<op::Constant>(element::f32, Shape{elements}, values);
+        auto b = make_shared<op::Constant>(element::f32, Shape{elements}, values);
+        auto sum = make_shared<op::Add>(make_shared<op::Abs>(a), make_shared<op::Relu>(b));
+        auto product = make_shared<op::Multiply>(make_shared<op::Sqrt>(sum), a);
+        results.push_back(make_shared<op::Reshape>(
+            make_shared<op::Negative>(product), AxisVector{0}, Shape{1, elements}));
+    }
+    return make_shared<Function>(results, ParameterVector{});
+}
+
+TEST(constant_folding, parallel_waves)
+{
+    const size_t chains = 256;
+    const size_t elements = 1024;
+
+    const size_t saved_threads = runtime::ThreadPool::get_compile_thread_count();
+    vector<vector<float>> expected;
+    for (size_t threads : {size_t(1), size_t(2), size_t(4), size_t(8), size_t(16)})
+    {
+        auto f = make_constant_chains(chains, elements);
+        runtime::ThreadPool::set_compile_thread_count(threads);
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>();
+        pass_manager.run_passes(f);
+        runtime::ThreadPool::set_compile_thread_count(saved_threads);
+
+        ASSERT_EQ(count_ops_of_type<op::Constant>(f), chains);
+        ASSERT_EQ(f->get_ops().size(), 2 * chains);
+        for (size_t i = 0; i < chains; i++)
+        {
+            auto values = get_result_constant<float>(f, i);
+            if (expected.size() < chains)
+            {
+                expected.push_back(values);
+            }
+            else
+            {
+                ASSERT_EQ(values, expected[i]);
+            }
+        }
+    }
+}
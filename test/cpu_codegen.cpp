@@ -14,7 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <thread>
+#include <unistd.h>
+
 #include "gtest/gtest.h"
+#include "ngraph/codegen/compiler.hpp"
+#include "ngraph/codegen/execution_engine.hpp"
+#include "ngraph/codegen/object_cache.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
@@ -60,3 +67,109 @@ TEST(cpu_codegen, abc)
                                   (test::NDArray<float, 2>({{50, 72}, {98, 128}})).get_vector(),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+TEST(cpu_codegen, object_cache)
+{
+    string directory = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_object_cache_" + to_string(getpid()));
+    file_util::remove_directory(directory);
+    codegen::ObjectCache cache(directory, 1000);
+
+    string key_a = codegen::ObjectCache::make_key("int a;", "-O3");
+    EXPECT_EQ(key_a, codegen::ObjectCache::make_key("int a;", "-O3"));
+    EXPECT_NE(key_a, codegen::ObjectCache::make_key("int a;", "-O0"));
+    EXPECT_NE(key_a, codegen::ObjectCache::make_key("int b;", "-O3"));
+
+    vector<char> object;
+    EXPECT_FALSE(cache.load(key_a, object));
+    vector<char> data_a(600, 'a');
+    cache.store(key_a, data_a.data(), data_a.size());
+    ASSERT_TRUE(cache.load(key_a, object));
+    EXPECT_EQ(object, data_a);
+    EXPECT_EQ(cache.get_hits(), 1);
+    EXPECT_EQ(cache.get_misses(), 1);
+
+    // The least recently used entry is evicted once the cache outgrows its limit
+    string key_b = codegen::ObjectCache::make_key("int b;", "-O3");
+    vector<char> data_b(600, 'b');
+    cache.store(key_b, data_b.data(), data_b.size());
+    EXPECT_FALSE(cache.load(key_a, object));
+    ASSERT_TRUE(cache.load(key_b, object));
+    EXPECT_EQ(object, data_b);
+
+    file_util::remove_directory(directory);
+}
+
+TEST(cpu_codegen, object_cache_concurrent_store)
+{
+    string directory = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_object_cache_store_" + to_string(getpid()));
+    file_util::remove_directory(directory);
+    codegen::ObjectCache cache(directory, 1 << 20);
+
+    // Threads that compiled the same code store the same entry at once
+    string key = codegen::ObjectCache::make_key("int a;", "-O3");
+    vector<char> data(1 << 16, 'a');
+    vector<thread> threads;
+    for (size_t i = 0; i < 8; i++)
+    {
+        threads.emplace_back([&]() { cache.store(key, data.data(), data.size()); });
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+
+    vector<char> object;
+    ASSERT_TRUE(cache.load(key, object));
+    EXPECT_EQ(object, data);
+    size_t files = 0;
+    file_util::iterate_files(directory, [&](const string& file, bool is_dir) { files++; });
+    EXPECT_EQ(files, 1);
+
+    file_util::remove_directory(directory);
+}
+
+TEST(cpu_codegen, object_cache_compile_twice)
+{
+    string directory = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_object_cache_compile_" + to_string(getpid()));
+    file_util::remove_directory(directory);
+    auto cache = make_shared<codegen::ObjectCache>(directory, 1 << 20);
+
+    // The static constructor has to run for an object loaded from the cache too
+    string source = R"(
+static int offset = 0;
+struct SetOffset
+{
+    SetOffset() { offset = 1; }
+} set_offset;
+extern "C" int add_offset(int x) { return x + offset; }
+)";
+    codegen::Compiler compiler;
+    string key = codegen::ObjectCache::make_key(source, compiler.get_options());
+    for (size_t i = 0; i < 2; i++)
+    {
+        codegen::ExecutionEngine engine;
+        vector<char> object;
+        if (cache->load(key, object))
+        {
+            ASSERT_TRUE(engine.add_object(object));
+        }
+        else
+        {
+            auto module = compiler.compile(source);
+            ASSERT_NE(module, nullptr);
+            engine.set_object_cache(cache, key);
+            engine.add_module(module);
+        }
+        engine.finalize();
+        auto add_offset = engine.find_function<int(int)>("add_offset");
+        ASSERT_TRUE(static_cast<bool>(add_offset));
+        EXPECT_EQ(add_offset(41), 42);
+    }
+    EXPECT_EQ(cache->get_misses(), 1);
+    EXPECT_EQ(cache->get_hits(), 1);
+
+    file_util::remove_directory(directory);
+}
@@ -30,6 +30,8 @@
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/embedding_bag.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/experimental/compiled_kernel.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/quantized_concat.hpp"
@@ -2883,6 +2885,98 @@ TEST(cpu_fusion, fuse_dropout)
     }
 }
 
+TEST(cpu_fusion, fuse_dropout_packed_mask)
+{
+    auto make_function = []() {
+        Shape shape{2, 3, 17, 19};
+        auto input = std::make_shared<op::Parameter>(element::f32, shape);
+        auto delta = std::make_shared<op::Parameter>(element::f32, shape);
+        auto value = op::Constant::create(element::f32, shape, {0.8});
+        auto const1 = op::Constant::create(element::f32, Shape{}, {1});
+        auto gen_mask =
+            std::make_shared<op::GenerateMask>(const1, shape, element::f32, 4321, 0.8, true);
+        auto fprop = std::make_shared<op::Divide>(
+            std::make_shared<op::Multiply>(gen_mask, input), value);
+        auto bprop = std::make_shared<op::Multiply>(
+            std::make_shared<op::Divide>(delta, value), gen_mask);
+        return make_shared<Function>(NodeVector{fprop, bprop}, ParameterVector{input, delta});
+    };
+
+    auto fuse_func = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(fuse_func);
+    ASSERT_EQ(count_ops_of_type<op::GenerateMask>(fuse_func), 0);
+    ASSERT_EQ(count_ops_of_type<op::DropoutBackprop>(fuse_func), 1);
+    auto dropouts = get_ops_of_type<op::Dropout>(fuse_func);
+    ASSERT_EQ(dropouts.size(), 1);
+    EXPECT_TRUE(dropouts.at(0)->get_packed_mask());
+    EXPECT_EQ(dropouts.at(0)->get_output_element_type(1), element::u8);
+
+    // The fused kernel draws the same Philox stream as GenerateMask, on every call
+    test::Uniform<float> rng(1.0f, 100.0f);
+    auto cpu_backend = runtime::Backend::create("CPU");
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+    auto cpu_func = make_function();
+    auto int_func = make_function();
+    vector<shared_ptr<runtime::Tensor>> cpu_args;
+    vector<shared_ptr<runtime::Tensor>> int_args;
+    for (shared_ptr<op::Parameter> param : cpu_func->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        cpu_args.push_back(cpu_backend->create_tensor(element::f32, param->get_shape()));
+        int_args.push_back(int_backend->create_tensor(element::f32, param->get_shape()));
+        copy_data(cpu_args.back(), tensor_val);
+        copy_data(int_args.back(), tensor_val);
+    }
+    vector<shared_ptr<runtime::Tensor>> cpu_results;
+    vector<shared_ptr<runtime::Tensor>> int_results;
+    for (auto result : cpu_func->get_results())
+    {
+        cpu_results.push_back(cpu_backend->create_tensor(element::f32, result->get_shape()));
+        int_results.push_back(int_backend->create_tensor(element::f32, result->get_shape()));
+    }
+    auto cpu_handle = cpu_backend->compile(cpu_func);
+    auto int_handle = int_backend->compile(int_func);
+    for (size_t call = 0; call < 2; call++)
+    {
+        cpu_handle->call_with_validate(cpu_results, cpu_args);
+        int_handle->call_with_validate(int_results, int_args);
+        for (size_t i = 0; i < cpu_results.size(); i++)
+        {
+            EXPECT_TRUE(test::all_close(read_vector<float>(cpu_results.at(i)),
+                                        read_vector<float>(int_results.at(i))));
+        }
+    }
+}
+
+TEST(cpu_fusion, fuse_dropout_unseeded_advances)
+{
+    Shape shape{2, 3, 17, 19};
+    auto input = std::make_shared<op::Parameter>(element::f32, shape);
+    auto value = op::Constant::create(element::f32, shape, {0.8});
+    auto const1 = op::Constant::create(element::f32, Shape{}, {1});
+    auto gen_mask = std::make_shared<op::GenerateMask>(const1, shape, element::f32, 0, 0.8);
+    auto fprop =
+        std::make_shared<op::Divide>(std::make_shared<op::Multiply>(gen_mask, input), value);
+    auto f = make_shared<Function>(NodeVector{fprop, gen_mask}, ParameterVector{input});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 1.0f));
+    auto result = backend->create_tensor(element::f32, shape);
+    auto mask = backend->create_tensor(element::f32, shape);
+    auto handle = backend->compile(f);
+    ASSERT_EQ(count_ops_of_type<op::Dropout>(f), 1);
+
+    // Like an unseeded GenerateMask, each call continues the stream instead of repeating it
+    handle->call_with_validate({result, mask}, {a});
+    auto first_mask = read_vector<float>(mask);
+    handle->call_with_validate({result, mask}, {a});
+    EXPECT_FALSE(test::all_close(first_mask, read_vector<float>(mask)));
+}
+
 TEST(cpu_fusion, fuse_leaky_relu)
 {
     auto make_function = [](Shape input_shape, vector<float> alpha_val) {
@@ -2966,6 +3060,51 @@ TEST(cpu_fusion, fuse_update_slice)
     }
 }
 
+TEST(cpu_fusion, fuse_embedding_bag)
+{
+    auto make_function = [](bool fuse = true) {
+        auto indices = std::make_shared<op::Parameter>(element::i32, Shape{4, 8});
+        auto weights = std::make_shared<op::Parameter>(element::f32, Shape{50, 16});
+        auto lookup = std::make_shared<op::EmbeddingLookup>(indices, weights);
+        auto sum = std::make_shared<op::Sum>(lookup, fuse ? AxisSet{1} : AxisSet{0});
+        return make_shared<Function>(NodeVector{sum}, ParameterVector{indices, weights});
+    };
+
+    auto fuse = make_function(true);
+    auto no_fuse = make_function(false);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(fuse);
+    pass_manager.run_passes(no_fuse);
+    EXPECT_EQ(1, count_ops_of_type<op::EmbeddingBag>(fuse));
+    EXPECT_EQ(0, count_ops_of_type<op::EmbeddingLookup>(fuse));
+    EXPECT_EQ(0, count_ops_of_type<op::EmbeddingBag>(no_fuse));
+
+    vector<int32_t> indices_val(32);
+    for (size_t i = 0; i < indices_val.size(); i++)
+    {
+        indices_val[i] = static_cast<int32_t>((i * 7) % 50);
+    }
+    vector<float> weights_val(50 * 16);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(weights_val);
+
+    auto run = [&](const string& backend_name) {
+        auto f = make_function();
+        auto backend = runtime::Backend::create(backend_name);
+        auto indices = backend->create_tensor(element::i32, Shape{4, 8});
+        copy_data(indices, indices_val);
+        auto weights = backend->create_tensor(element::f32, Shape{50, 16});
+        copy_data(weights, weights_val);
+        auto result = backend->create_tensor(element::f32, Shape{4, 16});
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {indices, weights});
+        return read_vector<float>(result);
+    };
+    EXPECT_TRUE(test::all_close(run("CPU"), run("INTERPRETER")));
+}
+
 TEST(cpu_fusion, fuse_update_slice_inplace)
 {
     auto make_function = [](bool fuse = true) {
@@ -36,10 +36,13 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/post_training_quantization.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_collective_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
@@ -656,6 +659,50 @@ TEST(cpu_test, mkldnn_layouts_eltwise)
     compare_backends(int_f, cpu_f, "INTERPRETER", "CPU");
 }
 
+TEST(cpu_test, mkldnn_layouts_eltwise_blocked_argument)
+{
+    // An Add joining a native parameter and a blocked convolution output feeds another
+    // convolution. Taking the blocked layout for the Add spares reordering its output back.
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto B1 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 1, 1});
+        auto C = make_shared<op::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto B2 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 1, 1});
+        auto conv1 = make_shared<op::Convolution>(A, B1, Strides{1, 1}, Strides{1, 1});
+        auto add = make_shared<op::Add>(C, conv1);
+        auto conv2 = make_shared<op::Convolution>(add, B2, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(NodeVector{conv2}, ParameterVector{A, B1, C, B2});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : make_function()->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+
+    // By default CPULayout takes the layout of the first argument
+    auto first_arg_f = make_function();
+    auto first_arg_results = execute(first_arg_f, args, "CPU");
+
+    set_environment("NGRAPH_PASS_CPU_LAYOUT_ELTWISE", "users", 1);
+    auto cpu_f = make_function();
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    unset_environment("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
+
+    EXPECT_LT(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f),
+              count_ops_of_type<runtime::cpu::op::ConvertLayout>(first_arg_f));
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+        EXPECT_TRUE(
+            test::all_close(first_arg_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
 TEST(cpu_test, convolution_large_padding)
 {
     Shape input_shape{1, 1, 100, 100};
@@ -759,6 +806,51 @@ TEST(cpu_test, memory_reuse_mxnet_densenet121)
 }
 #endif
 
+TEST(cpu_test, memory_reuse_unused_output)
+{
+    // Only the values of the TopK are used, so the buffer of its indices is free again once
+    // the GetOutputElement, which takes every output of the TopK, has run. The scratch output
+    // of a CompiledKernel is freed the same way.
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{64});
+        auto topk = make_shared<op::TopK>(
+            A, 0, element::i32, 16, true, op::TopK::SortType::SORT_VALUES);
+        auto values = make_shared<op::GetOutputElement>(topk, 1);
+        auto square = values * values;
+        return make_shared<Function>(square + values, ParameterVector{A});
+    };
+
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+
+    shared_ptr<Node> topk;
+    shared_ptr<Node> square;
+    for (const shared_ptr<Node>& node : cpu_f->get_ordered_ops())
+    {
+        if (dynamic_pointer_cast<op::TopK>(node))
+        {
+            topk = node;
+        }
+        else if (dynamic_pointer_cast<op::Multiply>(node))
+        {
+            square = node;
+        }
+    }
+    ASSERT_TRUE(topk && square);
+    EXPECT_EQ(square->output(0).get_tensor().get_pool_offset(),
+              topk->output(0).get_tensor().get_pool_offset());
+}
+
 TEST(cpu_test, memory_reuse_destructive_oi_relu)
 {
     auto shape_a = Shape{2, 5};
@@ -1964,6 +2056,47 @@ TEST(cpu_test, scatter_add_1d_indices_no_in_place)
         MIN_FLOAT_TOLERANCE_BITS));
 }
 
+TEST(cpu_test, scatter_add_duplicate_indices_rank4)
+{
+    Shape ref_shape{64, 3, 2, 17};
+    Shape indices_shape{20, 25};
+    Shape updates_shape{20, 25, 3, 2, 17};
+    auto make_function = [&]() {
+        auto R = make_shared<op::Parameter>(element::f32, ref_shape);
+        auto I = make_shared<op::Parameter>(element::i64, indices_shape);
+        auto U = make_shared<op::Parameter>(element::f32, updates_shape);
+        auto G = make_shared<op::ScatterAdd>(make_shared<op::Negative>(R), I, U);
+        return make_shared<Function>(G, ParameterVector{R, I, U});
+    };
+
+    vector<float> ref_val(shape_size(ref_shape));
+    vector<float> updates_val(shape_size(updates_shape));
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(ref_val);
+    rng.initialize(updates_val);
+    // Only the first 16 rows are updated, each of them many times
+    vector<int64_t> indices_val(shape_size(indices_shape));
+    for (size_t i = 0; i < indices_val.size(); i++)
+    {
+        indices_val[i] = static_cast<int64_t>((i * 5) % 16);
+    }
+
+    auto run = [&](const string& backend_name) {
+        auto backend = runtime::Backend::create(backend_name);
+        auto r = backend->create_tensor(element::f32, ref_shape);
+        copy_data(r, ref_val);
+        auto i = backend->create_tensor(element::i64, indices_shape);
+        copy_data(i, indices_val);
+        auto u = backend->create_tensor(element::f32, updates_shape);
+        copy_data(u, updates_val);
+        auto result = backend->create_tensor(element::f32, ref_shape);
+        auto c = backend->compile(make_function());
+        c->call_with_validate({result}, {r, i, u});
+        return read_vector<float>(result);
+    };
+    EXPECT_TRUE(test::all_close_f(run("CPU"), run("INTERPRETER"), MIN_FLOAT_TOLERANCE_BITS));
+}
+
 TEST(cpu_test, tensor_copy_from_interpreter_to_cpu)
 {
     // This test the copying of data between the tensor's having
@@ -2056,3 +2189,451 @@ TEST(cpu_test, tensor_copy_from_different_layout)
 
     EXPECT_EQ((vector<uint8_t>{1, 4, 2, 5, 3, 6}), read_vector<uint8_t>(b));
 }
+
+// Turns on the MKLDNN primitive cache, which is off by default, for the lifetime of the object
+class MKLDNNPrimitiveCacheGuard
+{
+public:
+    MKLDNNPrimitiveCacheGuard()
+        : m_previous_size(runtime::cpu::CPU_Backend::get_mkldnn_primitive_cache_size())
+    {
+        runtime::cpu::CPU_Backend::set_mkldnn_primitive_cache_size(256);
+    }
+    ~MKLDNNPrimitiveCacheGuard()
+    {
+        runtime::cpu::CPU_Backend::set_mkldnn_primitive_cache_size(m_previous_size);
+    }
+
+private:
+    size_t m_previous_size;
+};
+
+TEST(cpu_test, mkldnn_primitive_cache_key)
+{
+    auto make_desc = [](int padding) {
+        mkldnn::memory::desc data({2, 3, 8, 8},
+                                  mkldnn::memory::data_type::f32,
+                                  mkldnn::memory::format::nchw);
+        mkldnn::memory::desc weights({4, 3, 3, 3},
+                                     mkldnn::memory::data_type::f32,
+                                     mkldnn::memory::format::oihw);
+        mkldnn::memory::desc result({2, 4, 6 + 2 * padding, 6 + 2 * padding},
+                                    mkldnn::memory::data_type::f32,
+                                    mkldnn::memory::format::nchw);
+        return mkldnn::convolution_forward::desc(mkldnn::prop_kind::forward,
+                                                 mkldnn::algorithm::convolution_direct,
+                                                 data,
+                                                 weights,
+                                                 result,
+                                                 {1, 1},
+                                                 {0, 0},
+                                                 {padding, padding},
+                                                 {padding, padding},
+                                                 mkldnn::padding_kind::zero);
+    };
+    using Cache = runtime::cpu::MKLDNNPrimitiveCache;
+    mkldnn::primitive_attr attr;
+    auto key = Cache::make_key("convolution_forward", make_desc(0).data, attr);
+    EXPECT_FALSE(key.empty());
+    // Descriptors built separately from the same parameters share a key
+    EXPECT_EQ(key, Cache::make_key("convolution_forward", make_desc(0).data, attr));
+    EXPECT_NE(key, Cache::make_key("convolution_forward", make_desc(1).data, attr));
+    EXPECT_NE(key, Cache::make_key("convolution_forward_bias", make_desc(0).data, attr));
+
+    mkldnn::post_ops ops;
+    ops.append_eltwise(1.f, mkldnn::algorithm::eltwise_relu, 0.f, 0.f);
+    mkldnn::primitive_attr relu_attr;
+    relu_attr.set_post_ops(ops);
+    EXPECT_NE(key, Cache::make_key("convolution_forward", make_desc(0).data, relu_attr));
+}
+
+// A single convolution; tests that count cache misses use shapes no other test uses
+static shared_ptr<Function> make_cached_convolution(const Shape& data_shape,
+                                                    const Shape& filters_shape)
+{
+    auto data = make_shared<op::Parameter>(element::f32, data_shape);
+    auto filters = make_shared<op::Parameter>(element::f32, filters_shape);
+    auto conv = make_shared<op::Convolution>(data, filters);
+    return make_shared<Function>(conv, ParameterVector{data, filters});
+}
+
+TEST(cpu_test, mkldnn_primitive_cache_reuse)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+    MKLDNNPrimitiveCacheGuard cache_guard;
+
+    Shape data_shape{2, 3, 8, 8};
+    Shape filters_shape{4, 3, 3, 3};
+    Shape result_shape{2, 4, 6, 6};
+    auto backend = runtime::Backend::create("CPU");
+    auto data = backend->create_tensor(element::f32, data_shape);
+    auto filters = backend->create_tensor(element::f32, filters_shape);
+    auto first_result = backend->create_tensor(element::f32, result_shape);
+    auto second_result = backend->create_tensor(element::f32, result_shape);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(data);
+    rng.initialize(filters);
+
+    auto before = runtime::cpu::CPU_Backend::get_mkldnn_primitive_cache_stats();
+    {
+        auto handle = backend->compile(make_cached_convolution(data_shape, filters_shape));
+        handle->call_with_validate({first_result}, {data, filters});
+        // The cache keeps the primitive descriptors after the executable is destroyed
+        backend->remove_compiled_function(handle);
+    }
+    auto after_first = runtime::cpu::CPU_Backend::get_mkldnn_primitive_cache_stats();
+
+    auto handle = backend->compile(make_cached_convolution(data_shape, filters_shape));
+    handle->call_with_validate({second_result}, {data, filters});
+    auto after_second = runtime::cpu::CPU_Backend::get_mkldnn_primitive_cache_stats();
+
+    EXPECT_GT(after_first.misses, before.misses);
+    EXPECT_GT(after_second.hits, after_first.hits);
+    EXPECT_EQ(after_second.misses, after_first.misses);
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(first_result),
+                                  read_vector<float>(second_result),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
+
+TEST(cpu_test, mkldnn_primitive_cache_live_executables)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+    MKLDNNPrimitiveCacheGuard cache_guard;
+
+    Shape data_shape{2, 5, 9, 9};
+    Shape filters_shape{6, 5, 3, 3};
+    Shape result_shape{2, 6, 7, 7};
+    auto backend = runtime::Backend::create("CPU");
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+
+    auto before = runtime::cpu::CPU_Backend::get_mkldnn_primitive_cache_stats();
+    auto first = backend->compile(make_cached_convolution(data_shape, filters_shape));
+    auto second = backend->compile(make_cached_convolution(data_shape, filters_shape));
+    auto reference = int_backend->compile(make_cached_convolution(data_shape, filters_shape));
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    // Alternate between the executables, which run their own primitives created from the
+    // descriptor they share
+    for (size_t i = 0; i < 3; i++)
+    {
+        for (auto handle : {first, second})
+        {
+            vector<float> data(shape_size(data_shape));
+            vector<float> filters(shape_size(filters_shape));
+            rng.initialize(data);
+            rng.initialize(filters);
+
+            auto a = backend->create_tensor(element::f32, data_shape);
+            auto b = backend->create_tensor(element::f32, filters_shape);
+            auto result = backend->create_tensor(element::f32, result_shape);
+            copy_data(a, data);
+            copy_data(b, filters);
+            handle->call_with_validate({result}, {a, b});
+
+            auto int_a = int_backend->create_tensor(element::f32, data_shape);
+            auto int_b = int_backend->create_tensor(element::f32, filters_shape);
+            auto int_result = int_backend->create_tensor(element::f32, result_shape);
+            copy_data(int_a, data);
+            copy_data(int_b, filters);
+            reference->call_with_validate({int_result}, {int_a, int_b});
+
+            EXPECT_TRUE(test::all_close_f(read_vector<float>(int_result),
+                                          read_vector<float>(result),
+                                          MIN_FLOAT_TOLERANCE_BITS));
+        }
+    }
+    auto after = runtime::cpu::CPU_Backend::get_mkldnn_primitive_cache_stats();
+
+    // The second executable uses the descriptor the first one created while both are alive
+    EXPECT_EQ(after.misses, before.misses + 1);
+    EXPECT_EQ(after.hits, before.hits + 1);
+}
+
+TEST(cpu_test, mkldnn_primitive_cache_concurrent_contexts)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+    MKLDNNPrimitiveCacheGuard cache_guard;
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+
+    Shape data_shape{1, 7, 10, 10};
+    Shape filters_shape{3, 7, 3, 3};
+    Shape result_shape{1, 3, 8, 8};
+    auto backend = runtime::Backend::create("CPU");
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+
+    auto before = runtime::cpu::CPU_Backend::get_mkldnn_primitive_cache_stats();
+    auto handle = backend->compile(make_cached_convolution(data_shape, filters_shape));
+    auto reference = int_backend->compile(make_cached_convolution(data_shape, filters_shape));
+
+    auto make_calls = [&](unsigned int seed) {
+        test::Uniform<float> rng(-1.0f, 1.0f, seed);
+        for (size_t i = 0; i < 4; i++)
+        {
+            vector<float> data(shape_size(data_shape));
+            vector<float> filters(shape_size(filters_shape));
+            rng.initialize(data);
+            rng.initialize(filters);
+
+            auto a = backend->create_tensor(element::f32, data_shape);
+            auto b = backend->create_tensor(element::f32, filters_shape);
+            auto result = backend->create_tensor(element::f32, result_shape);
+            copy_data(a, data);
+            copy_data(b, filters);
+            handle->call_with_validate({result}, {a, b});
+
+            auto int_a = int_backend->create_tensor(element::f32, data_shape);
+            auto int_b = int_backend->create_tensor(element::f32, filters_shape);
+            auto int_result = int_backend->create_tensor(element::f32, result_shape);
+            copy_data(int_a, data);
+            copy_data(int_b, filters);
+            reference->call_with_validate({int_result}, {int_a, int_b});
+
+            EXPECT_TRUE(test::all_close_f(read_vector<float>(int_result),
+                                          read_vector<float>(result),
+                                          MIN_FLOAT_TOLERANCE_BITS));
+        }
+    };
+
+    // Create the descriptor in one context before the contexts run concurrently
+    make_calls(0);
+    std::thread call1(make_calls, 1);
+    std::thread call2(make_calls, 2);
+    std::thread call3(make_calls, 3);
+    call1.join();
+    call2.join();
+    call3.join();
+    auto after = runtime::cpu::CPU_Backend::get_mkldnn_primitive_cache_stats();
+
+    // Only the first context creates the descriptor; the other one builds its primitive from
+    // the cached descriptor, and neither waits for the other while executing
+    EXPECT_EQ(after.misses, before.misses + 1);
+    EXPECT_LE(after.hits, before.hits + 1);
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+TEST(cpu_test, warmup_at_compile)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    auto make_function = []() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+        auto filters = make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+        auto conv = make_shared<op::Convolution>(data, filters);
+        return make_shared<Function>(make_shared<op::Relu>(conv),
+                                     ParameterVector{data, filters});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto data = backend->create_tensor(element::f32, Shape{2, 3, 8, 8});
+    auto filters = backend->create_tensor(element::f32, Shape{4, 3, 3, 3});
+    auto expected = backend->create_tensor(element::f32, Shape{2, 4, 6, 6});
+    auto result = backend->create_tensor(element::f32, Shape{2, 4, 6, 6});
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(data);
+    rng.initialize(filters);
+
+    auto cold = backend->compile(make_function());
+    cold->call_with_validate({expected}, {data, filters});
+
+    set_environment("NGRAPH_CPU_WARMUP_AT_COMPILE", "1", 1);
+    auto warm = backend->compile(make_function());
+    unset_environment("NGRAPH_CPU_WARMUP_AT_COMPILE");
+
+    auto cpu_warm = static_pointer_cast<runtime::cpu::CPU_Executable>(warm);
+    EXPECT_GT(cpu_warm->get_warmup_microseconds(), 0u);
+    // The warmup run must not leave results that the first real call could reuse
+    data->set_stale(false);
+    filters->set_stale(false);
+    warm->call_with_validate({result}, {data, filters});
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(expected), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+TEST(cpu_test, warmup_skips_integer_division)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::i32, shape);
+    auto B = make_shared<op::Parameter>(element::i32, shape);
+    auto f = make_shared<Function>(make_shared<op::Divide>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    // Divide is not on the warmup allow-list; on zero-filled inputs it would trap
+    set_environment("NGRAPH_CPU_WARMUP_AT_COMPILE", "1", 1);
+    auto handle = backend->compile(f);
+    unset_environment("NGRAPH_CPU_WARMUP_AT_COMPILE");
+
+    auto cpu_handle = static_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    EXPECT_EQ(cpu_handle->get_warmup_microseconds(), 0u);
+
+    auto a = backend->create_tensor(element::i32, shape);
+    copy_data(a, vector<int32_t>{2, 4, 8, 16});
+    auto b = backend->create_tensor(element::i32, shape);
+    copy_data(b, vector<int32_t>{1, 2, 4, 8});
+    auto result = backend->create_tensor(element::i32, shape);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<int32_t>{2, 2, 2, 2}), read_vector<int32_t>(result));
+}
+
+TEST(cpu_test, post_training_quantization_int8)
+{
+    // Convolution + bias + Relu, MaxPool, then a fully connected layer with bias. The inputs
+    // are non-negative so every quantized op reads u8 data.
+    test::Uniform<float> rng(-0.5f, 0.5f);
+    vector<float> filters(8 * 3 * 3 * 3);
+    vector<float> conv_bias(8);
+    vector<float> weights(72 * 10);
+    vector<float> dot_bias(10);
+    rng.initialize(filters);
+    rng.initialize(conv_bias);
+    rng.initialize(weights);
+    rng.initialize(dot_bias);
+    auto make_function = [&]() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+        auto conv = make_shared<op::Convolution>(
+            data, op::Constant::create(element::f32, Shape{8, 3, 3, 3}, filters));
+        auto conv_broadcast =
+            make_shared<op::Broadcast>(op::Constant::create(element::f32, Shape{8}, conv_bias),
+                                       Shape{2, 8, 6, 6},
+                                       AxisSet{0, 2, 3});
+        auto relu = make_shared<op::Relu>(conv + conv_broadcast);
+        auto pool = make_shared<op::MaxPool>(relu, Shape{2, 2}, Strides{2, 2});
+        auto flat = make_shared<op::Reshape>(pool, AxisVector{0, 1, 2, 3}, Shape{2, 72});
+        auto dot = make_shared<op::Dot>(
+            flat, op::Constant::create(element::f32, Shape{72, 10}, weights));
+        auto dot_broadcast = make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{10}, dot_bias), Shape{2, 10}, AxisSet{0});
+        return make_shared<Function>(dot + dot_broadcast, ParameterVector{data});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto reference_backend = runtime::Backend::create("INTERPRETER");
+    test::Uniform<float> data_rng(0.0f, 1.0f);
+    vector<vector<shared_ptr<runtime::Tensor>>> batches;
+    for (size_t i = 0; i < 4; i++)
+    {
+        vector<float> values(2 * 3 * 8 * 8);
+        data_rng.initialize(values);
+        auto tensor = backend->create_tensor(element::f32, Shape{2, 3, 8, 8});
+        copy_data(tensor, values);
+        batches.push_back({tensor});
+    }
+
+    auto reference = make_function();
+    auto f = make_function();
+    auto ranges = pass::PostTrainingQuantization::calibrate(reference, backend, batches);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::PostTrainingQuantization>(ranges);
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Convolution>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+
+    auto accuracy = pass::PostTrainingQuantization::compare_accuracy(
+        reference, reference_backend, f, backend, batches);
+    ASSERT_EQ(accuracy.size(), 1);
+    EXPECT_LT(accuracy[0].relative_error, 0.05);
+}
+
+#ifdef NGRAPH_MLIR_ENABLE
+// Compiles make_function on the CPU backend with NGRAPH_MLIR set and compares the result to
+// INTERPRETER
+static void compare_mlir_to_interpreter(function<shared_ptr<Function>()> make_function)
+{
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : make_function()->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+
+    // NGRAPH_MLIR is read when the function is compiled
+    set_environment("NGRAPH_MLIR", "1", 1);
+    auto mlir_results = execute(make_function(), args, "CPU");
+    unset_environment("NGRAPH_MLIR");
+
+    for (size_t i = 0; i < mlir_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(mlir_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_test, mlir_dot_add_relu_dot)
+{
+    compare_mlir_to_interpreter([]() {
+        Shape shape{16, 16};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto W1 = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto W2 = make_shared<op::Parameter>(element::f32, shape);
+        auto hidden = make_shared<op::Relu>(make_shared<op::Dot>(A, W1) + B);
+        return make_shared<Function>(make_shared<op::Dot>(hidden, W2),
+                                     ParameterVector{A, W1, B, W2});
+    });
+}
+
+TEST(cpu_test, mlir_convolution_padded_dilated)
+{
+    compare_mlir_to_interpreter([]() {
+        auto images = make_shared<op::Parameter>(element::f32, Shape{2, 3, 9, 8});
+        auto filters = make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 2});
+        auto conv = make_shared<op::Convolution>(images,
+                                                 filters,
+                                                 Strides{2, 1},
+                                                 Strides{2, 3},
+                                                 CoordinateDiff{1, 2},
+                                                 CoordinateDiff{2, 0});
+        return make_shared<Function>(conv, ParameterVector{images, filters});
+    });
+}
+#endif
+
+// A failed collective is reported by the wait on its own ticket, not by later waits
+TEST(cpu_test, collective_executor_ticket_errors)
+{
+    runtime::cpu::executor::CPUCollectiveExecutor executor;
+    int runs = 0;
+    size_t first = executor.start([&]() { runs++; });
+    size_t failed = executor.start([]() { throw ngraph_error("collective failed"); });
+    size_t last = executor.start([&]() { runs++; });
+
+    EXPECT_NO_THROW(executor.wait(last));
+    EXPECT_NO_THROW(executor.wait(first));
+    EXPECT_THROW(executor.wait(failed), ngraph_error);
+    EXPECT_NO_THROW(executor.wait(failed));
+    EXPECT_EQ(runs, 2);
+
+    executor.start([]() { throw ngraph_error("collective failed"); });
+    EXPECT_THROW(executor.wait_all(), ngraph_error);
+    EXPECT_NO_THROW(executor.wait_all());
+}
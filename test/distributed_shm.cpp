@@ -0,0 +1,305 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fcntl.h>
+#include <functional>
+#include <numeric>
+#include <signal.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/distributed/shm.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Seconds a forked rank may run before SIGALRM kills it, so a hung collective fails the test
+static const unsigned int s_rank_timeout = 60;
+
+static string make_segment_name()
+{
+    static int s_job = 0;
+    return "/ngraph_shm_test_" + to_string(getpid()) + "_" + to_string(s_job++);
+}
+
+// Runs `body` in `size` forked processes, one per rank, with a shared-memory interface
+// installed as the distributed interface. Returns true if every rank succeeded. Small chunks
+// make every collective span several pipelined chunks.
+static bool run_ranks(int size,
+                      const function<bool(DistributedInterface&)>& body,
+                      const string& name = make_segment_name())
+{
+    vector<pid_t> children;
+    for (int rank = 0; rank < size; rank++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            alarm(s_rank_timeout);
+            bool ok = false;
+            try
+            {
+                set_distributed_interface(unique_ptr<DistributedInterface>(
+                    new distributed::SharedMemoryDistributedInterface(name, rank, size, 256)));
+                ok = body(*get_distributed_interface());
+            }
+            catch (...)
+            {
+            }
+            _exit(ok ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+    bool ok = true;
+    for (pid_t pid : children)
+    {
+        int status = 0;
+        waitpid(pid, &status, 0);
+        ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    return ok;
+}
+
+TEST(distributed_shm, all_reduce_sum)
+{
+    EXPECT_TRUE(run_ranks(4, [](DistributedInterface& comm) {
+        int rank = comm.get_rank();
+        vector<float> data(1000);
+        iota(data.begin(), data.end(), static_cast<float>(rank));
+        vector<float> result(data.size());
+        comm.all_reduce(data.data(),
+                        result.data(),
+                        element::Type_t::f32,
+                        reduction::Type::SUM,
+                        data.size());
+        for (size_t i = 0; i < result.size(); i++)
+        {
+            // sum over ranks of (i + rank) for four ranks
+            if (result[i] != 4 * i + 6)
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+}
+
+TEST(distributed_shm, all_reduce_min_max_prod_in_place)
+{
+    EXPECT_TRUE(run_ranks(3, [](DistributedInterface& comm) {
+        int64_t rank = comm.get_rank();
+        vector<int64_t> mins(77), maxs(77);
+        vector<double> prods(77);
+        for (size_t i = 0; i < mins.size(); i++)
+        {
+            mins[i] = maxs[i] = static_cast<int64_t>(i) * (rank + 1);
+            prods[i] = static_cast<double>(rank + 2);
+        }
+        comm.all_reduce(
+            mins.data(), mins.data(), element::Type_t::i64, reduction::Type::MIN, mins.size());
+        comm.all_reduce(
+            maxs.data(), maxs.data(), element::Type_t::i64, reduction::Type::MAX, maxs.size());
+        comm.all_reduce(
+            prods.data(), prods.data(), element::Type_t::f64, reduction::Type::PROD, prods.size());
+        for (size_t i = 0; i < mins.size(); i++)
+        {
+            if (mins[i] != static_cast<int64_t>(i) || maxs[i] != static_cast<int64_t>(3 * i) ||
+                prods[i] != 24)
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+}
+
+TEST(distributed_shm, stale_segment)
+{
+    // Leave behind the segment of a three-rank job whose ranks died while waiting for the third
+    string name = make_segment_name();
+    vector<pid_t> stale;
+    for (int rank = 0; rank < 2; rank++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            alarm(s_rank_timeout);
+            distributed::SharedMemoryDistributedInterface comm(name, rank, 3, 256);
+            _exit(0);
+        }
+        stale.push_back(pid);
+    }
+    int fd = -1;
+    while ((fd = shm_open(name.c_str(), O_RDONLY, 0)) < 0)
+    {
+        usleep(1000);
+    }
+    close(fd);
+    usleep(100000);
+    for (pid_t pid : stale)
+    {
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+    }
+
+    EXPECT_TRUE(run_ranks(3,
+                          [](DistributedInterface& comm) {
+                              int32_t value = comm.get_rank() + 1;
+                              int32_t sum = 0;
+                              comm.all_reduce(
+                                  &value, &sum, element::Type_t::i32, reduction::Type::SUM, 1);
+                              return sum == 6;
+                          },
+                          name));
+}
+
+TEST(distributed_shm, broadcast)
+{
+    EXPECT_TRUE(run_ranks(4, [](DistributedInterface& comm) {
+        vector<double> data(500, 0);
+        if (comm.get_rank() == 2)
+        {
+            iota(data.begin(), data.end(), 0.5);
+        }
+        comm.broadcast(data.data(), element::Type_t::f64, data.size(), 2);
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            if (data[i] != i + 0.5)
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+}
+
+TEST(distributed_shm, send_recv_ring)
+{
+    EXPECT_TRUE(run_ranks(4, [](DistributedInterface& comm) {
+        int rank = comm.get_rank();
+        int size = comm.get_size();
+        vector<int32_t> outgoing(300, rank);
+        vector<int32_t> incoming(300, -1);
+        int next = (rank + 1) % size;
+        int prev = (rank + size - 1) % size;
+        if (rank % 2 == 0)
+        {
+            comm.send(outgoing.data(), element::Type_t::i32, outgoing.size(), next);
+            comm.recv(incoming.data(), element::Type_t::i32, incoming.size(), prev);
+        }
+        else
+        {
+            comm.recv(incoming.data(), element::Type_t::i32, incoming.size(), prev);
+            comm.send(outgoing.data(), element::Type_t::i32, outgoing.size(), next);
+        }
+        return incoming == vector<int32_t>(300, prev);
+    }));
+}
+
+#if defined(NGRAPH_INTERPRETER_ENABLE)
+TEST(distributed_shm, all_reduce_op)
+{
+    EXPECT_TRUE(run_ranks(2, [](DistributedInterface& comm) {
+        Shape shape{2, 2};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::AllReduce>(A), ParameterVector{A});
+        auto backend = runtime::Backend::create("INTERPRETER");
+        auto a = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        backend->compile(f)->call_with_validate({result}, {a});
+        return read_vector<float>(result) == vector<float>{2, 4, 6, 8};
+    }));
+}
+
+TEST(distributed_shm, bucketed_all_reduce_op)
+{
+    EXPECT_TRUE(run_ranks(3, [](DistributedInterface& comm) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{5});
+        auto f = make_shared<Function>(
+            NodeVector{make_shared<op::AllReduce>(A), make_shared<op::AllReduce>(B * B)},
+            ParameterVector{A, B});
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::AllReduceBucketing>();
+        pass_manager.run_passes(f);
+        if (count_ops_of_type<op::AllReduce>(f) != 1)
+        {
+            return false;
+        }
+
+        float rank = static_cast<float>(comm.get_rank());
+        auto backend = runtime::Backend::create("INTERPRETER");
+        auto a = backend->create_tensor(element::f32, Shape{2, 3});
+        auto b = backend->create_tensor(element::f32, Shape{5});
+        auto result_a = backend->create_tensor(element::f32, Shape{2, 3});
+        auto result_b = backend->create_tensor(element::f32, Shape{5});
+        copy_data(a, vector<float>{rank, 1, 2, 3, 4, 5});
+        copy_data(b, vector<float>{1, 2, 3, 4, rank});
+        backend->compile(f)->call_with_validate({result_a, result_b}, {a, b});
+        // ranks 0, 1 and 2
+        return read_vector<float>(result_a) == vector<float>{3, 3, 6, 9, 12, 15} &&
+               read_vector<float>(result_b) == vector<float>{3, 12, 27, 48, 5};
+    }));
+}
+#endif
+
+#if defined(NGRAPH_CPU_ENABLE)
+TEST(distributed_shm, cpu_async_all_reduce)
+{
+    EXPECT_TRUE(run_ranks(2, [](DistributedInterface& comm) {
+        setenv("NGRAPH_CPU_ASYNC_COLLECTIVES", "1", 1);
+        Shape shape{16, 16};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto first = make_shared<op::AllReduce>(A * B);
+        // Computed while the first AllReduce is in flight
+        auto t = (A + B) * (A + B);
+        auto second = make_shared<op::AllReduce>(t);
+        auto third = make_shared<op::AllReduce>(first * t);
+        auto f = make_shared<Function>(NodeVector{third - second, first + B},
+                                       ParameterVector{A, B});
+
+        float rank = static_cast<float>(comm.get_rank());
+        auto backend = runtime::Backend::create("CPU");
+        auto exec = backend->compile(f);
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result0 = backend->create_tensor(element::f32, shape);
+        auto result1 = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), rank + 1));
+        copy_data(b, vector<float>(shape_size(shape), 2));
+        bool ok = true;
+        for (size_t i = 0; i < 3; i++)
+        {
+            exec->call_with_validate({result0, result1}, {a, b});
+            // first = 1 * 2 + 2 * 2, second = 3^2 + 4^2, third = first * second
+            ok = ok && read_vector<float>(result0) == vector<float>(shape_size(shape), 125) &&
+                 read_vector<float>(result1) == vector<float>(shape_size(shape), 8);
+        }
+        return ok;
+    }));
+}
+#endif
@@ -0,0 +1,210 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/convolution.hpp"
+#include "util/all_close.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Runs f on INTERPRETER (reference kernels) and on GCPU with identical random inputs and checks
+// that the results agree. Kernel timings are measured by op_bench, not here.
+static void compare_with_reference(shared_ptr<Function> f)
+{
+    vector<vector<float>> results;
+
+    test::Uniform<float> rng(-1.0f, 1.0f, 0);
+    vector<vector<float>> input_data;
+    for (auto& param : f->get_parameters())
+    {
+        vector<float> data(shape_size(param->get_shape()));
+        rng.initialize(data);
+        input_data.push_back(data);
+    }
+
+    for (const string& backend_name : {"INTERPRETER", "GCPU"})
+    {
+        auto backend = runtime::Backend::create(backend_name);
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        for (size_t i = 0; i < input_data.size(); i++)
+        {
+            auto param = f->get_parameters().at(i);
+            auto tensor = backend->create_tensor(element::f32, param->get_shape());
+            copy_data(tensor, input_data[i]);
+            inputs.push_back(tensor);
+        }
+        auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+        // Compile a copy since backend passes rewrite the graph in place
+        auto handle = backend->compile(clone_function(*f));
+        handle->call_with_validate({result}, inputs);
+        results.push_back(read_vector<float>(result));
+    }
+
+    EXPECT_TRUE(test::all_close(results[0], results[1], 1e-4f, 1e-5f));
+}
+
+TEST(gcpu, add_broadcast)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 16, 32});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{32});
+    auto add = make_shared<op::Add>(A, B, op::AutoBroadcastSpec(op::AutoBroadcastType::NUMPY));
+    compare_with_reference(make_shared<Function>(add, ParameterVector{A, B}));
+}
+
+TEST(gcpu, multiply)
+{
+    Shape shape{4, 16, 32};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto mul = make_shared<op::Multiply>(A, B);
+    compare_with_reference(make_shared<Function>(mul, ParameterVector{A, B}));
+}
+
+TEST(gcpu, tanh)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 16, 32});
+    auto tanh = make_shared<op::Tanh>(A);
+    compare_with_reference(make_shared<Function>(tanh, ParameterVector{A}));
+}
+
+TEST(gcpu, sum_rows)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{64, 128});
+    auto sum = make_shared<op::Sum>(A, AxisSet{1});
+    compare_with_reference(make_shared<Function>(sum, ParameterVector{A}));
+}
+
+TEST(gcpu, max_columns)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{64, 128});
+    auto max = make_shared<op::Max>(A, AxisSet{0});
+    compare_with_reference(make_shared<Function>(max, ParameterVector{A}));
+}
+
+TEST(gcpu, softmax)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{16, 100});
+    auto softmax = make_shared<op::Softmax>(A, AxisSet{1});
+    compare_with_reference(make_shared<Function>(softmax, ParameterVector{A}));
+}
+
+TEST(gcpu, convolution_batch)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{8, 16, 12, 12});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+    auto conv = make_shared<op::Convolution>(data,
+                                             filters,
+                                             Strides{1, 1},
+                                             Strides{1, 1},
+                                             CoordinateDiff{1, 1},
+                                             CoordinateDiff{1, 1});
+    compare_with_reference(make_shared<Function>(conv, ParameterVector{data, filters}));
+}
+
+// A single image with an output channel count that does not divide evenly into blocks
+TEST(gcpu, convolution_single_image)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 6, 13, 11});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{7, 6, 3, 3});
+    auto conv = make_shared<op::Convolution>(data,
+                                             filters,
+                                             Strides{2, 1},
+                                             Strides{1, 2},
+                                             CoordinateDiff{1, 2},
+                                             CoordinateDiff{0, 1});
+    compare_with_reference(make_shared<Function>(conv, ParameterVector{data, filters}));
+}
+
+// Convolution validation rejects empty batches, but the kernel itself is also used directly
+TEST(gcpu, convolution_kernel_zero_batch)
+{
+    vector<float> filters(5 * 4 * 3 * 3, 1.0f);
+    runtime::gcpu::kernel::convolution<float>(nullptr,
+                                              filters.data(),
+                                              nullptr,
+                                              Shape{0, 4, 8, 8},
+                                              Shape{5, 4, 3, 3},
+                                              Shape{0, 5, 6, 6},
+                                              Strides{1, 1},
+                                              Strides{1, 1},
+                                              CoordinateDiff{0, 0},
+                                              CoordinateDiff{0, 0},
+                                              Strides{1, 1});
+}
+
+TEST(gcpu, convolution_kernel_zero_channels)
+{
+    vector<float> out(2 * 5 * 6 * 6, 1.0f);
+    runtime::gcpu::kernel::convolution<float>(nullptr,
+                                              nullptr,
+                                              out.data(),
+                                              Shape{2, 0, 8, 8},
+                                              Shape{5, 0, 3, 3},
+                                              Shape{2, 5, 6, 6},
+                                              Strides{1, 1},
+                                              Strides{1, 1},
+                                              CoordinateDiff{0, 0},
+                                              CoordinateDiff{0, 0},
+                                              Strides{1, 1});
+    EXPECT_EQ(out, vector<float>(out.size(), 0.0f));
+}
+
+TEST(gcpu, max_pool)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 8, 14, 14});
+    auto pool =
+        make_shared<op::MaxPool>(A, Shape{3, 3}, Strides{2, 2}, Shape{1, 1}, Shape{1, 1});
+    compare_with_reference(make_shared<Function>(pool, ParameterVector{A}));
+}
+
+TEST(gcpu, avg_pool)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 8, 14, 14});
+    auto pool = make_shared<op::AvgPool>(A, Shape{2, 2}, Strides{2, 2});
+    compare_with_reference(make_shared<Function>(pool, ParameterVector{A}));
+}
+
+TEST(gcpu, concat)
+{
+    NodeVector args;
+    ParameterVector params;
+    for (size_t i = 0; i < 6; i++)
+    {
+        auto param = make_shared<op::Parameter>(element::f32, Shape{32, 1, 200});
+        args.push_back(param);
+        params.push_back(param);
+    }
+    auto concat = make_shared<op::Concat>(args, 1);
+    compare_with_reference(make_shared<Function>(concat, params));
+}
+
+TEST(gcpu, slice)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{32, 32, 16});
+    auto slice = make_shared<op::Slice>(A, Coordinate{4, 4, 2}, Coordinate{28, 28, 14});
+    compare_with_reference(make_shared<Function>(slice, ParameterVector{A}));
+}
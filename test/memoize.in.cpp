@@ -0,0 +1,154 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/memoize/memoize_backend.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// f(X, W) = X + W * W, where W * W stands for a weight transform
+static shared_ptr<Function> make_weight_transform_function(bool cacheable_weights = false)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto w = make_shared<op::Parameter>(element::f32, Shape{2, 2}, cacheable_weights);
+    return make_shared<Function>(x + w * w, ParameterVector{x, w});
+}
+
+static shared_ptr<runtime::memoize::MemoizeExecutable>
+    compile_memoized(const shared_ptr<Function>& f, bool hash_inputs = false)
+{
+    auto backend = make_shared<runtime::memoize::MemoizeBackend>(
+        runtime::Backend::create("${BACKEND_NAME}"), hash_inputs);
+    return dynamic_pointer_cast<runtime::memoize::MemoizeExecutable>(backend->compile(f));
+}
+
+NGRAPH_TEST(memoize_${BACKEND_NAME}, reuse_while_weights_unchanged)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = compile_memoized(make_weight_transform_function());
+    ASSERT_NE(handle, nullptr);
+
+    auto x = backend->create_tensor(element::f32, Shape{2, 2});
+    auto w = backend->create_tensor(element::f32, Shape{2, 2});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(w, vector<float>{1, 2, 3, 4});
+
+    // The first call can't know which inputs stay the same
+    copy_data(x, vector<float>{0, 0, 0, 0});
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{1, 4, 9, 16}, read_vector<float>(result)));
+    EXPECT_EQ(handle->get_stats().recomputes, 0);
+
+    // W did not change, so W * W is split off and computed once
+    copy_data(x, vector<float>{1, 1, 1, 1});
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, 5, 10, 17}, read_vector<float>(result)));
+    EXPECT_EQ(handle->get_stats().recomputes, 1);
+    EXPECT_EQ(handle->get_stats().reuses, 0);
+
+    copy_data(x, vector<float>{2, 2, 2, 2});
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{3, 6, 11, 18}, read_vector<float>(result)));
+    EXPECT_EQ(handle->get_stats().recomputes, 1);
+    EXPECT_EQ(handle->get_stats().reuses, 1);
+    EXPECT_EQ(handle->get_stats().skipped_ops, 1);
+
+    // Writing W invalidates the cached W * W
+    copy_data(w, vector<float>{2, 2, 2, 2});
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{6, 6, 6, 6}, read_vector<float>(result)));
+    EXPECT_EQ(handle->get_stats().recomputes, 2);
+
+    copy_data(x, vector<float>{0, 1, 2, 3});
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{4, 5, 6, 7}, read_vector<float>(result)));
+    EXPECT_EQ(handle->get_stats().recomputes, 2);
+    EXPECT_EQ(handle->get_stats().reuses, 2);
+    EXPECT_EQ(handle->get_stats().calls, 5);
+}
+
+NGRAPH_TEST(memoize_${BACKEND_NAME}, direct_memory_modification)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = compile_memoized(make_weight_transform_function(), true);
+
+    vector<float> w_data{1, 2, 3, 4};
+    auto x = backend->create_tensor(element::f32, Shape{2, 2});
+    auto w = backend->create_tensor(element::f32, Shape{2, 2}, w_data.data());
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(x, vector<float>{0, 0, 0, 0});
+
+    handle->call_with_validate({result}, {x, w});
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_EQ(handle->get_stats().recomputes, 1);
+
+    // The version of W does not change, but the hash of its contents does
+    w_data[0] = 5;
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{25, 4, 9, 16}, read_vector<float>(result)));
+    EXPECT_EQ(handle->get_stats().recomputes, 2);
+}
+
+NGRAPH_TEST(memoize_${BACKEND_NAME}, update_version_without_hashing)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = compile_memoized(make_weight_transform_function());
+
+    vector<float> w_data{1, 2, 3, 4};
+    auto x = backend->create_tensor(element::f32, Shape{2, 2});
+    auto w = backend->create_tensor(element::f32, Shape{2, 2}, w_data.data());
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(x, vector<float>{0, 0, 0, 0});
+
+    handle->call_with_validate({result}, {x, w});
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_EQ(handle->get_stats().recomputes, 1);
+
+    w_data[0] = 5;
+    w->update_version();
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{25, 4, 9, 16}, read_vector<float>(result)));
+    EXPECT_EQ(handle->get_stats().recomputes, 2);
+}
+
+NGRAPH_TEST(memoize_${BACKEND_NAME}, cacheable_parameter)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = compile_memoized(make_weight_transform_function(true));
+
+    auto x = backend->create_tensor(element::f32, Shape{2, 2});
+    auto w = backend->create_tensor(element::f32, Shape{2, 2});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(w, vector<float>{1, 2, 3, 4});
+
+    // Cacheable parameters are invariant from the first call
+    copy_data(x, vector<float>{0, 0, 0, 0});
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{1, 4, 9, 16}, read_vector<float>(result)));
+    EXPECT_EQ(handle->get_stats().recomputes, 1);
+
+    copy_data(x, vector<float>{1, 1, 1, 1});
+    handle->call_with_validate({result}, {x, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, 5, 10, 17}, read_vector<float>(result)));
+    EXPECT_EQ(handle->get_stats().reuses, 1);
+}
@@ -50,3 +50,24 @@ int unset_environment(const char* name)
     return unsetenv(name);
 #endif
 }
+
+EnvironmentGuard::EnvironmentGuard(const char* name, const char* value)
+    : m_name(name)
+{
+    const char* previous_value = getenv(name);
+    m_was_set = previous_value != nullptr;
+    m_previous_value = m_was_set ? previous_value : "";
+    set_environment(name, value, 1);
+}
+
+EnvironmentGuard::~EnvironmentGuard()
+{
+    if (m_was_set)
+    {
+        set_environment(m_name.c_str(), m_previous_value.c_str(), 1);
+    }
+    else
+    {
+        unset_environment(m_name.c_str());
+    }
+}
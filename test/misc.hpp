@@ -17,8 +17,25 @@
 #pragma once
 #include <stdio.h>
 #include <stdlib.h>
+#include <string>
 
 FILE* port_open(const char* command, const char* type);
 int port_close(FILE* stream);
 int set_environment(const char* name, const char* value, int overwrite);
 int unset_environment(const char* name);
+
+/// \brief Sets an environment variable for the lifetime of the guard, then restores its
+///        previous value, also when a test fails or throws
+class EnvironmentGuard
+{
+public:
+    EnvironmentGuard(const char* name, const char* value);
+    ~EnvironmentGuard();
+    EnvironmentGuard(const EnvironmentGuard&) = delete;
+    EnvironmentGuard& operator=(const EnvironmentGuard&) = delete;
+
+private:
+    std::string m_name;
+    bool m_was_set;
+    std::string m_previous_value;
+};
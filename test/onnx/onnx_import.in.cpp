@@ -26,8 +26,10 @@
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "misc.hpp"
 #include "ngraph/frontend/onnx_import/onnx.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/thread_pool.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
@@ -116,6 +118,38 @@ NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_initializers)
     EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
 }
 
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_initializers_serial_import)
+{
+    // Initializers are converted on this thread
+    const size_t saved_threads = runtime::ThreadPool::get_compile_thread_count();
+    runtime::ThreadPool::set_compile_thread_count(1);
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_initializers.prototxt"));
+    runtime::ThreadPool::set_compile_thread_count(saved_threads);
+
+    Inputs inputs{{1, 2, 3, 4}};
+    Outputs expected_outputs{{3, 6, 9, 12}};
+
+    Outputs outputs{execute(function, inputs, "${BACKEND_NAME}")};
+    EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
+}
+
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_initializers_kept)
+{
+    std::shared_ptr<Function> function;
+    {
+        EnvironmentGuard keep("NGRAPH_ONNX_KEEP_INITIALIZERS", "1");
+        function = onnx_import::import_onnx_model(
+            file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_initializers.prototxt"));
+    }
+
+    Inputs inputs{{1, 2, 3, 4}};
+    Outputs expected_outputs{{3, 6, 9, 12}};
+
+    Outputs outputs{execute(function, inputs, "${BACKEND_NAME}")};
+    EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
+}
+
 NGRAPH_TEST(onnx_${BACKEND_NAME}, model_override_op)
 {
     onnx_import::register_operator(
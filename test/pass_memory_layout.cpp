@@ -26,6 +26,7 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_aware_scheduling.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "util/test_tools.hpp"
@@ -236,3 +237,35 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_layout, memory_aware_scheduling)
+{
+    // Eight branches that each expand a parameter into a large tensor and reduce it again.
+    // Finishing a branch before the next one starts needs a single large tensor at a time.
+    auto A = make_shared<op::Parameter>(element::f32, Shape{256});
+    shared_ptr<Node> sum;
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto expanded = make_shared<op::Broadcast>(A, Shape{64, 256}, AxisSet{0});
+        auto reduced = make_shared<op::Sum>(make_shared<op::Abs>(expanded), AxisSet{0});
+        sum = sum ? sum + reduced : reduced;
+    }
+    auto f = make_shared<Function>(sum, ParameterVector{A});
+
+    pass::Manager layout;
+    layout.register_pass<pass::Liveness>();
+    layout.register_pass<pass::MemoryLayout>();
+    layout.run_passes(f);
+    size_t initial_pool_size = f->get_temporary_pool_size();
+
+    pass::MemoryAwareScheduling scheduling;
+    scheduling.run_on_function(f);
+    EXPECT_EQ(initial_pool_size, scheduling.get_initial_pool_size());
+    EXPECT_LT(scheduling.get_scheduled_pool_size(), initial_pool_size);
+
+    layout.run_passes(f);
+    EXPECT_EQ(scheduling.get_scheduled_pool_size(), f->get_temporary_pool_size());
+    // an expanded tensor, its Abs and the reduced ones
+    EXPECT_LT(f->get_temporary_pool_size(), 3 * 64 * 256 * sizeof(float));
+    EXPECT_GE(initial_pool_size, 8 * 64 * 256 * sizeof(float));
+}
@@ -0,0 +1,205 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/experimental/quantized_conv_bias.hpp"
+#include "ngraph/op/experimental/quantized_dot_bias.hpp"
+#include "ngraph/op/experimental/quantized_max_pool.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/post_training_quantization.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// Convolution + bias + Relu, MaxPool, then a fully connected layer with bias
+static shared_ptr<Function> make_conv_net()
+{
+    test::Uniform<float> rng(-0.5f, 0.5f);
+    vector<float> filters(4 * 3 * 3 * 3);
+    vector<float> weights(36 * 10);
+    vector<float> bias(10);
+    rng.initialize(filters);
+    rng.initialize(weights);
+    rng.initialize(bias);
+
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+    auto conv = make_shared<op::Convolution>(
+        data, op::Constant::create(element::f32, Shape{4, 3, 3, 3}, filters));
+    auto conv_bias = make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{4}, {0.1f, -0.1f, 0.2f, 0.0f}),
+        Shape{2, 4, 6, 6},
+        AxisSet{0, 2, 3});
+    auto relu = make_shared<op::Relu>(conv + conv_bias);
+    auto pool = make_shared<op::MaxPool>(relu, Shape{2, 2}, Strides{2, 2});
+    auto flat = make_shared<op::Reshape>(pool, AxisVector{0, 1, 2, 3}, Shape{2, 36});
+    auto dot = make_shared<op::Dot>(
+        flat, op::Constant::create(element::f32, Shape{36, 10}, weights));
+    auto dot_bias = make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{10}, bias), Shape{2, 10}, AxisSet{0});
+    return make_shared<Function>(dot + dot_bias, ParameterVector{data});
+}
+
+static vector<vector<shared_ptr<runtime::Tensor>>>
+    make_batches(runtime::Backend& backend, size_t count, bool is_signed = false, float outlier = 0)
+{
+    // Bell-shaped activations, folded to non-negative values like image data unless is_signed
+    // is set, with an optional outlier in each batch
+    mt19937 engine(0);
+    normal_distribution<float> distribution(0.0f, 0.5f);
+    vector<vector<shared_ptr<runtime::Tensor>>> batches;
+    for (size_t i = 0; i < count; i++)
+    {
+        vector<float> values(2 * 3 * 8 * 8);
+        for (float& value : values)
+        {
+            value = is_signed ? distribution(engine) : fabs(distribution(engine));
+        }
+        values[0] += outlier;
+        auto tensor = backend.create_tensor(element::f32, Shape{2, 3, 8, 8});
+        copy_data(tensor, values);
+        batches.push_back({tensor});
+    }
+    return batches;
+}
+
+TEST(post_training_quantization, calibrate)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto f = make_conv_net();
+    auto batches = make_batches(*backend, 4, true, 20.0f);
+
+    // Input and output of the convolution chain and of the dot chain
+    auto nodes = pass::PostTrainingQuantization::get_calibration_nodes(f);
+    ASSERT_EQ(nodes.size(), 4);
+
+    auto min_max = pass::PostTrainingQuantization::calibrate(f, backend, batches);
+    auto kl = pass::PostTrainingQuantization::calibrate(
+        f, backend, batches, pass::CalibrationMethod::KL_DIVERGENCE);
+    ASSERT_EQ(min_max.size(), 4);
+    ASSERT_EQ(kl.size(), 4);
+
+    EXPECT_EQ(nodes[0], f->get_parameters()[0]);
+    EXPECT_GT(min_max[0].max, 20.0f);
+    EXPECT_LT(min_max[0].min, 0.0f);
+    // The Relu output of the convolution chain is non-negative
+    EXPECT_GE(min_max[1].min, 0.0f);
+    // Entropy calibration clips the outlier
+    EXPECT_LT(kl[0].max, 10.0f);
+    for (size_t i = 0; i < kl.size(); i++)
+    {
+        EXPECT_LE(kl[i].max, min_max[i].max);
+        EXPECT_GE(kl[i].min, min_max[i].min);
+    }
+}
+
+TEST(post_training_quantization, rewrite_to_quantized_ops)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto f = make_conv_net();
+    auto ranges =
+        pass::PostTrainingQuantization::calibrate(f, backend, make_batches(*backend, 2));
+
+    pass::PostTrainingQuantization quantization(ranges);
+    EXPECT_TRUE(quantization.run_on_function(f));
+
+    EXPECT_EQ(quantization.get_quantized_op_count(), 3);
+    EXPECT_EQ(count_ops_of_type<op::Convolution>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedConvolutionBias>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedMaxPool>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedDotBias>(f), 1);
+    // The pooled int8 data is dequantized once, to be reshaped, and quantized again
+    EXPECT_EQ(count_ops_of_type<op::Quantize>(f), 2);
+    EXPECT_EQ(count_ops_of_type<op::Dequantize>(f), 2);
+    EXPECT_EQ(f->get_output_element_type(0), element::f32);
+}
+
+TEST(post_training_quantization, signed_input_stays_f32)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto f = make_conv_net();
+    auto ranges =
+        pass::PostTrainingQuantization::calibrate(f, backend, make_batches(*backend, 2, true));
+    ASSERT_LT(ranges[0].min, 0.0f);
+
+    // Only the dot chain, which reads the Relu output, is quantized
+    pass::PostTrainingQuantization quantization(ranges);
+    EXPECT_TRUE(quantization.run_on_function(f));
+    EXPECT_EQ(quantization.get_quantized_op_count(), 1);
+    EXPECT_EQ(count_ops_of_type<op::Convolution>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedConvolutionBias>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::MaxPool>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedDotBias>(f), 1);
+    for (auto& quantize : f->get_ops())
+    {
+        if (quantize->description() == "Quantize")
+        {
+            EXPECT_EQ(quantize->get_element_type(), element::u8);
+        }
+    }
+}
+
+TEST(post_training_quantization, ranges_apply_to_clones)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto reference = make_conv_net();
+    auto ranges =
+        pass::PostTrainingQuantization::calibrate(reference, backend, make_batches(*backend, 2));
+
+    auto f = clone_function(*reference);
+    pass::PostTrainingQuantization quantization(ranges);
+    EXPECT_TRUE(quantization.run_on_function(f));
+    EXPECT_EQ(quantization.get_quantized_op_count(), 3);
+    EXPECT_EQ(count_ops_of_type<op::Convolution>(reference), 1);
+}
+
+TEST(post_training_quantization, ranges_of_another_function)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto ranges = pass::PostTrainingQuantization::calibrate(
+        make_conv_net(), backend, make_batches(*backend, 2));
+    ranges.pop_back();
+
+    pass::PostTrainingQuantization quantization(ranges);
+    EXPECT_THROW(quantization.run_on_function(make_conv_net()), CheckFailure);
+}
+
+TEST(post_training_quantization, simulated_accuracy)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto reference = make_conv_net();
+    auto f = clone_function(*reference);
+    auto batches = make_batches(*backend, 4);
+    auto ranges = pass::PostTrainingQuantization::calibrate(reference, backend, batches);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::PostTrainingQuantization>(ranges, true);
+    pass_manager.run_passes(f);
+
+    auto accuracy = pass::PostTrainingQuantization::compare_accuracy(
+        reference, backend, f, backend, batches);
+    ASSERT_EQ(accuracy.size(), 1);
+    EXPECT_GT(accuracy[0].max_abs_error, 0.0);
+    EXPECT_LT(accuracy[0].relative_error, 0.05);
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <map>
 #include <sstream>
 
 #include "gmock/gmock.h"
@@ -139,6 +140,36 @@ TEST(serialize, friendly_name)
     handle->call_with_validate({result}, {x, z, y});
     EXPECT_EQ((vector<float>{50, 72, 98, 128}), read_vector<float>(result));
 }
+
+TEST(serialize, binary_main)
+{
+    // First create "f(A,B,C) = (A+B)*C".
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, ParameterVector{A, B, C}, "f");
+
+    stringstream ss;
+    serialize_binary(ss, f);
+    shared_ptr<Function> sfunc = deserialize(ss);
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto handle = backend->compile(sfunc);
+
+    auto x = backend->create_tensor(element::f32, shape);
+    copy_data(x, vector<float>{1, 2, 3, 4});
+    auto y = backend->create_tensor(element::f32, shape);
+    copy_data(y, vector<float>{5, 6, 7, 8});
+    auto z = backend->create_tensor(element::f32, shape);
+    copy_data(z, vector<float>{9, 10, 11, 12});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    handle->call_with_validate({result}, {x, y, z});
+    EXPECT_EQ((vector<float>{54, 80, 110, 144}), read_vector<float>(result));
+
+    handle->call_with_validate({result}, {x, z, y});
+    EXPECT_EQ((vector<float>{50, 72, 98, 128}), read_vector<float>(result));
+}
 #endif
 
 TEST(serialize, existing_models)
@@ -340,3 +371,128 @@ TEST(serialize, non_zero_node_output)
     EXPECT_EQ(topk_out.get_index(), 1);
     EXPECT_EQ(topk_out.get_node()->description(), "TopK");
 }
+
+TEST(serialize, binary_existing_models)
+{
+    vector<string> models = {"mxnet/mnist_mlp_forward.json",
+                             "mxnet/10_bucket_LSTM.json",
+                             "mxnet/LSTM_backward.json",
+                             "mxnet/LSTM_forward.json"};
+
+    for (const string& model : models)
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, model);
+        const string json_string = file_util::read_file_to_string(json_path);
+        shared_ptr<Function> f = ngraph::deserialize(json_string);
+
+        stringstream binary;
+        serialize_binary(binary, f);
+        EXPECT_LT(binary.str().size(), json_string.size());
+        shared_ptr<Function> g = deserialize(binary);
+        ASSERT_NE(g, nullptr);
+
+        // Some ops make their own Constant inputs, so the graphs are compared by op counts
+        map<string, size_t> f_op_counts;
+        for (auto& op : f->get_ops())
+        {
+            f_op_counts[op->description()]++;
+        }
+        map<string, size_t> g_op_counts;
+        for (auto& op : g->get_ops())
+        {
+            g_op_counts[op->description()]++;
+        }
+        EXPECT_EQ(f_op_counts, g_op_counts);
+        ASSERT_EQ(f->get_output_size(), g->get_output_size());
+        for (size_t i = 0; i < f->get_output_size(); i++)
+        {
+            EXPECT_EQ(f->get_output_element_type(i), g->get_output_element_type(i));
+            EXPECT_EQ(f->get_output_shape(i), g->get_output_shape(i));
+        }
+    }
+}
+
+TEST(serialize, binary_constant)
+{
+    const string tmp_file = "serialize_constant.bin";
+    vector<float> a_data{123.f, 456.f, INFINITY, -INFINITY, NAN};
+    vector<int64_t> b_data{-100, -10, -1, 0, 50, 5000000000001};
+    auto A = make_shared<op::Constant>(element::f32, Shape{5}, a_data);
+    auto B = make_shared<op::Constant>(element::i64, Shape{b_data.size()}, b_data);
+    auto f = make_shared<Function>(NodeVector{A, B}, ParameterVector{});
+
+    serialize_binary(tmp_file, f);
+    auto g = deserialize(tmp_file);
+    ASSERT_NE(g, nullptr);
+    file_util::remove_file(tmp_file);
+    auto a = dynamic_pointer_cast<op::Constant>(g->get_results().at(0)->get_argument(0));
+    auto b = dynamic_pointer_cast<op::Constant>(g->get_results().at(1)->get_argument(0));
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_TRUE(test::all_close_f(a->get_vector<float>(), a_data));
+    EXPECT_EQ(b->get_vector<int64_t>(), b_data);
+}
+
+TEST(serialize, binary_corrupt_input)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto B = make_shared<op::Constant>(element::f32, Shape{4}, vector<float>{1, 2, 3, 4});
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A});
+    stringstream ss;
+    serialize_binary(ss, f);
+    const string data = ss.str();
+
+    // Magic, version 1 and the inline function name
+    const string name = f->get_name();
+    const string header =
+        data.substr(0, 8) + string("\x01\x00", 2) + static_cast<char>(name.size()) + name;
+    ASSERT_EQ(data.substr(0, header.size()), header);
+    // A varint of 2^63 - 1
+    const string huge_count("\xff\xff\xff\xff\xff\xff\xff\xff\x7f", 9);
+
+    // Counts and lengths beyond the end of the input are rejected before anything is allocated
+    for (const string& corrupt : {data.substr(0, 9) + string("\x00", 1) + huge_count,
+                                  header + huge_count,
+                                  header + string("\x01\x00", 2) + huge_count})
+    {
+        stringstream in(corrupt);
+        EXPECT_THROW(deserialize(in), ngraph_error);
+    }
+
+    // Every truncation of a valid function is reported cleanly
+    for (size_t size = 8; size < data.size(); size++)
+    {
+        stringstream in(data.substr(0, size));
+        EXPECT_THROW(deserialize(in), ngraph_error) << "truncated to " << size << " bytes";
+    }
+
+    stringstream in(data);
+    EXPECT_NO_THROW(deserialize(in));
+}
+
+TEST(serialize, binary_non_zero_node_output)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{10});
+    auto topk = make_shared<op::TopK>(arg, 0, element::i32, 5, true);
+    auto abs = make_shared<op::Abs>(Output<Node>(topk, 1));
+    auto neg = make_shared<op::Negative>(arg);
+    abs->add_control_dependency(neg);
+    abs->set_friendly_name("abs");
+    auto result = make_shared<op::Result>(abs);
+    auto f = make_shared<Function>(ResultVector{result}, ParameterVector{arg});
+
+    stringstream ss;
+    serialize_binary(ss, f);
+    shared_ptr<Function> g = deserialize(ss.str());
+    auto g_result = g->get_results().at(0);
+    auto g_abs = g_result->input(0).get_source_output().get_node_shared_ptr();
+    EXPECT_EQ(g_abs->get_friendly_name(), "abs");
+    auto topk_out = g_abs->input(0).get_source_output();
+    EXPECT_EQ(topk_out.get_index(), 1);
+    EXPECT_EQ(topk_out.get_node()->description(), "TopK");
+    auto topk_node = static_cast<const op::TopK*>(topk_out.get_node());
+    EXPECT_EQ(topk_node->get_k(), 5);
+    EXPECT_EQ(topk_node->get_index_element_type(), element::i32);
+    ASSERT_EQ(g_abs->get_control_dependencies().size(), 1);
+    EXPECT_EQ((*g_abs->get_control_dependencies().begin())->description(), "Negative");
+}
@@ -0,0 +1,92 @@
+[
+    {
+        "name": "Function_3",
+        "ops": [
+            {
+                "cacheable": false,
+                "element_type": "float",
+                "friendly_name": "A",
+                "name": "Parameter_18",
+                "op": "Parameter",
+                "outputs": [
+                    "Parameter_18_0"
+                ],
+                "shape": [
+                    2,
+                    2
+                ]
+            },
+            {
+                "cacheable": false,
+                "element_type": "float",
+                "friendly_name": "B",
+                "name": "Parameter_19",
+                "op": "Parameter",
+                "outputs": [
+                    "Parameter_19_0"
+                ],
+                "shape": [
+                    2,
+                    2
+                ]
+            },
+            {
+                "cacheable": false,
+                "element_type": "float",
+                "friendly_name": "C",
+                "name": "Parameter_20",
+                "op": "Parameter",
+                "outputs": [
+                    "Parameter_20_0"
+                ],
+                "shape": [
+                    2,
+                    2
+                ]
+            },
+            {
+                "friendly_name": "Sum",
+                "inputs": [
+                    "Parameter_18",
+                    "Parameter_19"
+                ],
+                "name": "Add_21",
+                "op": "Add",
+                "outputs": [
+                    "Add_21_0"
+                ]
+            },
+            {
+                "friendly_name": "Product",
+                "inputs": [
+                    "Add_21",
+                    "Parameter_20"
+                ],
+                "name": "Multiply_22",
+                "op": "Multiply",
+                "outputs": [
+                    "Multiply_22_0"
+                ]
+            },
+            {
+                "inputs": [
+                    "Multiply_22"
+                ],
+                "name": "Result_23",
+                "needs_default_layout": false,
+                "op": "Result",
+                "outputs": [
+                    "Result_23_0"
+                ]
+            }
+        ],
+        "parameters": [
+            "Parameter_18",
+            "Parameter_19",
+            "Parameter_20"
+        ],
+        "result": [
+            "Result_23"
+        ]
+    }
+]
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/op/embedding_bag.hpp"
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/util/attr_types.hpp"
 
@@ -2578,6 +2579,69 @@ TEST(type_prop, embedding_lookup_shape_arg1_dynamic_embedding_length)
     ASSERT_TRUE(embed->get_output_partial_shape(0).same_scheme(expected));
 }
 
+TEST(type_prop, embedding_bag_static_shapes)
+{
+    auto indices = make_shared<op::Parameter>(element::i64, Shape{20});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{5, 10});
+    auto offsets = make_shared<op::Parameter>(element::i64, Shape{4});
+    auto bag = make_shared<op::EmbeddingBag>(indices, weights, offsets);
+    ASSERT_EQ(bag->get_element_type(), element::f32);
+    ASSERT_EQ(bag->get_shape(), (Shape{4, 10}));
+}
+
+TEST(type_prop, embedding_bag_dynamic_weights)
+{
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{20});
+    auto weights = make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto offsets = make_shared<op::Parameter>(element::i32, Shape{4});
+    auto bag = make_shared<op::EmbeddingBag>(indices, weights, offsets);
+    PartialShape expected{4, Dimension::dynamic()};
+    ASSERT_TRUE(bag->get_output_partial_shape(0).same_scheme(expected));
+}
+
+TEST(type_prop, embedding_bag_offsets_type_mismatch)
+{
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{20});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{5, 10});
+    auto offsets = make_shared<op::Parameter>(element::i64, Shape{4});
+    try
+    {
+        auto bag = make_shared<op::EmbeddingBag>(indices, weights, offsets);
+        FAIL() << "Did not detect mismatched offsets element type";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("must match indices element type"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, embedding_bag_per_sample_weights_not_sum)
+{
+    auto indices = make_shared<op::Parameter>(element::i32, Shape{20});
+    auto weights = make_shared<op::Parameter>(element::f32, Shape{5, 10});
+    auto offsets = make_shared<op::Parameter>(element::i32, Shape{4});
+    auto scales = make_shared<op::Parameter>(element::f32, Shape{20});
+    try
+    {
+        auto bag = make_shared<op::EmbeddingBag>(
+            indices, weights, offsets, scales, op::EmbeddingBag::Mode::MAX);
+        FAIL() << "Did not detect per_sample_weights outside of SUM mode";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(),
+                             std::string("per_sample_weights are only supported in SUM mode"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
 TEST(type_prop, comparison_good)
 {
     auto tv0_2_4_param_0 = make_shared<op::Parameter>(element::f32, Shape{2, 4});
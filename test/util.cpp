@@ -28,6 +28,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/state/philox.hpp"
 #include "util/all_close.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/ndarray.hpp"
@@ -394,6 +395,134 @@ TEST(graph_util, test_subgraph_topological_sort_control_dependencies)
     ASSERT_EQ(expected, sorted);
 }
 
+// Checks that every op of ordered comes after its arguments and control dependencies
+static bool is_topologically_ordered(const list<shared_ptr<Node>>& ordered)
+{
+    set<shared_ptr<Node>> seen;
+    for (const shared_ptr<Node>& node : ordered)
+    {
+        for (const shared_ptr<Node>& arg : node->get_arguments())
+        {
+            if (seen.count(arg) == 0)
+            {
+                return false;
+            }
+        }
+        for (const shared_ptr<Node>& dep : node->get_control_dependencies())
+        {
+            if (seen.count(dep) == 0)
+            {
+                return false;
+            }
+        }
+        seen.insert(node);
+    }
+    return true;
+}
+
+TEST(graph_util, ordered_ops_repaired_after_replace_node)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto mul = add * C;
+    auto f = make_shared<Function>(mul, ParameterVector{A, B, C});
+
+    auto ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered, f->get_ordered_ops());
+
+    auto abs = make_shared<op::Abs>(B);
+    auto sub = make_shared<op::Subtract>(A, abs);
+    replace_node(add, sub);
+    auto repaired = f->get_ordered_ops();
+    EXPECT_TRUE(is_topologically_ordered(repaired));
+    EXPECT_EQ(repaired.size(), ordered.size() + 1);
+    EXPECT_EQ(find(repaired.begin(), repaired.end(), add), repaired.end());
+    // the new ops are placed just before their first user
+    auto it = find(repaired.begin(), repaired.end(), mul);
+    ASSERT_NE(it, repaired.end());
+    EXPECT_EQ(*--it, sub);
+    EXPECT_EQ(*--it, abs);
+}
+
+TEST(graph_util, ordered_ops_repaired_after_control_dependency)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto abs_a = make_shared<op::Abs>(A);
+    auto abs_b = make_shared<op::Abs>(B);
+    auto f = make_shared<Function>(NodeVector{abs_a, abs_b}, ParameterVector{A, B});
+
+    auto ordered = f->get_ordered_ops();
+    auto position = [&](const shared_ptr<Node>& node) {
+        return distance(ordered.begin(), find(ordered.begin(), ordered.end(), node));
+    };
+    bool a_first = position(abs_a) < position(abs_b);
+    auto first = a_first ? abs_a : abs_b;
+    auto second = a_first ? abs_b : abs_a;
+    first->add_control_dependency(second);
+    auto repaired = f->get_ordered_ops();
+    EXPECT_TRUE(is_topologically_ordered(repaired));
+    EXPECT_EQ(repaired.size(), ordered.size());
+
+    first->remove_control_dependency(second);
+    EXPECT_TRUE(is_topologically_ordered(f->get_ordered_ops()));
+}
+
+// Checks that the repaired order of f holds exactly the ops of f, in topological order
+static void check_ordered_ops(const shared_ptr<Function>& f)
+{
+    auto ordered = f->get_ordered_ops();
+    auto ops = f->get_ops();
+    EXPECT_TRUE(is_topologically_ordered(ordered));
+    EXPECT_EQ(ordered.size(), ops.size());
+    EXPECT_EQ(set<shared_ptr<Node>>(ordered.begin(), ordered.end()),
+              set<shared_ptr<Node>>(ops.begin(), ops.end()));
+}
+
+TEST(graph_util, ordered_ops_repaired_after_many_rewrites)
+{
+    Shape shape{2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    NodeVector left{A};
+    NodeVector right{B};
+    for (size_t i = 0; i < 8; i++)
+    {
+        left.push_back(make_shared<op::Abs>(left.back()));
+        right.push_back(make_shared<op::Negative>(right.back()));
+    }
+    auto f = make_shared<Function>(make_shared<op::Add>(left.back(), right.back()),
+                                   ParameterVector{A, B});
+    check_ordered_ops(f);
+
+    // Drops left[1] and left[2], and left[3] may now come before its new argument
+    left[3]->input(0).replace_source_output(right[6]->output(0));
+    check_ordered_ops(f);
+    replace_node(right[4], make_shared<op::Sqrt>(right[3]));
+    check_ordered_ops(f);
+    left[7]->add_control_dependency(right[8]);
+    check_ordered_ops(f);
+    left[7]->remove_control_dependency(right[8]);
+    check_ordered_ops(f);
+
+    // Rewriting another function leaves the order alone, even past the changes that are kept
+    auto ordered = f->get_ordered_ops();
+    auto abs = make_shared<op::Abs>(A);
+    auto g = make_shared<Function>(abs, ParameterVector{A});
+    replace_node(abs, make_shared<op::Negative>(A));
+    EXPECT_EQ(ordered, f->get_ordered_ops());
+    auto result = g->get_results().at(0);
+    for (size_t i = 0; i < 100000; i++)
+    {
+        result->input(0).replace_source_output((i % 2 == 0 ? A : B)->output(0));
+    }
+    EXPECT_EQ(ordered, f->get_ordered_ops());
+}
+
 TEST(util, enum_mask_construction)
 {
     enum class Type : uint32_t
@@ -657,3 +786,35 @@ TEST(util, clone_function_friendly_name)
     EXPECT_TRUE(found_A);
     EXPECT_TRUE(found_B);
 }
+
+TEST(util, philox4x32_10_known_answers)
+{
+    // Known-answer vectors from the Random123 distribution
+    EXPECT_EQ(philox::philox4x32_10(philox::Block{{0, 0, 0, 0}}, 0, 0),
+              (philox::Block{{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}}));
+    EXPECT_EQ(philox::philox4x32_10(philox::Block{{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+                                    0xffffffff,
+                                    0xffffffff),
+              (philox::Block{{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}}));
+    EXPECT_EQ(philox::philox4x32_10(philox::Block{{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}},
+                                    0xa4093822,
+                                    0x299f31d0),
+              (philox::Block{{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}}));
+}
+
+TEST(util, philox_bernoulli_byte)
+{
+    EXPECT_EQ(philox::bernoulli_byte(7, 3, philox::bernoulli_threshold(0.0)), 0x00);
+    EXPECT_EQ(philox::bernoulli_byte(7, 3, philox::bernoulli_threshold(1.0)), 0xFF);
+
+    size_t kept = 0;
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        uint8_t bits = philox::bernoulli_byte(42, i, philox::bernoulli_threshold(0.25));
+        for (size_t b = 0; b < 8; b++)
+        {
+            kept += (bits >> b) & 1;
+        }
+    }
+    EXPECT_NEAR(kept / 8000.0, 0.25, 0.02);
+}